@@ -0,0 +1,79 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-21, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+//
+// Per launch overhead of short loops on the persistent thread team compared
+// to loops that fork and join an OpenMP parallel region at every launch.
+// The argument is the number of loop iterations.
+//
+
+#include <vector>
+
+#include "benchmark/benchmark_api.h"
+
+#include "RAJA/RAJA.hpp"
+
+template <typename ExecPolicy>
+static void benchmark_daxpy(benchmark::State& state)
+{
+  const int n = state.range(0);
+  std::vector<double> a_vec(n, 1.0);
+  std::vector<double> b_vec(n, 2.0);
+  double* a = a_vec.data();
+  double* b = b_vec.data();
+  double c = 3.14159;
+
+  while (state.KeepRunning()) {
+    RAJA::forall<ExecPolicy>(RAJA::RangeSegment(0, n),
+                             [=](int i) { a[i] += b[i] * c; });
+  }
+  state.SetItemsProcessed(state.iterations() * n);
+}
+
+template <typename LaunchPolicy, typename LoopPolicy>
+static void benchmark_launch_daxpy(benchmark::State& state)
+{
+  const int n = state.range(0);
+  std::vector<double> a_vec(n, 1.0);
+  std::vector<double> b_vec(n, 2.0);
+  double* a = a_vec.data();
+  double* b = b_vec.data();
+  double c = 3.14159;
+
+  while (state.KeepRunning()) {
+    RAJA::expt::launch<LaunchPolicy>(
+        RAJA::expt::HOST,
+        RAJA::expt::Resources(RAJA::expt::Teams(1), RAJA::expt::Threads(n)),
+        [=](RAJA::expt::LaunchContext ctx) {
+          RAJA::expt::loop<LoopPolicy>(ctx,
+                                       RAJA::RangeSegment(0, n),
+                                       [&](int i) { a[i] += b[i] * c; });
+        });
+  }
+  state.SetItemsProcessed(state.iterations() * n);
+}
+
+BENCHMARK_TEMPLATE(benchmark_daxpy, RAJA::seq_exec)
+    ->Arg(100)->Arg(1000)->Arg(10000);
+BENCHMARK_TEMPLATE(benchmark_daxpy, RAJA::thread_team_for_exec<>)
+    ->Arg(100)->Arg(1000)->Arg(10000);
+
+BENCHMARK_TEMPLATE(benchmark_launch_daxpy,
+                   RAJA::expt::LaunchPolicy<RAJA::expt::thread_team_launch_t>,
+                   RAJA::expt::LoopPolicy<RAJA::thread_team_for_exec<>>)
+    ->Arg(100)->Arg(1000)->Arg(10000);
+
+#if defined(RAJA_ENABLE_OPENMP)
+BENCHMARK_TEMPLATE(benchmark_daxpy, RAJA::omp_parallel_for_exec)
+    ->Arg(100)->Arg(1000)->Arg(10000);
+
+BENCHMARK_TEMPLATE(benchmark_launch_daxpy,
+                   RAJA::expt::LaunchPolicy<RAJA::expt::omp_launch_t>,
+                   RAJA::expt::LoopPolicy<RAJA::omp_for_exec>)
+    ->Arg(100)->Arg(1000)->Arg(10000);
+#endif
+
+BENCHMARK_MAIN();
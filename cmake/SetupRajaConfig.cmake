@@ -49,6 +49,16 @@ else ()
     set(RAJA_USE_CLOCK   OFF CACHE BOOL "Use clock from time.h for timer"    )
 endif ()
 
+option(RAJA_ENABLE_PERF_COUNTERS "Enable RAJA::PerfCounterTimer using Linux perf_event_open" Off)
+if (RAJA_ENABLE_PERF_COUNTERS)
+  include(CheckIncludeFile)
+  check_include_file(linux/perf_event.h RAJA_HAVE_LINUX_PERF_EVENT_H)
+  if (NOT RAJA_HAVE_LINUX_PERF_EVENT_H)
+    message(WARNING "linux/perf_event.h not found, disabling RAJA_ENABLE_PERF_COUNTERS")
+    set(RAJA_ENABLE_PERF_COUNTERS Off CACHE BOOL "" FORCE)
+  endif ()
+endif ()
+
 include(CheckSymbolExists)
 check_symbol_exists(posix_memalign stdlib.h RAJA_HAVE_POSIX_MEMALIGN)
 check_symbol_exists(std::aligned_alloc stdlib.h RAJA_HAVE_ALIGNED_ALLOC)
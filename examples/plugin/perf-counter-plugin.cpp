@@ -0,0 +1,56 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-21, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "RAJA/util/PluginStrategy.hpp"
+#include "RAJA/util/Timer.hpp"
+
+#include <cstdio>
+
+#if defined(RAJA_HAVE_PERF_COUNTER_TIMER)
+
+class PerfCounterPlugin : public RAJA::util::PluginStrategy
+{
+public:
+  void preLaunch(const RAJA::util::PluginContext& p) override
+  {
+    if (p.platform == RAJA::Platform::host) {
+      timer.start();
+    }
+  }
+
+  void postLaunch(const RAJA::util::PluginContext& p) override
+  {
+    if (p.platform != RAJA::Platform::host) {
+      return;
+    }
+    timer.stop();
+
+    printf("[PerfCounterPlugin]: host kernel");
+    for (size_t i = 0; i < timer.numCounters(); ++i) {
+      if (timer.available(i)) {
+        printf(" %s %lld",
+               RAJA::PerfCounterTimer::name(timer.getCounter(i)),
+               timer.lastCounter(i));
+      }
+    }
+    printf("\n");
+  }
+
+private:
+  RAJA::PerfCounterTimer timer;
+};
+
+// Dynamically loading plugin.
+extern "C" RAJA::util::PluginStrategy *getPlugin()
+{
+  return new PerfCounterPlugin;
+}
+
+// Statically loading plugin.
+static RAJA::util::PluginRegistry::add<PerfCounterPlugin> P("PerfCounter", "Prints hardware counter deltas of host kernel executions.");
+
+#endif
@@ -435,6 +435,105 @@ int main(int RAJA_UNUSED_ARG(argc), char **RAJA_UNUSED_ARG(argv[]))
 
   checkResult<double>(Cview, N);
 //printResult<double>(Cview, N);
+
+//----------------------------------------------------------------------------//
+
+  std::cout << "\n Running OpenMP tiled mat-mult (RAJA-nested - thread groups)...\n";
+
+  std::memset(C, 0, N*N * sizeof(double));
+
+  //
+  // This example runs each team on a group of 4 OpenMP threads, as a thread
+  // block on a GPU. The threads of a group stage tiles of A and B in the
+  // scratch memory of the team, which stays in cache, and ctx.teamSync() is
+  // a barrier of the group. Tiles are numbered row major and the threads of
+  // a team iterate over the THREAD_SZ x THREAD_SZ entries of a tile.
+  //
+  using omp_team_launch_policy = RAJA::expt::LaunchPolicy<
+                                   RAJA::expt::omp_team_launch_t<4>
+#if defined(RAJA_ENABLE_CUDA)
+                                   ,
+                                   RAJA::expt::cuda_launch_t<true>
+#endif
+#if defined(RAJA_ENABLE_HIP)
+                                   ,
+                                   RAJA::expt::hip_launch_t<true>
+#endif
+                                   >;
+
+  using omp_team_policy = RAJA::expt::LoopPolicy<RAJA::expt::omp_team_exec
+#if defined(RAJA_DEVICE_ACTIVE)
+                                                 ,gpu_block_x_policy
+#endif
+    >;
+
+  using omp_thread_policy = RAJA::expt::LoopPolicy<RAJA::expt::omp_team_thread_exec
+#if defined(RAJA_DEVICE_ACTIVE)
+                                                   ,gpu_thread_x_policy
+#endif
+    >;
+
+  RAJA::RangeSegment tile_range(0, NTeams*NTeams);
+  RAJA::RangeSegment entry_range(0, THREAD_SZ*THREAD_SZ);
+
+  RAJA::expt::launch<omp_team_launch_policy>(RAJA::expt::HOST,
+   RAJA::expt::Resources(RAJA::expt::Teams(NTeams*NTeams),
+                         RAJA::expt::Threads(THREAD_SZ*THREAD_SZ),
+                         3 * THREAD_SZ*THREAD_SZ * sizeof(double)),
+       [=] RAJA_HOST_DEVICE(RAJA::expt::LaunchContext ctx) {
+
+   RAJA::expt::loop<omp_team_policy>(ctx, tile_range, [&] (int t) {
+
+       const int row0 = (t / NTeams) * THREAD_SZ;
+       const int col0 = (t % NTeams) * THREAD_SZ;
+
+       double *As = ctx.getSharedMemory<double>(THREAD_SZ*THREAD_SZ);
+       double *Bs = ctx.getSharedMemory<double>(THREAD_SZ*THREAD_SZ);
+       double *Cs = ctx.getSharedMemory<double>(THREAD_SZ*THREAD_SZ);
+
+       RAJA::expt::loop<omp_thread_policy>(ctx, entry_range, [&] (int e) {
+           Cs[e] = 0.0;
+       });
+
+       for (int k0 = 0; k0 < N; k0 += THREAD_SZ) {
+
+         RAJA::expt::loop<omp_thread_policy>(ctx, entry_range, [&] (int e) {
+             const int tx = e % THREAD_SZ;
+             const int ty = e / THREAD_SZ;
+             As[e] = (row0 + ty < N && k0 + tx < N) ? Aview(row0 + ty, k0 + tx) : 0.0;
+             Bs[e] = (k0 + ty < N && col0 + tx < N) ? Bview(k0 + ty, col0 + tx) : 0.0;
+         });
+
+         ctx.teamSync();
+
+         RAJA::expt::loop<omp_thread_policy>(ctx, entry_range, [&] (int e) {
+             const int tx = e % THREAD_SZ;
+             const int ty = e / THREAD_SZ;
+             double dot = 0.0;
+             for (int k = 0; k < THREAD_SZ; ++k) {
+               dot += As[ty * THREAD_SZ + k] * Bs[k * THREAD_SZ + tx];
+             }
+             Cs[e] += dot;
+         });
+
+         ctx.teamSync();
+       }
+
+       RAJA::expt::loop<omp_thread_policy>(ctx, entry_range, [&] (int e) {
+           const int row = row0 + e / THREAD_SZ;
+           const int col = col0 + e % THREAD_SZ;
+           if (row < N && col < N) {
+             Cview(row, col) = Cs[e];
+           }
+       });
+
+       ctx.releaseSharedMemory();
+    });
+
+  });
+
+  checkResult<double>(Cview, N);
+//printResult<double>(Cview, N);
 #endif // if RAJA_ENABLE_OPENMP
 
 //----------------------------------------------------------------------------//
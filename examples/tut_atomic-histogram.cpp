@@ -9,6 +9,7 @@
 #include <iostream>
 #include <iomanip>
 #include <cstring>
+#include <vector>
 
 #include "memoryManager.hpp"
 
@@ -24,6 +25,7 @@
  *  RAJA features shown:
  *    - `forall` loop iteration template method
  *    - Atomic add
+ *    - Array sum reducer
  *
  *  If CUDA is enabled, CUDA unified memory is used.
  */
@@ -105,6 +107,24 @@ int main(int RAJA_UNUSED_ARG(argc), char** RAJA_UNUSED_ARG(argv[]))
 
   printBins(bins, M);
 
+//----------------------------------------------------------------------------//
+
+  std::cout << "\n\n Running RAJA OMP binning with array reducer" << std::endl;
+
+  // _rajaomp_reduce_histogram_start
+  RAJA::ReduceSumArray<RAJA::omp_reduce, int> hist(M);
+
+  RAJA::forall<RAJA::omp_parallel_for_exec>(array_range, [=](int i) {
+
+    hist[array[i]] += 1;
+
+  });
+
+  std::vector<int> counts = hist.get();
+  // _rajaomp_reduce_histogram_end
+
+  printBins(counts.data(), M);
+
 #endif
 
 //----------------------------------------------------------------------------//
@@ -299,6 +299,49 @@ int main(int RAJA_UNUSED_ARG(argc), char **RAJA_UNUSED_ARG(argv[]))
   checkResult(vertexvol, vertexvol_ref, N_vert);
 //std::cout << "\n Vertex volumes...\n";
 //printMeshData(vertexvol, N_vert, jvoff); 
+
+//
+// Writing a coloring by hand is only practical for structured meshes.
+// RAJA::buildColorIndexSet colors the elements of any element to vertex
+// connectivity given in CSR form, producing one ListSegment per color.
+// The returned number of colors can be used to decide whether the colored
+// version is worthwhile compared to using atomics.
+//
+  std::cout << "\n Running RAJA OpenMP generated coloring version...\n";
+
+  // _gencolorindexset_vertexsum_start
+  std::vector<RAJA::Index_type> elem2vert_offsets(N_elem*N_elem + 1);
+  std::vector<RAJA::Index_type> elem2vert(4*N_elem*N_elem);
+  for (int ie = 0; ie <= N_elem*N_elem; ++ie) {
+    elem2vert_offsets[ie] = 4*ie;
+  }
+  for (int k = 0; k < 4*N_elem*N_elem; ++k) {
+    elem2vert[k] = elem2vert_map[k];
+  }
+
+  RAJA::TypedIndexSet<RAJA::ListSegment> gencolorset;
+
+  int num_colors = RAJA::buildColorIndexSet(gencolorset,
+                                            host_res,
+                                            elem2vert_offsets.data(),
+                                            elem2vert.data(),
+                                            N_elem*N_elem,
+                                            N_vert*N_vert);
+  // _gencolorindexset_vertexsum_end
+
+  std::cout << "\t (" << num_colors << " colors)\n";
+
+  std::memset(vertexvol, 0, N_vert*N_vert * sizeof(double));
+
+  RAJA::forall<EXEC_POL3>(gencolorset, [=](RAJA::Index_type ie) {
+    int* iv = &(elem2vert_map[4*ie]);
+    vertexvol[ iv[0] ] += elemvol[ie] / 4.0 ;
+    vertexvol[ iv[1] ] += elemvol[ie] / 4.0 ;
+    vertexvol[ iv[2] ] += elemvol[ie] / 4.0 ;
+    vertexvol[ iv[3] ] += elemvol[ie] / 4.0 ;
+  });
+
+  checkResult(vertexvol, vertexvol_ref, N_vert);
 #endif
 
 //----------------------------------------------------------------------------//
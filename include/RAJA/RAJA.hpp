@@ -61,10 +61,20 @@
 //
 #include "RAJA/policy/simd.hpp"
 
+//
+// Explicit SIMD registers and the vector_exec policy.
+//
+#include "RAJA/pattern/register.hpp"
+#include "RAJA/policy/vector.hpp"
+
 #if defined(RAJA_ENABLE_TBB)
 #include "RAJA/policy/tbb.hpp"
 #endif
 
+#if defined(RAJA_ENABLE_THREAD_TEAM)
+#include "RAJA/policy/thread_team.hpp"
+#endif
+
 #if defined(RAJA_ENABLE_CUDA)
 #include "RAJA/policy/cuda.hpp"
 #endif
@@ -81,6 +91,11 @@
 #endif
 #endif
 
+//
+// Asynchronous host launches forward to the host policies above.
+//
+#include "RAJA/policy/host_async.hpp"
+
 #include "RAJA/index/IndexSet.hpp"
 
 //
@@ -97,6 +112,7 @@
 #include "RAJA/pattern/region.hpp"
 
 #include "RAJA/policy/MultiPolicy.hpp"
+#include "RAJA/policy/TuningSelector.hpp"
 
 
 //
@@ -108,6 +124,11 @@
 #include "RAJA/util/StaticLayout.hpp"
 #include "RAJA/util/View.hpp"
 
+//
+// Allocation of arrays placed by first-touch
+//
+#include "RAJA/util/first_touch.hpp"
+
 
 //
 // View for sequences of objects
@@ -174,7 +195,7 @@
 
 #include "RAJA/pattern/scan.hpp"
 
-#if defined(RAJA_ENABLE_RUNTIME_PLUGINS)
+#if defined(RAJA_ENABLE_RUNTIME_PLUGINS) || defined(RAJA_ENABLE_PROFILING_PLUGIN)
 #include "RAJA/util/PluginLinker.hpp"
 #endif
 
@@ -23,13 +23,19 @@
 #include "RAJA/index/ListSegment.hpp"
 #include "RAJA/index/RangeSegment.hpp"
 
+#include <new>
+#include <vector>
+
+#include "RAJA/internal/DepGraphNode.hpp"
 #include "RAJA/internal/Iterators.hpp"
+#include "RAJA/internal/MemUtils_CPU.hpp"
 #include "RAJA/internal/RAJAVec.hpp"
 
 #include "RAJA/policy/PolicyBase.hpp"
 
 #include "RAJA/util/Operators.hpp"
 #include "RAJA/util/concepts.hpp"
+#include "RAJA/util/macros.hpp"
 
 namespace RAJA
 {
@@ -109,6 +115,8 @@ public:
     }
     // mark all as not owned by us
     owner.resize(num, 0);
+    m_seg_interval_begin = c.m_seg_interval_begin;
+    m_seg_interval_end = c.m_seg_interval_end;
   }
 
   //! Copy-assignment operator for index set
@@ -142,6 +150,8 @@ public:
     using std::swap;
     swap(data, other.data);
     swap(owner, other.owner);
+    swap(m_seg_interval_begin, other.m_seg_interval_begin);
+    swap(m_seg_interval_end, other.m_seg_interval_end);
   }
 
   ///
@@ -491,6 +501,10 @@ public:
   //! Set [begin, end) interval of segments identified by interval_id
   void setSegmentInterval(size_t interval_id, int begin, int end)
   {
+    if (interval_id >= m_seg_interval_begin.size()) {
+      m_seg_interval_begin.resize(interval_id + 1, 0);
+      m_seg_interval_end.resize(interval_id + 1, 0);
+    }
     m_seg_interval_begin[interval_id] = begin;
     m_seg_interval_end[interval_id] = end;
   }
@@ -595,20 +609,32 @@ public:
   using value_type = RAJA::Index_type;
 
   //! create empty TypedIndexSet
-  RAJA_INLINE TypedIndexSet() : m_len(0) {}
+  RAJA_INLINE TypedIndexSet()
+      : m_len(0),
+        m_dep_graph(nullptr),
+        m_num_dep_graph_nodes(0),
+        m_dep_graph_set(false)
+  {
+  }
 
-  //! dtor cleans up segements that we own (none)
+  //! dtor cleans up segements that we own (none) and dependency graph
   RAJA_INLINE
-  ~TypedIndexSet() {}
+  ~TypedIndexSet() { freeDependencyGraph(); }
 
   //! Copy-constructor.
   RAJA_INLINE
   TypedIndexSet(TypedIndexSet const &c)
+      : m_dep_graph(nullptr), m_num_dep_graph_nodes(0), m_dep_graph_set(false)
   {
     segment_types = c.segment_types;
     segment_offsets = c.segment_offsets;
     segment_icounts = c.segment_icounts;
     m_len = c.m_len;
+
+    if (c.m_num_dep_graph_nodes > 0) {
+      allocateDependencyGraph(c.m_num_dep_graph_nodes, c.m_dep_graph);
+      m_dep_graph_set = c.m_dep_graph_set;
+    }
   }
 
   //! Swap function for copy-and-swap idiom (deep copy).
@@ -619,6 +645,96 @@ public:
     swap(segment_offsets, other.segment_offsets);
     swap(segment_icounts, other.segment_icounts);
     swap(m_len, other.m_len);
+    swap(m_dep_graph, other.m_dep_graph);
+    swap(m_num_dep_graph_nodes, other.m_num_dep_graph_nodes);
+    swap(m_dep_graph_set, other.m_dep_graph_set);
+  }
+
+  ///
+  /// Allocate one dependency graph node per segment currently in the
+  /// index set, discarding any existing graph. Node i describes segment i,
+  /// or interval i when used with omp_taskgraph_interval_segit.
+  ///
+  void initDependencyGraph() { initDependencyGraph(segment_types.size()); }
+
+  //! Allocate num_nodes default dependency graph nodes.
+  void initDependencyGraph(size_t num_nodes)
+  {
+    freeDependencyGraph();
+    allocateDependencyGraph(num_nodes, nullptr);
+  }
+
+  //! Return true if a finalized dependency graph is attached.
+  bool dependencyGraphSet() const { return m_dep_graph_set; }
+
+  //! Return the number of dependency graph nodes.
+  size_t getNumDepGraphNodes() const { return m_num_dep_graph_nodes; }
+
+  //! Return pointer to dependency graph node i.
+  DepGraphNode *getDepGraphNode(size_t i) const { return &m_dep_graph[i]; }
+
+  ///
+  /// Finish building the dependency graph once all forward dependencies
+  /// have been added with numDepTasks() and depTaskNum().
+  ///
+  /// Sets each node's semaphore reload value to its number of incoming
+  /// edges, resets the semaphores, and checks that the graph is acyclic
+  /// so executors can never deadlock waiting on it.
+  ///
+  void finalizeDependencyGraph()
+  {
+    const int num_nodes = static_cast<int>(m_num_dep_graph_nodes);
+    std::vector<int> in_degree(num_nodes, 0);
+
+    for (int i = 0; i < num_nodes; ++i) {
+      DepGraphNode &node = m_dep_graph[i];
+      if (node.numDepTasks() < 0 ||
+          node.numDepTasks() > DepGraphNode::_MaxDepTasks_) {
+        RAJA_ABORT_OR_THROW(
+            "TypedIndexSet::finalizeDependencyGraph: invalid number of "
+            "dependent tasks");
+      }
+      for (int ii = 0; ii < node.numDepTasks(); ++ii) {
+        const int dep = node.depTaskNum(ii);
+        if (dep < 0 || dep >= num_nodes) {
+          RAJA_ABORT_OR_THROW(
+              "TypedIndexSet::finalizeDependencyGraph: dependent task out of "
+              "range");
+        }
+        ++in_degree[dep];
+      }
+    }
+
+    for (int i = 0; i < num_nodes; ++i) {
+      m_dep_graph[i].semaphoreReloadValue() = in_degree[i];
+      m_dep_graph[i].reset();
+    }
+
+    // Kahn's algorithm, every node is visited only if there are no cycles
+    std::vector<int> ready;
+    ready.reserve(num_nodes);
+    for (int i = 0; i < num_nodes; ++i) {
+      if (in_degree[i] == 0) ready.push_back(i);
+    }
+    int num_visited = 0;
+    while (!ready.empty()) {
+      const int i = ready.back();
+      ready.pop_back();
+      ++num_visited;
+      DepGraphNode &node = m_dep_graph[i];
+      for (int ii = 0; ii < node.numDepTasks(); ++ii) {
+        if (--in_degree[node.depTaskNum(ii)] == 0) {
+          ready.push_back(node.depTaskNum(ii));
+        }
+      }
+    }
+    if (num_visited != num_nodes) {
+      RAJA_ABORT_OR_THROW(
+          "TypedIndexSet::finalizeDependencyGraph: dependency graph has a "
+          "cycle");
+    }
+
+    m_dep_graph_set = true;
   }
 
 protected:
@@ -754,6 +870,52 @@ private:
 
   //! Total length of all TypedIndexSet segments.
   Index_type m_len;
+
+  //! Allocate num_nodes dependency graph nodes, copied from src if not null
+  void allocateDependencyGraph(size_t num_nodes, DepGraphNode const *src)
+  {
+    m_num_dep_graph_nodes = 0;
+    m_dep_graph_set = false;
+    if (num_nodes == 0) {
+      m_dep_graph = nullptr;
+      return;
+    }
+    m_dep_graph = RAJA::allocate_aligned_type<DepGraphNode>(
+        alignof(DepGraphNode), num_nodes * sizeof(DepGraphNode));
+    if (m_dep_graph == nullptr) {
+      RAJA_ABORT_OR_THROW(
+          "TypedIndexSet: failed to allocate dependency graph");
+    }
+    for (size_t i = 0; i < num_nodes; ++i) {
+      if (src) {
+        new (&m_dep_graph[i]) DepGraphNode(src[i]);
+      } else {
+        new (&m_dep_graph[i]) DepGraphNode();
+      }
+    }
+    m_num_dep_graph_nodes = num_nodes;
+  }
+
+  void freeDependencyGraph()
+  {
+    if (m_dep_graph) {
+      RAJA::FreeAlignedType<DepGraphNode, size_t> deleter;
+      deleter.size = m_num_dep_graph_nodes;
+      deleter(m_dep_graph);
+    }
+    m_dep_graph = nullptr;
+    m_num_dep_graph_nodes = 0;
+    m_dep_graph_set = false;
+  }
+
+  //! Dependency graph, one node per task
+  DepGraphNode *m_dep_graph;
+
+  //! Number of nodes in m_dep_graph
+  size_t m_num_dep_graph_nodes;
+
+  //! True once finalizeDependencyGraph has been called
+  bool m_dep_graph_set;
 };
 
 
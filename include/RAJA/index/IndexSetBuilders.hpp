@@ -61,6 +61,42 @@ void RAJASHAREDDLL_API buildIndexSetAligned(
     RAJA::Index_type range_min_length,
     RAJA::Index_type range_align);
 
+/*!
+ ******************************************************************************
+ *
+ * \brief Generate an index set with Range, RangeStride, and List segments
+ *        from given array of indices, reordered for locality.
+ *
+ *        The indices are sorted and duplicates are removed, so the index set
+ *        visits each index once in increasing order. Runs of consecutive
+ *        indices become Range segments and runs of indices with a constant
+ *        stride become RangeStride segments; the indices left between runs
+ *        are gathered into List segments.
+ *
+ *        Since the index order changes, this is only valid for loops whose
+ *        iterations are independent of each other.
+ *
+ *  \param iset reference to index set generated with range, range stride,
+ *         and list segments. Method assumes index set is empty (no segments).
+ *  \param work_res camp resource object that identifies the memory space in
+ *         which list segment index data will live (passed to list segment
+ *         ctor).
+ *  \param indices_in pointer to start of input array of indices.
+ *  \param length size of input index array.
+ *  \param range_min_length min length of any range or range stride segment
+ *         in index set, shorter runs are left in list segments.
+ *
+ ******************************************************************************
+ */
+void RAJASHAREDDLL_API buildIndexSetStructured(
+    RAJA::TypedIndexSet<RAJA::RangeSegment,
+                        RAJA::RangeStrideSegment,
+                        RAJA::ListSegment>& iset,
+    camp::resources::Resource work_res,
+    const RAJA::Index_type* const indices_in,
+    RAJA::Index_type length,
+    RAJA::Index_type range_min_length);
+
 
 ////////////////////////////////////////////////////////////////////////////////
 ////////////////////////////////////////////////////////////////////////////////
@@ -83,6 +119,8 @@ void RAJASHAREDDLL_API buildIndexSetAligned(
  *
  *        The method chunks a fastDim x midDim x slowDim mesh into blocks that 
  *        can be dependency-scheduled, removing need for lock constructs.
+ *        For 3d meshes the segment dependency graph is attached to the
+ *        index set, so it can be executed with omp_taskgraph_segit.
  *
  *  \param iset reference to index set generated with range segments.
  *         Method assumes index set is empty (no segments). 
@@ -126,6 +164,43 @@ void buildLockFreeColorIndexset(
     RAJA::Index_type* elemPermutation = nullptr,
     RAJA::Index_type* ielemPermutation = nullptr);
 
+/*!
+ ******************************************************************************
+ *
+ * \brief Generate a "color" index set containing list segments from a
+ *        general element to node connectivity.
+ *
+ *        Elements are colored so that no two elements of the same color
+ *        share a node, using a parallel Jones-Plassmann coloring. Each color
+ *        becomes one list segment with its elements in increasing order, so
+ *        each segment can be executed in parallel without atomics when
+ *        elements scatter to their nodes, while the segments are executed
+ *        one after another.
+ *
+ * \param iset reference to index set generated. Method assumes index set
+ *        is empty (no segments).
+ * \param work_res camp resource object that identifies the memory space in
+ *        which list segment index data will live (passed to list segment
+ *        ctor).
+ * \param elemToNodeOffsets CSR offsets, the nodes of element i are
+ *        elemToNode[elemToNodeOffsets[i]] up to
+ *        elemToNode[elemToNodeOffsets[i+1]].
+ * \param elemToNode CSR node indices of the elements.
+ * \param numElem number of elements.
+ * \param numNode number of nodes, every node index must be less.
+ *
+ * \return number of colors, which is the number of segments generated.
+ *
+ ******************************************************************************
+ */
+int RAJASHAREDDLL_API buildColorIndexSet(
+    RAJA::TypedIndexSet<RAJA::ListSegment>& iset,
+    camp::resources::Resource work_res,
+    RAJA::Index_type const* elemToNodeOffsets,
+    RAJA::Index_type const* elemToNode,
+    RAJA::Index_type numElem,
+    RAJA::Index_type numNode);
+
 }  // namespace RAJA
 
 #endif  // closing endif for header file include guard
@@ -60,6 +60,30 @@ public:
   {
   }
 
+  ///
+  /// Copy ctor copies dependencies and the current semaphore value.
+  ///
+  DepGraphNode(DepGraphNode const& other)
+      : m_num_dep_tasks(other.m_num_dep_tasks),
+        m_semaphore_reload_value(other.m_semaphore_reload_value),
+        m_semaphore_value(other.m_semaphore_value.load())
+  {
+    for (int ii = 0; ii < m_num_dep_tasks; ++ii) {
+      m_dep_task[ii] = other.m_dep_task[ii];
+    }
+  }
+
+  DepGraphNode& operator=(DepGraphNode const& other)
+  {
+    m_num_dep_tasks = other.m_num_dep_tasks;
+    for (int ii = 0; ii < m_num_dep_tasks; ++ii) {
+      m_dep_task[ii] = other.m_dep_task[ii];
+    }
+    m_semaphore_reload_value = other.m_semaphore_reload_value;
+    m_semaphore_value.store(other.m_semaphore_value.load());
+    return *this;
+  }
+
   ///
   /// Get/set semaphore value; i.e., the current number of (unsatisfied)
   /// dependencies that must be satisfied before this task can execute.
@@ -78,13 +102,18 @@ public:
   void reset() { m_semaphore_value.store(m_semaphore_reload_value); }
 
   ///
-  /// Satisfy one incoming dependency
+  /// Satisfy one incoming dependency, returns true if this satisfied the
+  /// last one so the task is ready to execute
   ///
-  void satisfyOne()
+  bool satisfyOne()
   {
-    if (m_semaphore_value > 0) {
-      --m_semaphore_value;
+    int value = m_semaphore_value.load();
+    while (value > 0) {
+      if (m_semaphore_value.compare_exchange_weak(value, value - 1)) {
+        return value == 1;
+      }
     }
+    return false;
   }
 
   ///
@@ -18,6 +18,11 @@
 #ifndef RAJA_PATTERN_DETAIL_REDUCE_HPP
 #define RAJA_PATTERN_DETAIL_REDUCE_HPP
 
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+#include "RAJA/util/ExactSum.hpp"
 #include "RAJA/util/Operators.hpp"
 #include "RAJA/util/types.hpp"
 
@@ -41,6 +46,17 @@
     using Base::Base;                                                    \
   };
 
+#define RAJA_DECLARE_ARRAY_REDUCER(OP, POL, COMBINER, ATOMIC_POL)         \
+  template <typename T>                                                   \
+  class Reduce##OP<POL, T>                                                \
+      : public reduce::detail::BaseReduce##OP<T, COMBINER, ATOMIC_POL>    \
+  {                                                                       \
+  public:                                                                 \
+    using Base = reduce::detail::BaseReduce##OP<T, COMBINER, ATOMIC_POL>; \
+    using Base::Base;                                                     \
+  };
+
+// the policy headers expanding this include RAJA/policy/atomic_builtin.hpp
 #define RAJA_DECLARE_ALL_REDUCERS(POL, COMBINER)       \
   RAJA_DECLARE_REDUCER(Sum, POL, COMBINER)             \
   RAJA_DECLARE_REDUCER(Min, POL, COMBINER)             \
@@ -48,11 +64,23 @@
   RAJA_DECLARE_INDEX_REDUCER(MinLoc, POL, COMBINER)    \
   RAJA_DECLARE_INDEX_REDUCER(MaxLoc, POL, COMBINER)    \
   RAJA_DECLARE_REDUCER(BitOr, POL, COMBINER)           \
-  RAJA_DECLARE_REDUCER(BitAnd, POL, COMBINER)
+  RAJA_DECLARE_REDUCER(BitAnd, POL, COMBINER)          \
+  RAJA_DECLARE_REDUCER(ReproSum, POL, COMBINER)        \
+  RAJA_DECLARE_ARRAY_REDUCER(SumArray, POL, COMBINER, RAJA::builtin_atomic)
 
 namespace RAJA
 {
 
+//! how array reducers combine values into their bins
+enum class ReduceArrayStrategy {
+  //! privatized for small numbers of bins, atomic otherwise
+  automatic,
+  //! each thread sums into its own copy of the bins
+  privatized,
+  //! all threads add into one set of bins with atomics
+  atomic
+};
+
 namespace reduce
 {
 
@@ -103,6 +131,17 @@ struct and_bit : detail::op_adapter<T, RAJA::operators::bit_and> {
 #pragma omp end declare target
 #endif
 
+//! combines accumulator types, such as ExactSum, that implement +=
+template <typename Accumulator>
+struct accumulate {
+  static Accumulator identity() { return Accumulator(); }
+
+  RAJA_INLINE void operator()(Accumulator &val, const Accumulator &v) const
+  {
+    val += v;
+  }
+};
+
 namespace detail
 {
 
@@ -121,6 +160,91 @@ struct DefaultLoc<T, true>
   RAJA_HOST_DEVICE constexpr T value() const { return -1; }
 };
 
+/*!
+ * Bins of an array sum reduction.
+ *
+ * Privatized bins are held by each copy and summed when copies are
+ * combined. Shared bins are held once, by all copies of a reducer, and
+ * updated with the atomicAdd of AtomicPolicy, which is found by argument
+ * dependent lookup where the reducer is declared for an execution policy.
+ */
+template <typename T, typename AtomicPolicy>
+class SumArray
+{
+  std::vector<T> m_bins;
+  std::shared_ptr<std::vector<T>> m_shared;
+  T* m_shared_data = nullptr;
+
+public:
+  SumArray() = default;
+
+  static SumArray make(size_t num_bins, T init_val, bool shared)
+  {
+    SumArray arr;
+    if (shared) {
+      arr.m_shared = std::make_shared<std::vector<T>>(num_bins, init_val);
+      arr.m_shared_data = arr.m_shared->data();
+    } else {
+      arr.m_bins.assign(num_bins, init_val);
+    }
+    return arr;
+  }
+
+  //! an empty array that combines into the same shared bins
+  SumArray identity() const
+  {
+    SumArray arr;
+    arr.m_bins.assign(m_bins.size(), T());
+    arr.m_shared = m_shared;
+    arr.m_shared_data = m_shared_data;
+    return arr;
+  }
+
+  RAJA_INLINE void add(size_t bin, T val)
+  {
+    if (m_shared_data) {
+      atomicAdd(AtomicPolicy{}, m_shared_data + bin, val);
+    } else {
+      m_bins[bin] += val;
+    }
+  }
+
+  SumArray& operator+=(const SumArray& other)
+  {
+    if (m_bins.size() < other.m_bins.size()) {
+      m_bins.resize(other.m_bins.size(), T());
+    }
+    for (size_t i = 0; i < other.m_bins.size(); ++i) {
+      m_bins[i] += other.m_bins[i];
+    }
+    if (!m_shared) {
+      m_shared = other.m_shared;
+      m_shared_data = other.m_shared_data;
+    }
+    return *this;
+  }
+
+  //! the sum in each bin
+  std::vector<T> values() const
+  {
+    std::vector<T> res = m_shared ? *m_shared : std::vector<T>();
+    if (res.size() < m_bins.size()) {
+      res.resize(m_bins.size(), T());
+    }
+    for (size_t i = 0; i < m_bins.size(); ++i) {
+      res[i] += m_bins[i];
+    }
+    return res;
+  }
+
+  bool operator==(const SumArray& other) const
+  {
+    return m_shared == other.m_shared && m_bins == other.m_bins;
+  }
+
+  bool operator!=(const SumArray& other) const { return !(*this == other); }
+};
+
 template <typename T, typename IndexType, bool doing_min = true>
 class ValueLoc
 {
@@ -174,6 +298,17 @@ namespace reduce
 namespace detail
 {
 
+/*!
+ * Counter of host reducer copies made by the calling thread, or nullptr.
+ * It is only set while a loop policy copies a loop body to find out whether
+ * the body captures reducers; other copies only test it.
+ */
+inline unsigned long *&reducer_copy_probe()
+{
+  static thread_local unsigned long *probe = nullptr;
+  return probe;
+}
+
 template <typename T,
           template <typename>
           class Reduce_,
@@ -211,10 +346,17 @@ public:
   //! prohibit compiler-generated copy assignment
   BaseReduce &operator=(const BaseReduce &) = delete;
 
-  //! compiler-generated copy constructor
+  //! copy constructor, counts the copy if a reducer_copy_probe is set
   RAJA_SUPPRESS_HD_WARN
   RAJA_HOST_DEVICE
-  BaseReduce(const BaseReduce &copy) : c(copy.c) {}
+  BaseReduce(const BaseReduce &copy) : c(copy.c)
+  {
+#if !defined(RAJA_DEVICE_CODE)
+    if (unsigned long *probe = reducer_copy_probe()) {
+      ++*probe;
+    }
+#endif
+  }
 
   //! compiler-generated move constructor
   RAJA_SUPPRESS_HD_WARN
@@ -427,6 +569,141 @@ public:
   }
 };
 
+/*!
+ **************************************************************************
+ *
+ * \brief  Reproducible sum reducer class template for host execution.
+ *
+ *         Values are summed exactly with an ExactSum accumulator so the
+ *         result does not depend on the number of threads or the order in
+ *         which partial sums are combined.
+ *
+ **************************************************************************
+ */
+template <typename T, template <typename, typename> class Combiner>
+class BaseReduceReproSum
+    : public BaseReduce<ExactSum<T>, RAJA::reduce::accumulate, Combiner>
+{
+public:
+  using Base = BaseReduce<ExactSum<T>, RAJA::reduce::accumulate, Combiner>;
+
+  BaseReduceReproSum() : Base() {}
+
+  BaseReduceReproSum(T init_val) : Base(ExactSum<T>(init_val)) {}
+
+  void reset(T init_val) { Base::reset(ExactSum<T>(init_val)); }
+
+  //! reducer function; updates the current instance's state
+  const BaseReduceReproSum &operator+=(T rhs) const
+  {
+    this->local() += rhs;
+    return *this;
+  }
+
+  //! Get the calculated reduced value
+  T get() const { return Base::get().value(); }
+
+  //! Get the calculated reduced value
+  operator T() const { return get(); }
+};
+
+/*!
+ **************************************************************************
+ *
+ * \brief  Array sum reducer class template for host execution.
+ *
+ *         Sums values into a fixed number of bins. With few bins every
+ *         thread sums into its own copy of the bins, which are combined by
+ *         the policy's combiner. With many bins, where privatized copies
+ *         would not fit in cache, all threads add into one set of bins with
+ *         atomics.
+ *
+ **************************************************************************
+ */
+template <typename T,
+          template <typename, typename> class Combiner,
+          typename AtomicPolicy>
+class BaseReduceSumArray
+    : public BaseReduce<SumArray<T, AtomicPolicy>,
+                        RAJA::reduce::accumulate,
+                        Combiner>
+{
+  using Bins = SumArray<T, AtomicPolicy>;
+
+public:
+  using Base = BaseReduce<Bins, RAJA::reduce::accumulate, Combiner>;
+
+  //! largest number of bins privatized by ReduceArrayStrategy::automatic
+  static constexpr size_t max_privatized_bins = 4096;
+
+  //! reference to a bin that adds into the bin with +=
+  class bin_ref
+  {
+    Bins* m_arr;
+    size_t m_bin;
+
+  public:
+    bin_ref(Bins* arr, size_t bin) : m_arr(arr), m_bin(bin) {}
+
+    const bin_ref& operator+=(T rhs) const
+    {
+      m_arr->add(m_bin, rhs);
+      return *this;
+    }
+  };
+
+  BaseReduceSumArray(size_t num_bins,
+                     T init_val = T(),
+                     ReduceArrayStrategy strategy =
+                         ReduceArrayStrategy::automatic)
+      : BaseReduceSumArray(num_bins,
+                           use_shared(num_bins, strategy),
+                           Bins::make(num_bins,
+                                             init_val,
+                                             use_shared(num_bins, strategy)))
+  {
+  }
+
+  void reset(T init_val = T())
+  {
+    Bins init = Bins::make(m_num_bins, init_val, m_shared);
+    Base::reset(init, init.identity());
+  }
+
+  size_t size() const { return m_num_bins; }
+
+  //! reducer function; adds rhs into bin
+  const BaseReduceSumArray& add(size_t bin, T rhs) const
+  {
+    this->local().add(bin, rhs);
+    return *this;
+  }
+
+  bin_ref operator[](size_t bin) const { return bin_ref(&this->local(), bin); }
+
+  //! Get the calculated reduced values
+  std::vector<T> get() const { return Base::get().values(); }
+
+  //! Get the calculated reduced value of bin
+  T get(size_t bin) const { return get()[bin]; }
+
+private:
+  size_t m_num_bins;
+  bool m_shared;
+
+  BaseReduceSumArray(size_t num_bins, bool shared, Bins init)
+      : Base(init, init.identity()), m_num_bins(num_bins), m_shared(shared)
+  {
+  }
+
+  static bool use_shared(size_t num_bins, ReduceArrayStrategy strategy)
+  {
+    return strategy == ReduceArrayStrategy::atomic ||
+           (strategy == ReduceArrayStrategy::automatic &&
+            num_bins > max_privatized_bins);
+  }
+};
+
 /*!
  **************************************************************************
  *
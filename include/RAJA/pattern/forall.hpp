@@ -132,6 +132,16 @@ struct CallForallIcount {
 
   const int start;
 };
+
+/*!
+ * Traversal of the segments of an index set for
+ * ExecPolicy<SegmentIterPolicy, SegmentExecPolicy>. The primary template
+ * iterates over segment ids with SegmentIterPolicy and runs each segment
+ * with SegmentExecPolicy, segment iteration policies that divide the work
+ * differently specialize it.
+ */
+template <typename SegmentIterPolicy>
+struct IndexSetForall;
 }  // namespace detail
 
 /*!
@@ -217,16 +227,8 @@ RAJA_INLINE resources::EventProxy<Res> forall_Icount(Res r,
                                                 const TypedIndexSet<SegmentTypes...>& iset,
                                                 LoopBody loop_body)
 {
-  // no need for icount variant here
-  auto segIterRes = resources::get_resource<SegmentIterPolicy>::type::get_default();
-  wrap::forall(segIterRes, SegmentIterPolicy(), iset, [=, &r](int segID) {
-    iset.segmentCall(segID,
-                     detail::CallForallIcount(iset.getStartingIcount(segID)),
-                     SegmentExecPolicy(),
-                     loop_body,
-                     r);
-  });
-  return RAJA::resources::EventProxy<Res>(r);
+  return detail::IndexSetForall<SegmentIterPolicy>::exec_icount(
+      r, SegmentExecPolicy(), iset, loop_body);
 }
 
 template <typename Res,
@@ -240,11 +242,8 @@ RAJA_INLINE resources::EventProxy<Res> forall(Res r,
                                          const TypedIndexSet<SegmentTypes...>& iset,
                                          LoopBody loop_body)
 {
-  auto segIterRes = resources::get_resource<SegmentIterPolicy>::type::get_default();
-  wrap::forall(segIterRes, SegmentIterPolicy(), iset, [=, &r](int segID) {
-    iset.segmentCall(segID, detail::CallForall{}, SegmentExecPolicy(), loop_body, r);
-  });
-  return RAJA::resources::EventProxy<Res>(r);
+  return detail::IndexSetForall<SegmentIterPolicy>::exec(
+      r, SegmentExecPolicy(), iset, loop_body);
 }
 
 }  // end namespace wrap
@@ -281,7 +280,9 @@ RAJA_INLINE resources::EventProxy<Res> forall_Icount(ExecutionPolicy&& p,
                 "Expected a TypedIndexSet but did not get one. Are you using "
                 "a TypedIndexSet policy by mistake?");
 
-  util::PluginContext context{util::make_context<camp::decay<ExecutionPolicy>>()};
+  util::PluginContext context{util::make_context<camp::decay<ExecutionPolicy>,
+                                                 camp::decay<LoopBody>>(
+      c.getLength(), r)};
   util::callPreCapturePlugins(context);
 
   using RAJA::util::trigger_updates_before;
@@ -331,7 +332,9 @@ forall(ExecutionPolicy&& p, Res r, IdxSet&& c, LoopBody&& loop_body)
                 "Expected a TypedIndexSet but did not get one. Are you using "
                 "a TypedIndexSet policy by mistake?");
 
-  util::PluginContext context{util::make_context<camp::decay<ExecutionPolicy>>()};
+  util::PluginContext context{util::make_context<camp::decay<ExecutionPolicy>,
+                                                 camp::decay<LoopBody>>(
+      c.getLength(), r)};
   util::callPreCapturePlugins(context);
 
   using RAJA::util::trigger_updates_before;
@@ -416,7 +419,12 @@ forall_Icount(ExecutionPolicy&& p,
   static_assert(type_traits::is_random_access_range<Container>::value,
                 "Container does not model RandomAccessIterator");
 
-  util::PluginContext context{util::make_context<camp::decay<ExecutionPolicy>>()};
+  using std::begin;
+  using std::distance;
+  using std::end;
+  util::PluginContext context{util::make_context<camp::decay<ExecutionPolicy>,
+                                                 camp::decay<LoopBody>>(
+      static_cast<size_t>(distance(begin(c), end(c))), r)};
   util::callPreCapturePlugins(context);
 
   using RAJA::util::trigger_updates_before;
@@ -478,7 +486,12 @@ forall(ExecutionPolicy&& p, Res r, Container&& c, LoopBody&& loop_body)
   static_assert(type_traits::is_random_access_range<Container>::value,
                 "Container does not model RandomAccessIterator");
 
-  util::PluginContext context{util::make_context<camp::decay<ExecutionPolicy>>()};
+  using std::begin;
+  using std::distance;
+  using std::end;
+  util::PluginContext context{util::make_context<camp::decay<ExecutionPolicy>,
+                                                 camp::decay<LoopBody>>(
+      static_cast<size_t>(distance(begin(c), end(c))), r)};
   util::callPreCapturePlugins(context);
 
   using RAJA::util::trigger_updates_before;
@@ -587,6 +600,48 @@ RAJA_INLINE camp::resources::EventProxy<Res> CallForallIcount::operator()(T cons
   return wrap::forall_Icount(r, ExecutionPolicy(), segment, start, body);
 }
 
+template <typename SegmentIterPolicy>
+struct IndexSetForall {
+  template <typename Res,
+            typename SegmentExecPolicy,
+            typename LoopBody,
+            typename... SegmentTypes>
+  static RAJA_INLINE resources::EventProxy<Res> exec(
+      Res r,
+      SegmentExecPolicy,
+      const TypedIndexSet<SegmentTypes...>& iset,
+      LoopBody loop_body)
+  {
+    auto segIterRes = resources::get_resource<SegmentIterPolicy>::type::get_default();
+    wrap::forall(segIterRes, SegmentIterPolicy(), iset, [=, &r](int segID) {
+      iset.segmentCall(segID, CallForall{}, SegmentExecPolicy(), loop_body, r);
+    });
+    return RAJA::resources::EventProxy<Res>(r);
+  }
+
+  template <typename Res,
+            typename SegmentExecPolicy,
+            typename LoopBody,
+            typename... SegmentTypes>
+  static RAJA_INLINE resources::EventProxy<Res> exec_icount(
+      Res r,
+      SegmentExecPolicy,
+      const TypedIndexSet<SegmentTypes...>& iset,
+      LoopBody loop_body)
+  {
+    // no need for icount variant here
+    auto segIterRes = resources::get_resource<SegmentIterPolicy>::type::get_default();
+    wrap::forall(segIterRes, SegmentIterPolicy(), iset, [=, &r](int segID) {
+      iset.segmentCall(segID,
+                       CallForallIcount(iset.getStartingIcount(segID)),
+                       SegmentExecPolicy(),
+                       loop_body,
+                       r);
+    });
+    return RAJA::resources::EventProxy<Res>(r);
+  }
+};
+
 }  // namespace detail
 
 }  // namespace RAJA
@@ -82,6 +82,19 @@ RAJA_INLINE constexpr auto make_wrapped_tuple_impl(Tuple &&t,
               IndexType>{camp::get<I>(std::forward<Tuple>(t)).begin(),
                          camp::get<I>(std::forward<Tuple>(t)).end()}...);
 }
+
+//! number of points in the product of the segments, for the plugins
+template <class Tuple, camp::idx_t... I>
+RAJA_INLINE size_t segment_tuple_size(Tuple const &t, camp::idx_seq<I...>)
+{
+  size_t size = 1;
+  int expand[] = {0,
+                  (size *= static_cast<size_t>(camp::get<I>(t).end() -
+                                               camp::get<I>(t).begin()),
+                   0)...};
+  RAJA_UNUSED_VAR(expand);
+  return size;
+}
 }  // namespace internal
 
 template <class Tuple>
@@ -106,7 +119,15 @@ RAJA_INLINE resources::EventProxy<Resource> kernel_param_resource(SegmentTuple &
                                                                   Resource resource,
                                                                   Bodies &&... bodies)
 {
-  util::PluginContext context{util::make_context<PolicyType>()};
+  util::PluginContext context{
+      util::make_context<PolicyType, camp::list<camp::decay<Bodies>...>>(
+          util::plugins_active()
+              ? internal::segment_tuple_size(
+                    segments,
+                    camp::make_idx_seq_t<
+                        camp::tuple_size<camp::decay<SegmentTuple>>::value>{})
+              : 0,
+          resource)};
 
   // TODO: test that all policy members model the Executor policy concept
   // TODO: add a static_assert for functors which cannot be invoked with
@@ -25,6 +25,8 @@
 
 #include "camp/camp.hpp"
 
+#include "RAJA/index/RangeSegment.hpp"
+#include "RAJA/internal/foldl.hpp"
 #include "RAJA/pattern/kernel/For.hpp"
 #include "RAJA/util/macros.hpp"
 #include "RAJA/util/types.hpp"
@@ -75,6 +77,11 @@ namespace statement
  *
  *  });
  *
+ * On the host the loop over hyperplanes only covers h = 0 ... sum(Ni-1), and
+ * range and range-stride segments S1, S2, ... are sliced for each h to the
+ * iterates that can lie on it, so that the inner loop does not run over the
+ * whole of S1 x S2 x ... for every hyperplane.
+ *
  */
 template <camp::idx_t HpArgumentId,
           typename HpExecPolicy,
@@ -98,6 +105,124 @@ struct HyperplaneInner
 };
 
 
+/*!
+ * Restrict segment to the iterates [begin, begin+length) of full.
+ *
+ * Segments that can not be sliced are left whole, HyperplaneInner still
+ * skips their out of plane iterates.
+ *
+ * \return the offset of the first iterate of segment in full
+ */
+template <typename Segment, typename DiffT>
+RAJA_INLINE DiffT hyperplane_slice(Segment &, Segment const &, DiffT, DiffT)
+{
+  return DiffT(0);
+}
+
+template <typename StorageT, typename SegDiffT, typename DiffT>
+RAJA_INLINE DiffT hyperplane_slice(TypedRangeSegment<StorageT, SegDiffT> &segment,
+                                   TypedRangeSegment<StorageT, SegDiffT> const &full,
+                                   DiffT begin,
+                                   DiffT length)
+{
+  segment = full.slice(StorageT(begin), SegDiffT(length));
+  return begin;
+}
+
+template <typename StorageT, typename SegDiffT, typename DiffT>
+RAJA_INLINE DiffT hyperplane_slice(TypedRangeStrideSegment<StorageT, SegDiffT> &segment,
+                                   TypedRangeStrideSegment<StorageT, SegDiffT> const &full,
+                                   DiffT begin,
+                                   DiffT length)
+{
+  segment = full.slice(StorageT(begin), SegDiffT(length));
+  return begin;
+}
+
+
+/*!
+ * A RAJA::kernel forall_impl wrapper for the loop over hyperplanes.
+ *
+ * For each hyperplane h the inner segments are sliced to the bounding box of
+ * the iterates that lie on h, so the inner loops only run over the iterates
+ * that can be in plane. The offset stored for HpArgumentId is h less the
+ * offsets of the slices, which keeps the value computed by HyperplaneInner
+ * the same as for the unsliced segments.
+ */
+template <camp::idx_t HpArgumentId,
+          typename ArgList,
+          typename Data,
+          typename Types,
+          typename... EnclosedStmts>
+struct HyperplaneWrapper;
+
+template <camp::idx_t HpArgumentId,
+          camp::idx_t... Args,
+          typename Data,
+          typename Types,
+          typename... EnclosedStmts>
+struct HyperplaneWrapper<HpArgumentId,
+                         ArgList<Args...>,
+                         Data,
+                         Types,
+                         EnclosedStmts...>
+    : public GenericWrapper<Data, Types, EnclosedStmts...> {
+
+  using Base = GenericWrapper<Data, Types, EnclosedStmts...>;
+  using data_t = typename Base::data_t;
+  using privatizer = NestedPrivatizer<HyperplaneWrapper>;
+
+  using idx_t =
+      camp::tuple_element_t<HpArgumentId, typename data_t::offset_tuple_t>;
+
+  // unsliced segments
+  typename data_t::segment_tuple_t segments;
+
+  // largest hyperplane, the sum of the last offset of every argument
+  idx_t h_max;
+
+  RAJA_INLINE
+  explicit HyperplaneWrapper(data_t &d)
+      : Base(d),
+        segments(d.segment_tuple),
+        h_max(RAJA::sum<idx_t>(idx_t(segment_length<HpArgumentId>(d) - 1),
+                               idx_t(segment_length<Args>(d) - 1)...))
+  {
+  }
+
+  template <typename InIndexType>
+  RAJA_INLINE void operator()(InIndexType h)
+  {
+    idx_t h_offset = RAJA::sum<idx_t>(slice<Args>(h)...);
+
+    Base::data.template assign_offset<HpArgumentId>(h - h_offset);
+
+    Base::exec();
+  }
+
+private:
+  // slice segment ArgumentId to the offsets that can lie on hyperplane h
+  template <camp::idx_t ArgumentId>
+  RAJA_INLINE idx_t slice(idx_t h)
+  {
+    auto const &full = camp::get<ArgumentId>(segments);
+    idx_t last = idx_t(full.end() - full.begin()) - 1;
+
+    // the other arguments can contribute at most h_max - last to h
+    idx_t begin = h - (h_max - last);
+    if (begin < 0) {
+      begin = 0;
+    }
+    idx_t end = (h < last ? h : last) + 1;
+
+    return hyperplane_slice(camp::get<ArgumentId>(Base::data.segment_tuple),
+                            full,
+                            begin,
+                            idx_t(end - begin));
+  }
+};
+
+
 template <camp::idx_t HpArgumentId,
           typename HpExecPolicy,
           camp::idx_t... Args,
@@ -130,14 +255,21 @@ struct StatementExecutor<statement::Hyperplane<HpArgumentId,
         ArgList<Args...>,
         HyperplaneInner<HpArgumentId, ArgList<Args...>, EnclosedStmts...>>;
 
-    // Create a For-loop wrapper for the outer loop
-    ForWrapper<HpArgumentId, Data, NewTypes, kernel_policy> outer_wrapper(data);
+    // nothing to do if any of the segments is empty
+    bool empty = segment_length<HpArgumentId>(data) <= 0;
+    camp::sink((empty = empty || segment_length<Args>(data) <= 0)...);
+    if (empty) {
+      return;
+    }
+
+    // Create a wrapper for the outer loop, this slices the inner segments
+    // to each hyperplane
+    HyperplaneWrapper<HpArgumentId, ArgList<Args...>, Data, NewTypes,
+                      kernel_policy> outer_wrapper(data);
 
-    // compute manhattan distance of iteration space to determine
-    // as:  hp_len = l0 + l1 + l2 + ...
-    idx_t hp_len = segment_length<HpArgumentId>(data) +
-                   foldl(RAJA::operators::plus<idx_t>(),
-                                 segment_length<Args>(data)...);
+    // hyperplanes are numbered by the manhattan distance of their iterates
+    // from the origin, the last is at:  hp_len-1 = (l0-1) + (l1-1) + ...
+    idx_t hp_len = outer_wrapper.h_max + 1;
 
     /* Execute the outer loop over hyperplanes
      *
@@ -149,6 +281,9 @@ struct StatementExecutor<statement::Hyperplane<HpArgumentId,
     forall_impl(r, HpExecPolicy{},
                 TypedRangeSegment<idx_t>(0, hp_len),
                 outer_wrapper);
+
+    // Set ranges back to original values
+    data.segment_tuple = outer_wrapper.segments;
   }
 };
 
@@ -231,6 +231,65 @@ class ReduceBitOr;
  */
 template <typename REDUCE_POLICY_T, typename T>
 class ReduceBitAnd;
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  Reproducible floating point sum reducer class template.
+ *
+ * The sum is accumulated exactly and rounded once when it is retrieved, so
+ * the result is bitwise identical for any number of threads and any
+ * execution order. Only available for host reduction policies.
+ *
+ * Usage example:
+ *
+ * \verbatim
+
+   Real_ptr data = ...;
+   ReduceReproSum<reduce_policy, Real_type> my_sum(init_val);
+
+   forall<exec_policy>( ..., [=] (Index_type i) {
+      my_sum += data[i];
+   }
+
+   Real_type sum = my_sum.get();
+
+ * \endverbatim
+ *
+ ******************************************************************************
+ */
+template <typename REDUCE_POLICY_T, typename T>
+class ReduceReproSum;
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  Array sum (histogram) reducer class template.
+ *
+ * Sums values into num_bins bins. Only available for host reduction
+ * policies. By default small numbers of bins are privatized per thread and
+ * large numbers of bins are shared and updated with atomics, a
+ * ReduceArrayStrategy may be given to choose explicitly.
+ *
+ * Usage example:
+ *
+ * \verbatim
+
+   Int_ptr bin_of = ...;
+   ReduceSumArray<reduce_policy, int> hist(num_bins);
+
+   forall<exec_policy>( ..., [=] (Index_type i) {
+      hist[bin_of[i]] += 1;
+   }
+
+   std::vector<int> counts = hist.get();
+
+ * \endverbatim
+ *
+ ******************************************************************************
+ */
+template <typename REDUCE_POLICY_T, typename T>
+class ReduceSumArray;
 } //namespace RAJA
 
 
@@ -0,0 +1,35 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file containing the SIMD register types.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-21, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_pattern_register_HPP
+#define RAJA_pattern_register_HPP
+
+#include "RAJA/policy/register/arch.hpp"
+#include "RAJA/pattern/register/Register.hpp"
+
+//
+// Architecture specializations, each is empty unless the compiler
+// targets the architecture.
+//
+#include "RAJA/policy/register/sse.hpp"
+#include "RAJA/policy/register/avx2.hpp"
+#include "RAJA/policy/register/avx512.hpp"
+
+#include "RAJA/pattern/vector/VectorIndex.hpp"
+#include "RAJA/pattern/vector/VectorRef.hpp"
+
+#endif  // closing endif for header file include guard
@@ -0,0 +1,108 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file defining the portable SIMD register type.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-21, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_pattern_register_Register_HPP
+#define RAJA_pattern_register_Register_HPP
+
+#include "RAJA/config.hpp"
+
+#include "RAJA/pattern/register/RegisterBase.hpp"
+#include "RAJA/policy/register/arch.hpp"
+
+#include "camp/camp.hpp"
+
+namespace RAJA
+{
+
+namespace internal
+{
+
+//! Number of lanes of type T in a register of architecture REGISTER_POLICY
+template <typename T, typename REGISTER_POLICY>
+struct RegisterNumElem {
+  static constexpr camp::idx_t value =
+      REGISTER_POLICY::s_bytes / sizeof(T) > 0
+          ? static_cast<camp::idx_t>(REGISTER_POLICY::s_bytes / sizeof(T))
+          : 1;
+};
+
+}  // namespace internal
+
+/*!
+ * \brief SIMD register holding RegisterNumElem lanes of type T.
+ *
+ * This is the portable implementation, it keeps the lanes in an array and
+ * uses the lane by lane operations of RegisterBase, which compilers map to
+ * vector instructions for the fixed lane counts. Specializations for
+ * float and double use intrinsics when the compiler targets
+ * REGISTER_POLICY.
+ *
+ * For example:
+ *
+ *     using reg_t = RAJA::Register<double, RAJA::avx2_register>;
+ *
+ *     reg_t x, y;
+ *     x.load_packed(a + i);
+ *     y.load_strided(b + i * ldb, ldb);
+ *     x.multiply_add(y, reg_t(c)).store_packed(a + i);
+ */
+template <typename T, typename REGISTER_POLICY = default_register>
+class Register
+    : public internal::RegisterBase<
+          Register<T, REGISTER_POLICY>,
+          T,
+          internal::RegisterNumElem<T, REGISTER_POLICY>::value>
+{
+  using base_type = internal::RegisterBase<
+      Register<T, REGISTER_POLICY>,
+      T,
+      internal::RegisterNumElem<T, REGISTER_POLICY>::value>;
+
+public:
+  using register_policy = REGISTER_POLICY;
+  using typename base_type::element_type;
+  using base_type::s_num_elem;
+
+  RAJA_INLINE
+  Register()
+  {
+    for (camp::idx_t i = 0; i < s_num_elem; ++i) {
+      m_value[i] = element_type(0);
+    }
+  }
+
+  //! broadcast value to all lanes
+  RAJA_INLINE
+  Register(element_type value) { base_type::broadcast(value); }
+
+  RAJA_INLINE
+  element_type get(camp::idx_t i) const { return m_value[i]; }
+
+  RAJA_INLINE
+  Register &set(camp::idx_t i, element_type value)
+  {
+    m_value[i] = value;
+    return *this;
+  }
+
+private:
+  element_type m_value[s_num_elem];
+};
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
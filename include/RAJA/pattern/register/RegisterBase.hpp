@@ -0,0 +1,455 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file defining the operations shared by all SIMD register
+ *          types.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-21, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_pattern_register_RegisterBase_HPP
+#define RAJA_pattern_register_RegisterBase_HPP
+
+#include <cstdint>
+
+#include "RAJA/config.hpp"
+
+#include "RAJA/util/macros.hpp"
+
+#include "camp/camp.hpp"
+
+namespace RAJA
+{
+
+namespace internal
+{
+
+/*!
+ * \brief Operations of a SIMD register of NumElem lanes of type T.
+ *
+ * Every operation is implemented here lane by lane with get() and set()
+ * of the Derived register. Registers backed by intrinsics replace the
+ * operations they have instructions for, the rest fall back to these.
+ *
+ * The _n variants of loads, stores and reductions only touch the first n
+ * lanes, loads set the other lanes to zero. Comparisons return a mask_type
+ * with bit i set for lane i.
+ */
+template <typename Derived, typename T, camp::idx_t NumElem>
+class RegisterBase
+{
+public:
+  using self_type = Derived;
+  using element_type = T;
+  using mask_type = uint64_t;
+
+  static constexpr camp::idx_t s_num_elem = NumElem;
+
+  static_assert(NumElem <= 64, "Register has more lanes than mask_type bits");
+
+  //! mask of the first n lanes
+  RAJA_INLINE
+  static constexpr mask_type lane_mask(camp::idx_t n)
+  {
+    return n >= 64 ? ~mask_type(0) : ((mask_type(1) << n) - 1);
+  }
+
+  RAJA_INLINE
+  static constexpr camp::idx_t size() { return NumElem; }
+
+  RAJA_INLINE
+  element_type operator[](camp::idx_t i) const { return self().get(i); }
+
+  RAJA_INLINE
+  self_type &broadcast(element_type value)
+  {
+    for (camp::idx_t i = 0; i < NumElem; ++i) {
+      self().set(i, value);
+    }
+    return self();
+  }
+
+  /*
+   * Loads and stores
+   */
+
+  RAJA_INLINE
+  self_type &load_packed(element_type const *ptr)
+  {
+    for (camp::idx_t i = 0; i < NumElem; ++i) {
+      self().set(i, ptr[i]);
+    }
+    return self();
+  }
+
+  RAJA_INLINE
+  self_type &load_packed_n(element_type const *ptr, camp::idx_t n)
+  {
+    for (camp::idx_t i = 0; i < NumElem; ++i) {
+      self().set(i, i < n ? ptr[i] : element_type(0));
+    }
+    return self();
+  }
+
+  RAJA_INLINE
+  self_type &load_strided(element_type const *ptr, camp::idx_t stride)
+  {
+    for (camp::idx_t i = 0; i < NumElem; ++i) {
+      self().set(i, ptr[i * stride]);
+    }
+    return self();
+  }
+
+  RAJA_INLINE
+  self_type &load_strided_n(element_type const *ptr,
+                            camp::idx_t stride,
+                            camp::idx_t n)
+  {
+    for (camp::idx_t i = 0; i < NumElem; ++i) {
+      self().set(i, i < n ? ptr[i * stride] : element_type(0));
+    }
+    return self();
+  }
+
+  //! lane i gets ptr[offsets[i]]
+  RAJA_INLINE
+  self_type &gather(element_type const *ptr, camp::idx_t const *offsets)
+  {
+    for (camp::idx_t i = 0; i < NumElem; ++i) {
+      self().set(i, ptr[offsets[i]]);
+    }
+    return self();
+  }
+
+  RAJA_INLINE
+  self_type &gather_n(element_type const *ptr,
+                      camp::idx_t const *offsets,
+                      camp::idx_t n)
+  {
+    for (camp::idx_t i = 0; i < NumElem; ++i) {
+      self().set(i, i < n ? ptr[offsets[i]] : element_type(0));
+    }
+    return self();
+  }
+
+  RAJA_INLINE
+  self_type const &store_packed(element_type *ptr) const
+  {
+    for (camp::idx_t i = 0; i < NumElem; ++i) {
+      ptr[i] = self().get(i);
+    }
+    return self();
+  }
+
+  RAJA_INLINE
+  self_type const &store_packed_n(element_type *ptr, camp::idx_t n) const
+  {
+    for (camp::idx_t i = 0; i < n; ++i) {
+      ptr[i] = self().get(i);
+    }
+    return self();
+  }
+
+  RAJA_INLINE
+  self_type const &store_strided(element_type *ptr, camp::idx_t stride) const
+  {
+    for (camp::idx_t i = 0; i < NumElem; ++i) {
+      ptr[i * stride] = self().get(i);
+    }
+    return self();
+  }
+
+  RAJA_INLINE
+  self_type const &store_strided_n(element_type *ptr,
+                                   camp::idx_t stride,
+                                   camp::idx_t n) const
+  {
+    for (camp::idx_t i = 0; i < n; ++i) {
+      ptr[i * stride] = self().get(i);
+    }
+    return self();
+  }
+
+  //! ptr[offsets[i]] gets lane i
+  RAJA_INLINE
+  self_type const &scatter(element_type *ptr, camp::idx_t const *offsets) const
+  {
+    for (camp::idx_t i = 0; i < NumElem; ++i) {
+      ptr[offsets[i]] = self().get(i);
+    }
+    return self();
+  }
+
+  RAJA_INLINE
+  self_type const &scatter_n(element_type *ptr,
+                             camp::idx_t const *offsets,
+                             camp::idx_t n) const
+  {
+    for (camp::idx_t i = 0; i < n; ++i) {
+      ptr[offsets[i]] = self().get(i);
+    }
+    return self();
+  }
+
+  /*
+   * Lane wise arithmetic
+   */
+
+  RAJA_INLINE
+  self_type add(self_type const &b) const
+  {
+    return lane_op(b, [](element_type x, element_type y) { return x + y; });
+  }
+
+  RAJA_INLINE
+  self_type subtract(self_type const &b) const
+  {
+    return lane_op(b, [](element_type x, element_type y) { return x - y; });
+  }
+
+  RAJA_INLINE
+  self_type multiply(self_type const &b) const
+  {
+    return lane_op(b, [](element_type x, element_type y) { return x * y; });
+  }
+
+  RAJA_INLINE
+  self_type divide(self_type const &b) const
+  {
+    return lane_op(b, [](element_type x, element_type y) { return x / y; });
+  }
+
+  //! this * b + c
+  RAJA_INLINE
+  self_type multiply_add(self_type const &b, self_type const &c) const
+  {
+    return self().multiply(b).add(c);
+  }
+
+  //! this * b - c
+  RAJA_INLINE
+  self_type multiply_subtract(self_type const &b, self_type const &c) const
+  {
+    return self().multiply(b).subtract(c);
+  }
+
+  RAJA_INLINE
+  self_type vmin(self_type const &b) const
+  {
+    return lane_op(b, [](element_type x, element_type y) {
+      return y < x ? y : x;
+    });
+  }
+
+  RAJA_INLINE
+  self_type vmax(self_type const &b) const
+  {
+    return lane_op(b, [](element_type x, element_type y) {
+      return x < y ? y : x;
+    });
+  }
+
+  //! lane i is b[i] where bit i of mask is set, and this[i] otherwise
+  RAJA_INLINE
+  self_type blend(self_type const &b, mask_type mask) const
+  {
+    self_type result;
+    for (camp::idx_t i = 0; i < NumElem; ++i) {
+      result.set(i, ((mask >> i) & 1) ? b.get(i) : self().get(i));
+    }
+    return result;
+  }
+
+  /*
+   * Reductions over the lanes
+   */
+
+  RAJA_INLINE
+  element_type sum() const
+  {
+    element_type result = self().get(0);
+    for (camp::idx_t i = 1; i < NumElem; ++i) {
+      result += self().get(i);
+    }
+    return result;
+  }
+
+  RAJA_INLINE
+  element_type max() const { return self().max_n(NumElem); }
+
+  RAJA_INLINE
+  element_type min() const { return self().min_n(NumElem); }
+
+  //! max of the first n > 0 lanes
+  RAJA_INLINE
+  element_type max_n(camp::idx_t n) const
+  {
+    element_type result = self().get(0);
+    for (camp::idx_t i = 1; i < n; ++i) {
+      element_type v = self().get(i);
+      result = result < v ? v : result;
+    }
+    return result;
+  }
+
+  //! min of the first n > 0 lanes
+  RAJA_INLINE
+  element_type min_n(camp::idx_t n) const
+  {
+    element_type result = self().get(0);
+    for (camp::idx_t i = 1; i < n; ++i) {
+      element_type v = self().get(i);
+      result = v < result ? v : result;
+    }
+    return result;
+  }
+
+  RAJA_INLINE
+  element_type dot(self_type const &b) const
+  {
+    return self().multiply(b).sum();
+  }
+
+  /*
+   * Comparisons
+   */
+
+  RAJA_INLINE
+  mask_type cmp_eq(self_type const &b) const
+  {
+    return lane_cmp(b, [](element_type x, element_type y) { return x == y; });
+  }
+
+  RAJA_INLINE
+  mask_type cmp_ne(self_type const &b) const
+  {
+    return lane_cmp(b, [](element_type x, element_type y) { return x != y; });
+  }
+
+  RAJA_INLINE
+  mask_type cmp_lt(self_type const &b) const
+  {
+    return lane_cmp(b, [](element_type x, element_type y) { return x < y; });
+  }
+
+  RAJA_INLINE
+  mask_type cmp_le(self_type const &b) const
+  {
+    return lane_cmp(b, [](element_type x, element_type y) { return x <= y; });
+  }
+
+  RAJA_INLINE
+  mask_type cmp_gt(self_type const &b) const
+  {
+    return lane_cmp(b, [](element_type x, element_type y) { return x > y; });
+  }
+
+  RAJA_INLINE
+  mask_type cmp_ge(self_type const &b) const
+  {
+    return lane_cmp(b, [](element_type x, element_type y) { return x >= y; });
+  }
+
+  /*
+   * Operators, a scalar operand is broadcast to all lanes
+   */
+
+  RAJA_INLINE
+  friend self_type operator+(self_type const &a, self_type const &b)
+  {
+    return a.add(b);
+  }
+
+  RAJA_INLINE
+  friend self_type operator-(self_type const &a, self_type const &b)
+  {
+    return a.subtract(b);
+  }
+
+  RAJA_INLINE
+  friend self_type operator*(self_type const &a, self_type const &b)
+  {
+    return a.multiply(b);
+  }
+
+  RAJA_INLINE
+  friend self_type operator/(self_type const &a, self_type const &b)
+  {
+    return a.divide(b);
+  }
+
+  RAJA_INLINE
+  self_type operator-() const
+  {
+    return self_type(element_type(0)).subtract(self());
+  }
+
+  RAJA_INLINE
+  self_type &operator+=(self_type const &b)
+  {
+    return self() = self().add(b);
+  }
+
+  RAJA_INLINE
+  self_type &operator-=(self_type const &b)
+  {
+    return self() = self().subtract(b);
+  }
+
+  RAJA_INLINE
+  self_type &operator*=(self_type const &b)
+  {
+    return self() = self().multiply(b);
+  }
+
+  RAJA_INLINE
+  self_type &operator/=(self_type const &b)
+  {
+    return self() = self().divide(b);
+  }
+
+private:
+  RAJA_INLINE
+  self_type &self() { return *static_cast<self_type *>(this); }
+
+  RAJA_INLINE
+  self_type const &self() const
+  {
+    return *static_cast<self_type const *>(this);
+  }
+
+  template <typename Op>
+  RAJA_INLINE self_type lane_op(self_type const &b, Op &&op) const
+  {
+    self_type result;
+    for (camp::idx_t i = 0; i < NumElem; ++i) {
+      result.set(i, op(self().get(i), b.get(i)));
+    }
+    return result;
+  }
+
+  template <typename Op>
+  RAJA_INLINE mask_type lane_cmp(self_type const &b, Op &&op) const
+  {
+    mask_type result = 0;
+    for (camp::idx_t i = 0; i < NumElem; ++i) {
+      result |= mask_type(op(self().get(i), b.get(i)) ? 1 : 0) << i;
+    }
+    return result;
+  }
+};
+
+}  // namespace internal
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
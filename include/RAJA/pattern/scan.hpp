@@ -31,6 +31,42 @@
 namespace RAJA
 {
 
+namespace detail
+{
+
+/*!
+ * \brief Segment head predicate for a range of keys; a new segment starts
+ * at each index whose key differs from the previous key.
+ */
+template <typename KeyIter, typename KeyEqual>
+struct scan_key_heads {
+  KeyIter keys;
+  KeyEqual eq;
+
+  template <typename DiffType>
+  RAJA_INLINE bool operator()(DiffType i) const
+  {
+    return i == 0 || !eq(keys[i - 1], keys[i]);
+  }
+};
+
+/*!
+ * \brief Segment head predicate for a range of head flags; a new segment
+ * starts at each index with a non-zero flag.
+ */
+template <typename FlagIter>
+struct scan_flag_heads {
+  FlagIter flags;
+
+  template <typename DiffType>
+  RAJA_INLINE bool operator()(DiffType i) const
+  {
+    return i == 0 || static_cast<bool>(flags[i]);
+  }
+};
+
+}  // end namespace detail
+
 inline namespace policy_by_value_interface
 {
 
@@ -320,6 +356,382 @@ exclusive_scan(ExecPolicy&& p,
       value);
 }
 
+/*!
+******************************************************************************
+*
+* \brief  inclusive scan by key execution pattern
+*
+* \param[in] p Execution policy
+* \param[in] keys Random-Access Container of keys; each run of equal
+*consecutive keys is scanned independently
+* \param[in] in Random-Access Container
+* \param[out] out Random-Access Container for output data
+* \param[in] binop binary function to apply for scan
+* \param[in] keyeq predicate used to compare adjacent keys
+*
+* \note{The range of [begin, end) must be separate from [out, out + (end -
+*begin))}
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename Res,
+          typename KeyContainer,
+          typename InContainer,
+          typename OutContainer,
+          typename Function = operators::plus<RAJA::detail::ContainerVal<InContainer>>,
+          typename KeyEqual = operators::equal_to<RAJA::detail::ContainerVal<KeyContainer>>>
+RAJA_INLINE
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_resource<Res>,
+                      std::is_constructible<camp::resources::Resource, Res>,
+                      type_traits::is_range<KeyContainer>,
+                      type_traits::is_range<InContainer>,
+                      type_traits::is_range<OutContainer>>
+inclusive_scan_by_key(ExecPolicy&& p,
+                      Res r,
+                      KeyContainer&& keys,
+                      InContainer&& in,
+                      OutContainer&& out,
+                      Function binop = Function{},
+                      KeyEqual keyeq = KeyEqual{})
+{
+  using std::begin;
+  using std::end;
+  using T = RAJA::detail::ContainerVal<InContainer>;
+  using R = RAJA::detail::ContainerVal<OutContainer>;
+  static_assert(type_traits::is_binary_function<Function, R, T, R>::value,
+                "Function must model BinaryFunction");
+  static_assert(type_traits::is_random_access_range<KeyContainer>::value,
+                "KeyContainer must model RandomAccessRange");
+  static_assert(type_traits::is_random_access_range<InContainer>::value,
+                "InContainer must model RandomAccessRange");
+  static_assert(type_traits::is_random_access_range<OutContainer>::value,
+                "OutContainer must model RandomAccessRange");
+  if (begin(in) == end(in)) {
+    return resources::EventProxy<Res>(r);
+  }
+  auto heads = RAJA::detail::scan_key_heads<
+      RAJA::detail::ContainerIter<KeyContainer>, KeyEqual>{begin(keys), keyeq};
+  return impl::scan::inclusive_segmented(r, std::forward<ExecPolicy>(p), heads,
+                                         begin(in), end(in), begin(out),
+                                         binop);
+}
+///
+template <typename ExecPolicy,
+          typename KeyContainer,
+          typename InContainer,
+          typename OutContainer,
+          typename Function = operators::plus<RAJA::detail::ContainerVal<InContainer>>,
+          typename KeyEqual = operators::equal_to<RAJA::detail::ContainerVal<KeyContainer>>,
+          typename Res = typename resources::get_resource<ExecPolicy>::type>
+RAJA_INLINE
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_range<KeyContainer>,
+                      concepts::negate<std::is_constructible<camp::resources::Resource, KeyContainer>>,
+                      type_traits::is_range<InContainer>,
+                      type_traits::is_range<OutContainer>>
+inclusive_scan_by_key(ExecPolicy&& p,
+                      KeyContainer&& keys,
+                      InContainer&& in,
+                      OutContainer&& out,
+                      Function binop = Function{},
+                      KeyEqual keyeq = KeyEqual{})
+{
+  auto r = Res::get_default();
+  return ::RAJA::policy_by_value_interface::inclusive_scan_by_key(
+      std::forward<ExecPolicy>(p),
+      r,
+      std::forward<KeyContainer>(keys),
+      std::forward<InContainer>(in),
+      std::forward<OutContainer>(out),
+      binop,
+      keyeq);
+}
+
+/*!
+******************************************************************************
+*
+* \brief  exclusive scan by key execution pattern
+*
+* \param[in] p Execution policy
+* \param[in] keys Random-Access Container of keys; each run of equal
+*consecutive keys is scanned independently
+* \param[in] in Random-Access Container
+* \param[out] out Random-Access Container for output data
+* \param[in] binop binary function to apply for scan
+* \param[in] value initial value of each segment
+* \param[in] keyeq predicate used to compare adjacent keys
+*
+* \note{The range of [begin, end) must be separate from [out, out + (end -
+*begin))}
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename Res,
+          typename KeyContainer,
+          typename InContainer,
+          typename OutContainer,
+          typename T = RAJA::detail::ContainerVal<InContainer>,
+          typename Function = operators::plus<T>,
+          typename KeyEqual = operators::equal_to<RAJA::detail::ContainerVal<KeyContainer>>>
+RAJA_INLINE
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_resource<Res>,
+                      std::is_constructible<camp::resources::Resource, Res>,
+                      type_traits::is_range<KeyContainer>,
+                      type_traits::is_range<InContainer>,
+                      type_traits::is_range<OutContainer>>
+exclusive_scan_by_key(ExecPolicy&& p,
+                      Res r,
+                      KeyContainer&& keys,
+                      InContainer&& in,
+                      OutContainer&& out,
+                      Function binop = Function{},
+                      T value = Function::identity(),
+                      KeyEqual keyeq = KeyEqual{})
+{
+  using std::begin;
+  using std::end;
+  using U = RAJA::detail::ContainerVal<InContainer>;
+  using R = RAJA::detail::ContainerVal<OutContainer>;
+  static_assert(type_traits::is_binary_function<Function, R, T, U>::value,
+                "Function must model BinaryFunction");
+  static_assert(type_traits::is_random_access_range<KeyContainer>::value,
+                "KeyContainer must model RandomAccessRange");
+  static_assert(type_traits::is_random_access_range<InContainer>::value,
+                "InContainer must model RandomAccessRange");
+  static_assert(type_traits::is_random_access_range<OutContainer>::value,
+                "OutContainer must model RandomAccessRange");
+  if (begin(in) == end(in)) {
+    return resources::EventProxy<Res>(r);
+  }
+  auto heads = RAJA::detail::scan_key_heads<
+      RAJA::detail::ContainerIter<KeyContainer>, KeyEqual>{begin(keys), keyeq};
+  return impl::scan::exclusive_segmented(r, std::forward<ExecPolicy>(p), heads,
+                                         begin(in), end(in), begin(out),
+                                         binop, value);
+}
+///
+template <typename ExecPolicy,
+          typename KeyContainer,
+          typename InContainer,
+          typename OutContainer,
+          typename T = RAJA::detail::ContainerVal<InContainer>,
+          typename Function = operators::plus<T>,
+          typename KeyEqual = operators::equal_to<RAJA::detail::ContainerVal<KeyContainer>>,
+          typename Res = typename resources::get_resource<ExecPolicy>::type>
+RAJA_INLINE
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_range<KeyContainer>,
+                      concepts::negate<std::is_constructible<camp::resources::Resource, KeyContainer>>,
+                      type_traits::is_range<InContainer>,
+                      type_traits::is_range<OutContainer>>
+exclusive_scan_by_key(ExecPolicy&& p,
+                      KeyContainer&& keys,
+                      InContainer&& in,
+                      OutContainer&& out,
+                      Function binop = Function{},
+                      T value = Function::identity(),
+                      KeyEqual keyeq = KeyEqual{})
+{
+  auto r = Res::get_default();
+  return ::RAJA::policy_by_value_interface::exclusive_scan_by_key(
+      std::forward<ExecPolicy>(p),
+      r,
+      std::forward<KeyContainer>(keys),
+      std::forward<InContainer>(in),
+      std::forward<OutContainer>(out),
+      binop,
+      value,
+      keyeq);
+}
+
+/*!
+******************************************************************************
+*
+* \brief  inclusive segmented scan execution pattern
+*
+* \param[in] p Execution policy
+* \param[in] flags Random-Access Container of head flags; a non-zero flag
+*starts a new segment at that index
+* \param[in] in Random-Access Container
+* \param[out] out Random-Access Container for output data
+* \param[in] binop binary function to apply for scan
+*
+* \note{The range of [begin, end) must be separate from [out, out + (end -
+*begin))}
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename Res,
+          typename FlagContainer,
+          typename InContainer,
+          typename OutContainer,
+          typename Function = operators::plus<RAJA::detail::ContainerVal<InContainer>>>
+RAJA_INLINE
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_resource<Res>,
+                      std::is_constructible<camp::resources::Resource, Res>,
+                      type_traits::is_range<FlagContainer>,
+                      type_traits::is_range<InContainer>,
+                      type_traits::is_range<OutContainer>>
+inclusive_segmented_scan(ExecPolicy&& p,
+                         Res r,
+                         FlagContainer&& flags,
+                         InContainer&& in,
+                         OutContainer&& out,
+                         Function binop = Function{})
+{
+  using std::begin;
+  using std::end;
+  using T = RAJA::detail::ContainerVal<InContainer>;
+  using R = RAJA::detail::ContainerVal<OutContainer>;
+  static_assert(type_traits::is_binary_function<Function, R, T, R>::value,
+                "Function must model BinaryFunction");
+  static_assert(type_traits::is_random_access_range<FlagContainer>::value,
+                "FlagContainer must model RandomAccessRange");
+  static_assert(type_traits::is_random_access_range<InContainer>::value,
+                "InContainer must model RandomAccessRange");
+  static_assert(type_traits::is_random_access_range<OutContainer>::value,
+                "OutContainer must model RandomAccessRange");
+  if (begin(in) == end(in)) {
+    return resources::EventProxy<Res>(r);
+  }
+  auto heads = RAJA::detail::scan_flag_heads<
+      RAJA::detail::ContainerIter<FlagContainer>>{begin(flags)};
+  return impl::scan::inclusive_segmented(r, std::forward<ExecPolicy>(p), heads,
+                                         begin(in), end(in), begin(out),
+                                         binop);
+}
+///
+template <typename ExecPolicy,
+          typename FlagContainer,
+          typename InContainer,
+          typename OutContainer,
+          typename Function = operators::plus<RAJA::detail::ContainerVal<InContainer>>,
+          typename Res = typename resources::get_resource<ExecPolicy>::type>
+RAJA_INLINE
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_range<FlagContainer>,
+                      concepts::negate<std::is_constructible<camp::resources::Resource, FlagContainer>>,
+                      type_traits::is_range<InContainer>,
+                      type_traits::is_range<OutContainer>>
+inclusive_segmented_scan(ExecPolicy&& p,
+                         FlagContainer&& flags,
+                         InContainer&& in,
+                         OutContainer&& out,
+                         Function binop = Function{})
+{
+  auto r = Res::get_default();
+  return ::RAJA::policy_by_value_interface::inclusive_segmented_scan(
+      std::forward<ExecPolicy>(p),
+      r,
+      std::forward<FlagContainer>(flags),
+      std::forward<InContainer>(in),
+      std::forward<OutContainer>(out),
+      binop);
+}
+
+/*!
+******************************************************************************
+*
+* \brief  exclusive segmented scan execution pattern
+*
+* \param[in] p Execution policy
+* \param[in] flags Random-Access Container of head flags; a non-zero flag
+*starts a new segment at that index
+* \param[in] in Random-Access Container
+* \param[out] out Random-Access Container for output data
+* \param[in] binop binary function to apply for scan
+* \param[in] value initial value of each segment
+*
+* \note{The range of [begin, end) must be separate from [out, out + (end -
+*begin))}
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename Res,
+          typename FlagContainer,
+          typename InContainer,
+          typename OutContainer,
+          typename T = RAJA::detail::ContainerVal<InContainer>,
+          typename Function = operators::plus<T>>
+RAJA_INLINE
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_resource<Res>,
+                      std::is_constructible<camp::resources::Resource, Res>,
+                      type_traits::is_range<FlagContainer>,
+                      type_traits::is_range<InContainer>,
+                      type_traits::is_range<OutContainer>>
+exclusive_segmented_scan(ExecPolicy&& p,
+                         Res r,
+                         FlagContainer&& flags,
+                         InContainer&& in,
+                         OutContainer&& out,
+                         Function binop = Function{},
+                         T value = Function::identity())
+{
+  using std::begin;
+  using std::end;
+  using U = RAJA::detail::ContainerVal<InContainer>;
+  using R = RAJA::detail::ContainerVal<OutContainer>;
+  static_assert(type_traits::is_binary_function<Function, R, T, U>::value,
+                "Function must model BinaryFunction");
+  static_assert(type_traits::is_random_access_range<FlagContainer>::value,
+                "FlagContainer must model RandomAccessRange");
+  static_assert(type_traits::is_random_access_range<InContainer>::value,
+                "InContainer must model RandomAccessRange");
+  static_assert(type_traits::is_random_access_range<OutContainer>::value,
+                "OutContainer must model RandomAccessRange");
+  if (begin(in) == end(in)) {
+    return resources::EventProxy<Res>(r);
+  }
+  auto heads = RAJA::detail::scan_flag_heads<
+      RAJA::detail::ContainerIter<FlagContainer>>{begin(flags)};
+  return impl::scan::exclusive_segmented(r, std::forward<ExecPolicy>(p), heads,
+                                         begin(in), end(in), begin(out),
+                                         binop, value);
+}
+///
+template <typename ExecPolicy,
+          typename FlagContainer,
+          typename InContainer,
+          typename OutContainer,
+          typename T = RAJA::detail::ContainerVal<InContainer>,
+          typename Function = operators::plus<T>,
+          typename Res = typename resources::get_resource<ExecPolicy>::type>
+RAJA_INLINE
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_range<FlagContainer>,
+                      concepts::negate<std::is_constructible<camp::resources::Resource, FlagContainer>>,
+                      type_traits::is_range<InContainer>,
+                      type_traits::is_range<OutContainer>>
+exclusive_segmented_scan(ExecPolicy&& p,
+                         FlagContainer&& flags,
+                         InContainer&& in,
+                         OutContainer&& out,
+                         Function binop = Function{},
+                         T value = Function::identity())
+{
+  auto r = Res::get_default();
+  return ::RAJA::policy_by_value_interface::exclusive_segmented_scan(
+      std::forward<ExecPolicy>(p),
+      r,
+      std::forward<FlagContainer>(flags),
+      std::forward<InContainer>(in),
+      std::forward<OutContainer>(out),
+      binop,
+      value);
+}
+
 }  // end inline namespace policy_by_value_interface
 
 
@@ -439,6 +851,122 @@ inclusive_scan_inplace(Res r, Args&&... args)
       ExecPolicy(), r, std::forward<Args>(args)...);
 }
 
+/*!
+ * \brief Conversion from template-based policy to value-based policy for
+ * inclusive_scan_by_key
+ *
+ * this reduces implementation overhead and perfectly forwards all arguments
+ */
+template <typename ExecPolicy, typename... Args,
+          typename Res = typename resources::get_resource<ExecPolicy>::type>
+RAJA_INLINE
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>>
+inclusive_scan_by_key(Args&&... args)
+{
+  Res r = Res::get_default();
+  return ::RAJA::policy_by_value_interface::inclusive_scan_by_key<ExecPolicy>(
+      ExecPolicy(), r, std::forward<Args>(args)...);
+}
+///
+template <typename ExecPolicy, typename Res, typename... Args>
+RAJA_INLINE
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_resource<Res>>
+inclusive_scan_by_key(Res r, Args&&... args)
+{
+  return ::RAJA::policy_by_value_interface::inclusive_scan_by_key(
+      ExecPolicy(), r, std::forward<Args>(args)...);
+}
+
+/*!
+ * \brief Conversion from template-based policy to value-based policy for
+ * exclusive_scan_by_key
+ *
+ * this reduces implementation overhead and perfectly forwards all arguments
+ */
+template <typename ExecPolicy, typename... Args,
+          typename Res = typename resources::get_resource<ExecPolicy>::type>
+RAJA_INLINE
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>>
+exclusive_scan_by_key(Args&&... args)
+{
+  Res r = Res::get_default();
+  return ::RAJA::policy_by_value_interface::exclusive_scan_by_key<ExecPolicy>(
+      ExecPolicy(), r, std::forward<Args>(args)...);
+}
+///
+template <typename ExecPolicy, typename Res, typename... Args>
+RAJA_INLINE
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_resource<Res>>
+exclusive_scan_by_key(Res r, Args&&... args)
+{
+  return ::RAJA::policy_by_value_interface::exclusive_scan_by_key(
+      ExecPolicy(), r, std::forward<Args>(args)...);
+}
+
+/*!
+ * \brief Conversion from template-based policy to value-based policy for
+ * inclusive_segmented_scan
+ *
+ * this reduces implementation overhead and perfectly forwards all arguments
+ */
+template <typename ExecPolicy, typename... Args,
+          typename Res = typename resources::get_resource<ExecPolicy>::type>
+RAJA_INLINE
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>>
+inclusive_segmented_scan(Args&&... args)
+{
+  Res r = Res::get_default();
+  return ::RAJA::policy_by_value_interface::inclusive_segmented_scan<ExecPolicy>(
+      ExecPolicy(), r, std::forward<Args>(args)...);
+}
+///
+template <typename ExecPolicy, typename Res, typename... Args>
+RAJA_INLINE
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_resource<Res>>
+inclusive_segmented_scan(Res r, Args&&... args)
+{
+  return ::RAJA::policy_by_value_interface::inclusive_segmented_scan(
+      ExecPolicy(), r, std::forward<Args>(args)...);
+}
+
+/*!
+ * \brief Conversion from template-based policy to value-based policy for
+ * exclusive_segmented_scan
+ *
+ * this reduces implementation overhead and perfectly forwards all arguments
+ */
+template <typename ExecPolicy, typename... Args,
+          typename Res = typename resources::get_resource<ExecPolicy>::type>
+RAJA_INLINE
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>>
+exclusive_segmented_scan(Args&&... args)
+{
+  Res r = Res::get_default();
+  return ::RAJA::policy_by_value_interface::exclusive_segmented_scan<ExecPolicy>(
+      ExecPolicy(), r, std::forward<Args>(args)...);
+}
+///
+template <typename ExecPolicy, typename Res, typename... Args>
+RAJA_INLINE
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_resource<Res>>
+exclusive_segmented_scan(Res r, Args&&... args)
+{
+  return ::RAJA::policy_by_value_interface::exclusive_segmented_scan(
+      ExecPolicy(), r, std::forward<Args>(args)...);
+}
+
 }  // namespace RAJA
 
 #endif  // closing endif for header file include guard
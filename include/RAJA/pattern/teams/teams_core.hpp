@@ -18,7 +18,15 @@
 #ifndef RAJA_pattern_teams_core_HPP
 #define RAJA_pattern_teams_core_HPP
 
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <thread>
+#include <type_traits>
+
 #include "RAJA/config.hpp"
+#include "RAJA/internal/MemUtils_CPU.hpp"
 #include "RAJA/internal/get_platform.hpp"
 #include "RAJA/util/StaticLayout.hpp"
 #include "RAJA/util/macros.hpp"
@@ -133,6 +141,8 @@ public:
   Threads threads;
   Lanes lanes;
   const char *kernel_name{nullptr};
+  //! bytes of scratch memory per team, see LaunchContext::getSharedMemory
+  size_t shared_mem_bytes{0};
 
   RAJA_INLINE
   Resources() = default;
@@ -140,6 +150,19 @@ public:
   Resources(Teams in_teams, Threads in_threads, const char *in_kernel_name = nullptr)
     : teams(in_teams), threads(in_threads), kernel_name(in_kernel_name){};
 
+  // any integral type, so a literal 0 does not also convert to the name
+  template <typename Bytes,
+            typename std::enable_if<std::is_integral<Bytes>::value>::type * =
+                nullptr>
+  Resources(Teams in_teams,
+            Threads in_threads,
+            Bytes in_shared_mem_bytes,
+            const char *in_kernel_name = nullptr)
+    : teams(in_teams),
+      threads(in_threads),
+      kernel_name(in_kernel_name),
+      shared_mem_bytes(static_cast<size_t>(in_shared_mem_bytes)){};
+
 private:
   RAJA_HOST_DEVICE
   RAJA_INLINE
@@ -155,11 +178,133 @@ private:
 };
 
 
+namespace detail
+{
+
+/*!
+ * Barrier of the threads that run a team on the host. The alignment puts
+ * barriers stored next to each other on separate cache lines.
+ */
+class alignas(64) HostTeamBarrier
+{
+  std::atomic<int> m_count{0};
+  std::atomic<unsigned> m_phase{0};
+
+public:
+  void wait(int num_threads)
+  {
+    // sense reversing barrier, the last thread to arrive resets the count
+    // before it releases the others
+    const unsigned phase = m_phase.load(std::memory_order_acquire);
+    if (m_count.fetch_add(1, std::memory_order_acq_rel) == num_threads - 1) {
+      m_count.store(0, std::memory_order_relaxed);
+      m_phase.fetch_add(1, std::memory_order_release);
+      return;
+    }
+    for (int spins = 0; m_phase.load(std::memory_order_acquire) == phase;
+         ++spins) {
+      if (spins >= 1024) {
+        std::this_thread::yield();
+      }
+    }
+  }
+};
+
+/*!
+ * Position of a thread in the thread groups of a host launch. Launches that
+ * run each team on a single thread leave the default, one group of one
+ * thread and no barrier.
+ */
+struct HostTeam {
+  int group{0};
+  int num_groups{1};
+  int thread{0};
+  int num_threads{1};
+  HostTeamBarrier *barrier{nullptr};
+};
+
+/*!
+ * Scratch memory of a host launch, num_slices slices of slice_bytes, each
+ * starting on a cache line. Launches from the same thread reuse one buffer,
+ * so a launch allocates only when it needs more memory than the ones before
+ * it; a launch nested in the body of another gets its own buffer.
+ */
+class HostSharedMemory
+{
+  struct Buffer {
+    std::unique_ptr<char, FreeAligned> data;
+    size_t bytes{0};
+    bool in_use{false};
+  };
+
+  static Buffer &cached()
+  {
+    static thread_local Buffer buffer;
+    return buffer;
+  }
+
+  std::unique_ptr<char, FreeAligned> m_owned;
+  Buffer *m_cached{nullptr};
+  char *m_data{nullptr};
+  size_t m_slice_bytes{0};
+
+public:
+  static constexpr size_t alignment = 64;
+
+  HostSharedMemory(int num_slices, size_t slice_bytes)
+  {
+    if (slice_bytes == 0 || num_slices <= 0) {
+      return;
+    }
+    m_slice_bytes = (slice_bytes + alignment - 1) / alignment * alignment;
+    const size_t total = m_slice_bytes * num_slices;
+
+    Buffer &buffer = cached();
+    if (!buffer.in_use) {
+      if (buffer.bytes < total) {
+        buffer.data.reset(static_cast<char *>(allocate_aligned(alignment, total)));
+        buffer.bytes = total;
+      }
+      buffer.in_use = true;
+      m_cached = &buffer;
+      m_data = buffer.data.get();
+    } else {
+      m_owned.reset(static_cast<char *>(allocate_aligned(alignment, total)));
+      m_data = m_owned.get();
+    }
+  }
+
+  HostSharedMemory(HostSharedMemory const &) = delete;
+  HostSharedMemory &operator=(HostSharedMemory const &) = delete;
+
+  ~HostSharedMemory()
+  {
+    if (m_cached) {
+      m_cached->in_use = false;
+    }
+  }
+
+  void *slice(int i) const
+  {
+    return m_data ? m_data + i * m_slice_bytes : nullptr;
+  }
+};
+
+}  // namespace detail
+
+
 class LaunchContext : public Resources
 {
 public:
   ExecPlace exec_place;
 
+  //! scratch memory of the team, set by the launch policy
+  void *shared_mem_ptr{nullptr};
+  mutable size_t shared_mem_offset{0};
+
+  //! threads running the team on the host, set by the launch policy
+  detail::HostTeam host_team;
+
   LaunchContext(Resources const &base, ExecPlace place)
       : Resources(base), exec_place(place)
   {
@@ -171,8 +316,36 @@ public:
   {
 #if defined(RAJA_DEVICE_CODE)
     __syncthreads();
+#else
+    if (host_team.barrier) {
+      host_team.barrier->wait(host_team.num_threads);
+    }
 #endif
   }
+
+  /*!
+   * Take count objects of type T from the scratch memory of the team, of
+   * Resources::shared_mem_bytes bytes. Every thread of a team gets the same
+   * pointer when the threads make the same calls. Memory is taken in order
+   * until releaseSharedMemory(), usually called at the end of each team.
+   */
+  template <typename T>
+  RAJA_HOST_DEVICE T *getSharedMemory(size_t count) const
+  {
+    const size_t offset =
+        (shared_mem_offset + alignof(T) - 1) / alignof(T) * alignof(T);
+#if !defined(RAJA_DEVICE_CODE)
+    if (offset + count * sizeof(T) > shared_mem_bytes) {
+      RAJA_ABORT_OR_THROW("getSharedMemory exceeds the shared memory of the launch");
+    }
+#endif
+    shared_mem_offset = offset + count * sizeof(T);
+    return reinterpret_cast<T *>(static_cast<char *>(shared_mem_ptr) + offset);
+  }
+
+  //! return all memory taken with getSharedMemory()
+  RAJA_HOST_DEVICE
+  void releaseSharedMemory() const { shared_mem_offset = 0; }
 };
 
 
@@ -0,0 +1,104 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file defining the vector index passed to vector_exec
+ *          loop bodies.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-21, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_pattern_vector_VectorIndex_HPP
+#define RAJA_pattern_vector_VectorIndex_HPP
+
+#include <type_traits>
+
+#include "RAJA/config.hpp"
+
+#include "RAJA/util/macros.hpp"
+
+#include "camp/camp.hpp"
+
+namespace RAJA
+{
+
+/*!
+ * \brief The indices [*idx, *idx + idx.size()) of one vector of a loop.
+ *
+ * Indexing a View with a VectorIndex returns a VectorRef that loads and
+ * stores VECTOR_TYPE registers. size() is VECTOR_TYPE::s_num_elem except
+ * for the remainder at the end of the loop.
+ */
+template <typename IDX, typename VECTOR_TYPE>
+class VectorIndex
+{
+public:
+  using index_type = IDX;
+  using vector_type = VECTOR_TYPE;
+
+  RAJA_INLINE
+  constexpr VectorIndex()
+      : m_index(index_type(0)), m_length(vector_type::s_num_elem)
+  {
+  }
+
+  RAJA_INLINE
+  constexpr VectorIndex(index_type value, camp::idx_t length)
+      : m_index(value), m_length(length)
+  {
+  }
+
+  //! first index
+  RAJA_INLINE
+  constexpr index_type operator*() const { return m_index; }
+
+  //! number of indices
+  RAJA_INLINE
+  constexpr camp::idx_t size() const { return m_length; }
+
+  RAJA_INLINE
+  static constexpr camp::idx_t num_elem() { return vector_type::s_num_elem; }
+
+private:
+  index_type m_index;
+  camp::idx_t m_length;
+};
+
+namespace internal
+{
+
+template <typename T>
+struct is_vector_index : std::false_type {
+};
+
+template <typename IDX, typename VECTOR_TYPE>
+struct is_vector_index<VectorIndex<IDX, VECTOR_TYPE>> : std::true_type {
+};
+
+//! first index of a VectorIndex, other arguments are returned unchanged
+template <typename IDX, typename VECTOR_TYPE>
+RAJA_INLINE constexpr IDX vector_index_value(
+    VectorIndex<IDX, VECTOR_TYPE> const &arg)
+{
+  return *arg;
+}
+
+template <typename ARG>
+RAJA_INLINE constexpr ARG const &vector_index_value(ARG const &arg)
+{
+  return arg;
+}
+
+}  // namespace internal
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
@@ -0,0 +1,176 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file defining the reference to a vector of View
+ *          elements.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-21, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_pattern_vector_VectorRef_HPP
+#define RAJA_pattern_vector_VectorRef_HPP
+
+#include "RAJA/config.hpp"
+
+#include "RAJA/util/macros.hpp"
+
+#include "camp/camp.hpp"
+
+namespace RAJA
+{
+
+/*!
+ * \brief Reference to the View elements of a VectorIndex.
+ *
+ * Converting to VECTOR_TYPE loads the elements and assigning stores them,
+ * with packed loads and stores when the VectorIndex indexes a dimension
+ * with stride one and strided ones otherwise. Only the first
+ * length elements are touched, the other lanes load as zero.
+ *
+ * Arithmetic on a VectorRef converts it to VECTOR_TYPE, so expressions
+ * like
+ *
+ *     y(i) += a * x(i);
+ *
+ * load x(i) and y(i) as registers and store the result to y(i).
+ */
+template <typename VECTOR_TYPE, typename POINTER_TYPE, bool STRIDE_ONE>
+class VectorRef
+{
+public:
+  using vector_type = VECTOR_TYPE;
+  using pointer_type = POINTER_TYPE;
+  using element_type = typename vector_type::element_type;
+
+  RAJA_INLINE
+  VectorRef(pointer_type data, camp::idx_t stride, camp::idx_t length)
+      : m_data(data), m_stride(stride), m_length(length)
+  {
+  }
+
+  VectorRef(VectorRef const &) = default;
+
+  RAJA_INLINE
+  vector_type load() const
+  {
+    vector_type value;
+    if (STRIDE_ONE || m_stride == 1) {
+      if (m_length == vector_type::s_num_elem) {
+        value.load_packed(m_data);
+      } else {
+        value.load_packed_n(m_data, m_length);
+      }
+    } else {
+      if (m_length == vector_type::s_num_elem) {
+        value.load_strided(m_data, m_stride);
+      } else {
+        value.load_strided_n(m_data, m_stride, m_length);
+      }
+    }
+    return value;
+  }
+
+  RAJA_INLINE
+  void store(vector_type const &value) const
+  {
+    if (STRIDE_ONE || m_stride == 1) {
+      if (m_length == vector_type::s_num_elem) {
+        value.store_packed(m_data);
+      } else {
+        value.store_packed_n(m_data, m_length);
+      }
+    } else {
+      if (m_length == vector_type::s_num_elem) {
+        value.store_strided(m_data, m_stride);
+      } else {
+        value.store_strided_n(m_data, m_stride, m_length);
+      }
+    }
+  }
+
+  RAJA_INLINE
+  operator vector_type() const { return load(); }
+
+  //! number of elements referenced
+  RAJA_INLINE
+  camp::idx_t size() const { return m_length; }
+
+  RAJA_INLINE
+  VectorRef const &operator=(VectorRef const &rhs) const
+  {
+    store(rhs.load());
+    return *this;
+  }
+
+  RAJA_INLINE
+  VectorRef const &operator=(vector_type const &rhs) const
+  {
+    store(rhs);
+    return *this;
+  }
+
+  RAJA_INLINE
+  VectorRef const &operator=(element_type rhs) const
+  {
+    store(vector_type(rhs));
+    return *this;
+  }
+
+  RAJA_INLINE
+  VectorRef const &operator+=(vector_type const &rhs) const
+  {
+    store(load().add(rhs));
+    return *this;
+  }
+
+  RAJA_INLINE
+  VectorRef const &operator-=(vector_type const &rhs) const
+  {
+    store(load().subtract(rhs));
+    return *this;
+  }
+
+  RAJA_INLINE
+  VectorRef const &operator*=(vector_type const &rhs) const
+  {
+    store(load().multiply(rhs));
+    return *this;
+  }
+
+  RAJA_INLINE
+  VectorRef const &operator/=(vector_type const &rhs) const
+  {
+    store(load().divide(rhs));
+    return *this;
+  }
+
+  //! sum of the referenced elements
+  RAJA_INLINE
+  element_type sum() const { return load().sum(); }
+
+  //! max of the referenced elements
+  RAJA_INLINE
+  element_type max() const { return load().max_n(m_length); }
+
+  //! min of the referenced elements
+  RAJA_INLINE
+  element_type min() const { return load().min_n(m_length); }
+
+private:
+  pointer_type m_data;
+  camp::idx_t m_stride;
+  camp::idx_t m_length;
+};
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
@@ -20,6 +20,7 @@
 
 #include "RAJA/config.hpp"
 
+#include <chrono>
 #include <tuple>
 
 #include "RAJA/policy/PolicyBase.hpp"
@@ -38,6 +39,29 @@ namespace detail
 {
 template <size_t index, size_t size, typename Policy, typename... rest>
 struct policy_invoker;
+
+/// Run invoke, the selected policy, and report how long it took to
+/// selectors that tune on timings, such as TuningSelector, through
+/// report(iterable, index, seconds)
+template <typename Selector, typename Iterable, typename Invoke>
+auto invoke_selected(Selector &s,
+                     Iterable const &iter,
+                     size_t index,
+                     Invoke &&invoke,
+                     int) -> decltype(s.report(iter, index, 0.0), void())
+{
+  auto start = std::chrono::steady_clock::now();
+  invoke();
+  std::chrono::duration<double> elapsed =
+      std::chrono::steady_clock::now() - start;
+  s.report(iter, index, elapsed.count());
+}
+
+template <typename Selector, typename Iterable, typename Invoke>
+void invoke_selected(Selector &, Iterable const &, size_t, Invoke &&invoke, long)
+{
+  invoke();
+}
 }
 
 namespace policy
@@ -68,8 +92,9 @@ public:
   int invoke(Iterable &&i, Body &&b)
   {
     size_t index = s(i);
-    _policies.invoke(index, i, b);
-    return s(i);
+    detail::invoke_selected(s, i, index,
+                            [&]() { _policies.invoke(index, i, b); }, 0);
+    return index;
   }
 
   detail::
@@ -35,7 +35,8 @@ enum class Policy {
   target_openmp,
   cuda,
   hip,
-  tbb
+  tbb,
+  thread_team
 };
 
 enum class Pattern {
@@ -186,6 +187,10 @@ template <typename Pol>
 struct is_tbb_policy : RAJA::policy_is<Pol, RAJA::Policy::tbb> {
 };
 template <typename Pol>
+struct is_thread_team_policy
+    : RAJA::policy_is<Pol, RAJA::Policy::thread_team> {
+};
+template <typename Pol>
 struct is_target_openmp_policy
     : RAJA::policy_is<Pol, RAJA::Policy::target_openmp> {
 };
@@ -0,0 +1,184 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file for a MultiPolicy selector that tunes itself by timing
+ *          each of its policies.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-21, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_policy_TuningSelector_HPP
+#define RAJA_policy_TuningSelector_HPP
+
+#include "RAJA/config.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "RAJA/util/macros.hpp"
+
+namespace RAJA
+{
+
+namespace detail
+{
+
+/// Tuning state of one call site for problems in one size bucket
+struct TuningBucket {
+  std::atomic<int> choice{-1};
+  std::vector<double> best_time;
+  std::vector<int> num_samples;
+};
+
+/// Tuning state of one call site, with a bucket for each power of two of
+/// problem size. num_policies never changes, a call site tuned again for a
+/// different number of policies gets a new TuningSite.
+struct TuningSite {
+  static constexpr int num_buckets = 64;
+
+  explicit TuningSite(size_t policies) : num_policies(policies) {}
+
+  const size_t num_policies;
+  TuningBucket buckets[num_buckets];
+};
+
+/// Returns the tuning state of the call site named key, shared by all
+/// selectors with that key and number of policies.
+///
+/// The registry of call sites is kept in src/TuningSelector.cpp. If the
+/// environment variable RAJA_MULTI_POLICY_TUNING_FILE is set the registry
+/// loads tuned choices from that file when it is created and saves all
+/// tuned choices to it at program exit.
+std::shared_ptr<TuningSite> getTuningSite(const std::string &key,
+                                          size_t num_policies);
+
+/// Returns the policy with the fewest samples in an untuned bucket, or the
+/// choice if the bucket was tuned meanwhile
+size_t nextTuningPolicy(TuningSite &site, TuningBucket &bucket);
+
+/// Records a time of policy index, and chooses the fastest policy once every
+/// policy has num_samples samples
+void reportTuningTime(TuningSite &site,
+                      TuningBucket &bucket,
+                      size_t index,
+                      double seconds,
+                      int num_samples);
+
+}  // namespace detail
+
+namespace policy
+{
+namespace multi
+{
+
+/// TuningSelector - MultiPolicy selector that picks the fastest policy by
+/// timing them.
+///
+/// Tuning is kept separately for each call site, named by key, and for each
+/// power of two of the length of the iterable. The first launches in a size
+/// bucket run each of the policies in turn, num_samples times each, and the
+/// policy with the smallest time is used for all later launches in that
+/// bucket. A problem size in a new bucket starts tuning again. Selectors
+/// constructed with the same key share their tuning, so a selector may be
+/// constructed at each launch.
+///
+/// Times are host wall clock times of the launch, policies that run
+/// asynchronously must be synchronized by the loop to be compared fairly.
+///
+/// Tuned choices can be saved to and loaded from a file with
+/// saveMultiPolicyTuning and loadMultiPolicyTuning, or automatically
+/// through the environment variable RAJA_MULTI_POLICY_TUNING_FILE.
+class TuningSelector
+{
+public:
+  TuningSelector(const std::string &key,
+                 size_t num_policies,
+                 int num_samples = 3)
+      : m_site(detail::getTuningSite(key, num_policies)),
+        m_num_samples(num_samples > 0 ? num_samples : 1)
+  {
+    if (num_policies == 0) {
+      RAJA_ABORT_OR_THROW("TuningSelector requires at least one policy");
+    }
+  }
+
+  template <typename Iterable>
+  size_t operator()(Iterable const &iter)
+  {
+    detail::TuningBucket &bucket = get_bucket(iter);
+
+    int choice = bucket.choice.load(std::memory_order_relaxed);
+    if (choice >= 0) {
+      return choice;
+    }
+
+    // run the policy with the fewest samples so far
+    return detail::nextTuningPolicy(*m_site, bucket);
+  }
+
+  template <typename Iterable>
+  void report(Iterable const &iter, size_t index, double seconds)
+  {
+    detail::TuningBucket &bucket = get_bucket(iter);
+    if (bucket.choice.load(std::memory_order_relaxed) >= 0) {
+      return;
+    }
+
+    detail::reportTuningTime(*m_site, bucket, index, seconds, m_num_samples);
+  }
+
+  /// Policy chosen for problems the size of iter, or -1 while tuning
+  template <typename Iterable>
+  int tuned(Iterable const &iter) const
+  {
+    return get_bucket(iter).choice.load(std::memory_order_relaxed);
+  }
+
+private:
+  std::shared_ptr<detail::TuningSite> m_site;
+  int m_num_samples;
+
+  template <typename Iterable>
+  detail::TuningBucket &get_bucket(Iterable const &iter) const
+  {
+    using std::begin;
+    using std::distance;
+    using std::end;
+    auto len = distance(begin(iter), end(iter));
+
+    int b = 0;
+    while (len > 1 && b < detail::TuningSite::num_buckets - 1) {
+      len /= 2;
+      ++b;
+    }
+    return m_site->buckets[b];
+  }
+};
+
+}  // end namespace multi
+}  // end namespace policy
+
+using policy::multi::TuningSelector;
+
+/// Load tuned MultiPolicy choices saved by saveMultiPolicyTuning
+bool loadMultiPolicyTuning(const std::string &filename);
+
+/// Save the choices of all tuned TuningSelectors
+bool saveMultiPolicyTuning(const std::string &filename);
+
+}  // end namespace RAJA
+
+#endif
@@ -38,6 +38,9 @@ struct cuda_launch_t {
 template <typename BODY>
 __global__ void launch_global_fcn(LaunchContext ctx, BODY body_in)
 {
+  extern __shared__ char raja_launch_shared_mem[];
+  ctx.shared_mem_ptr = raja_launch_shared_mem;
+
   using RAJA::internal::thread_privatize;
   auto privatizer = thread_privatize(body_in);
   auto& body = privatizer.get_priv();
@@ -77,9 +80,10 @@ struct LaunchExecute<RAJA::expt::cuda_launch_t<async, 0>> {
       RAJA_FT_BEGIN;
 
       //
-      // Setup shared memory buffers
+      // Setup shared memory buffers, the launch requests dynamic shared
+      // memory through Resources
       //
-      size_t shmem = 0;
+      size_t shmem = ctx.shared_mem_bytes;
 
       {
         //
@@ -110,6 +114,9 @@ template <typename BODY, int num_threads>
 __launch_bounds__(num_threads, 1) __global__
     void launch_global_fcn_fixed(LaunchContext ctx, BODY body_in)
 {
+  extern __shared__ char raja_launch_shared_mem[];
+  ctx.shared_mem_ptr = raja_launch_shared_mem;
+
   using RAJA::internal::thread_privatize;
   auto privatizer = thread_privatize(body_in);
   auto& body = privatizer.get_priv();
@@ -149,9 +156,10 @@ struct LaunchExecute<RAJA::expt::cuda_launch_t<async, nthreads>> {
       RAJA_FT_BEGIN;
 
       //
-      // Setup shared memory buffers
+      // Setup shared memory buffers, the launch requests dynamic shared
+      // memory through Resources
       //
-      size_t shmem = 0;
+      size_t shmem = ctx.shared_mem_bytes;
 
       {
         //
@@ -38,6 +38,9 @@ struct hip_launch_t {
 template <typename BODY>
 __global__ void launch_global_fcn(LaunchContext ctx, BODY body_in)
 {
+  extern __shared__ char raja_launch_shared_mem[];
+  ctx.shared_mem_ptr = raja_launch_shared_mem;
+
   using RAJA::internal::thread_privatize;
   auto privatizer = thread_privatize(body_in);
   auto& body = privatizer.get_priv();
@@ -77,9 +80,10 @@ struct LaunchExecute<RAJA::expt::hip_launch_t<async, 0>> {
       RAJA_FT_BEGIN;
 
       //
-      // Setup shared memory buffers
+      // Setup shared memory buffers, the launch requests dynamic shared
+      // memory through Resources
       //
-      size_t shmem = 0;
+      size_t shmem = ctx.shared_mem_bytes;
 
       {
         //
@@ -108,6 +112,9 @@ template <typename BODY, int num_threads>
 __launch_bounds__(num_threads, 1) __global__
 static void launch_global_fcn_fixed(LaunchContext ctx, BODY body_in)
 {
+  extern __shared__ char raja_launch_shared_mem[];
+  ctx.shared_mem_ptr = raja_launch_shared_mem;
+
   using RAJA::internal::thread_privatize;
   auto privatizer = thread_privatize(body_in);
   auto& body = privatizer.get_priv();
@@ -147,9 +154,10 @@ struct LaunchExecute<RAJA::expt::hip_launch_t<async, nthreads>> {
       RAJA_FT_BEGIN;
 
       //
-      // Setup shared memory buffers
+      // Setup shared memory buffers, the launch requests dynamic shared
+      // memory through Resources
       //
-      size_t shmem = 0;
+      size_t shmem = ctx.shared_mem_bytes;
 
       {
         //
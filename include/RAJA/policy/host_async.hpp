@@ -0,0 +1,36 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file containing RAJA headers for asynchronous host
+ *          execution with the HostAsync resource.
+ *
+ *          These headers must be included after the headers of the host
+ *          execution policies.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-21, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_host_async_HPP
+#define RAJA_host_async_HPP
+
+#include "RAJA/config.hpp"
+
+#if defined(RAJA_ENABLE_HOST_ASYNC)
+
+#include "RAJA/policy/host_async/resource.hpp"
+#include "RAJA/policy/host_async/forall.hpp"
+#include "RAJA/policy/host_async/scan.hpp"
+#include "RAJA/policy/host_async/sort.hpp"
+
+#endif
+
+#endif  // closing endif for header file include guard
@@ -0,0 +1,71 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file containing RAJA forall launches of host execution
+ *          policies on the HostAsync resource.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-21, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_forall_host_async_HPP
+#define RAJA_forall_host_async_HPP
+
+#include "RAJA/config.hpp"
+
+#if defined(RAJA_ENABLE_HOST_ASYNC)
+
+#include "RAJA/util/concepts.hpp"
+#include "RAJA/util/macros.hpp"
+
+#include "RAJA/policy/host_async/resource.hpp"
+
+namespace RAJA
+{
+
+namespace resources
+{
+
+///
+/// Launch a host policy forall on a HostAsync resource, the loop runs with
+/// the host resource on the worker thread of async_res.
+///
+/// This is found by argument dependent lookup on the resource type.
+///
+template <typename ExecPolicy, typename Iterable, typename Func>
+RAJA_INLINE concepts::enable_if_t<
+    resources::EventProxy<resources::HostAsync>,
+    detail::is_host_async_launchable<ExecPolicy>>
+forall_impl(resources::HostAsync async_res,
+            ExecPolicy&& p,
+            Iterable&& iter,
+            Func&& loop_body)
+{
+  using exec_policy = camp::decay<ExecPolicy>;
+  using iterable = camp::decay<Iterable>;
+  using body = camp::decay<Func>;
+
+  async_res.enqueue([ p = exec_policy(p),
+                      iter = iterable(std::forward<Iterable>(iter)),
+                      loop_body = body(std::forward<Func>(loop_body)) ]() mutable {
+    forall_impl(resources::Host::get_default(), p, iter, loop_body);
+  });
+
+  return resources::EventProxy<resources::HostAsync>(async_res);
+}
+
+}  // namespace resources
+
+}  // namespace RAJA
+
+#endif  // closing endif for if defined(RAJA_ENABLE_HOST_ASYNC)
+
+#endif  // closing endif for header file include guard
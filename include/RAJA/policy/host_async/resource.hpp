@@ -0,0 +1,393 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file defining the asynchronous host resource and event.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-21, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_host_async_resource_HPP
+#define RAJA_host_async_resource_HPP
+
+#include "RAJA/config.hpp"
+
+#if defined(RAJA_ENABLE_HOST_ASYNC)
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <utility>
+
+#include "RAJA/internal/get_platform.hpp"
+#include "RAJA/util/resource.hpp"
+
+namespace RAJA
+{
+
+namespace resources
+{
+
+namespace detail
+{
+
+/*!
+ * \brief In order queue of host tasks run by its own worker thread.
+ *
+ * The worker thread is started when the first task is enqueued and runs
+ * until shutdown, which finishes all enqueued tasks. Tasks enqueued after
+ * shutdown run immediately on the calling thread. Tasks are numbered from 1
+ * in order of submission; a task is complete when completed() is at least
+ * its number.
+ */
+class HostAsyncQueue
+{
+public:
+  using ticket_type = unsigned long long;
+
+  HostAsyncQueue() = default;
+
+  HostAsyncQueue(HostAsyncQueue const&) = delete;
+  HostAsyncQueue& operator=(HostAsyncQueue const&) = delete;
+
+  ~HostAsyncQueue() { shutdown(); }
+
+  void shutdown()
+  {
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      m_stop = true;
+    }
+    m_task_cv.notify_one();
+    if (m_thread.joinable()) {
+      m_thread.join();
+    }
+  }
+
+  ticket_type enqueue(std::function<void()> task)
+  {
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      if (!m_stop) {
+        if (!m_thread.joinable()) {
+          m_thread = std::thread(&HostAsyncQueue::run, this);
+        }
+        m_tasks.push_back(std::move(task));
+        ticket_type ticket = ++m_submitted;
+        m_task_cv.notify_one();
+        return ticket;
+      }
+    }
+
+    // shut down, the worker has finished all earlier tasks
+    std::lock_guard<std::mutex> inline_lock(m_inline_mutex);
+    task();
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_completed.fetch_add(1, std::memory_order_release);
+    return ++m_submitted;
+  }
+
+  ticket_type submitted() const
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_submitted;
+  }
+
+  ticket_type completed() const
+  {
+    return m_completed.load(std::memory_order_acquire);
+  }
+
+  void wait(ticket_type ticket) const
+  {
+    if (completed() >= ticket) return;
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_done_cv.wait(lock, [&]() { return completed() >= ticket; });
+  }
+
+  /// Return and clear the first exception thrown by a task
+  std::exception_ptr take_error()
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    std::exception_ptr error = m_error;
+    m_error = nullptr;
+    return error;
+  }
+
+private:
+  void run()
+  {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    while (true) {
+      m_task_cv.wait(lock, [&]() { return m_stop || !m_tasks.empty(); });
+      if (m_tasks.empty()) return;
+
+      std::function<void()> task = std::move(m_tasks.front());
+      m_tasks.pop_front();
+      lock.unlock();
+
+      std::exception_ptr error;
+      try {
+        task();
+      } catch (...) {
+        error = std::current_exception();
+      }
+      // destroy the task before publishing its completion, so reducer
+      // copies captured by it have combined when wait() returns
+      task = nullptr;
+
+      lock.lock();
+      if (error && !m_error) {
+        m_error = error;
+      }
+      m_completed.fetch_add(1, std::memory_order_release);
+      m_done_cv.notify_all();
+    }
+  }
+
+  mutable std::mutex m_mutex;
+  std::mutex m_inline_mutex;
+  std::condition_variable m_task_cv;
+  mutable std::condition_variable m_done_cv;
+  std::deque<std::function<void()>> m_tasks;
+  ticket_type m_submitted = 0;
+  std::atomic<ticket_type> m_completed{0};
+  std::exception_ptr m_error;
+  bool m_stop = false;
+  std::thread m_thread;
+};
+
+/*!
+ * \brief Persistent pool of queues shared by all HostAsync resources.
+ *
+ * Like the pool of streams behind the Cuda resource, new resources take
+ * queues from the pool round robin, so at most num_queues worker threads
+ * are ever created. Queue 0 is reserved for the default resource.
+ */
+class HostAsyncPool
+{
+public:
+  static constexpr int num_queues = 16;
+
+  static HostAsyncPool& get()
+  {
+    static HostAsyncPool pool;
+    return pool;
+  }
+
+  std::shared_ptr<HostAsyncQueue> get_default_queue() { return m_queues[0]; }
+
+  std::shared_ptr<HostAsyncQueue> get_next_queue()
+  {
+    int q = 1 + m_next.fetch_add(1, std::memory_order_relaxed) %
+                    (num_queues - 1);
+    return m_queues[q];
+  }
+
+private:
+  HostAsyncPool()
+  {
+    for (int q = 0; q < num_queues; ++q) {
+      m_queues[q] = std::make_shared<HostAsyncQueue>();
+    }
+  }
+
+  ~HostAsyncPool()
+  {
+    // queues may outlive the pool through resources and events, finish
+    // their work while the pool still holds them so no task releases the
+    // last reference to its own queue
+    for (int q = 0; q < num_queues; ++q) {
+      m_queues[q]->shutdown();
+    }
+  }
+
+  std::shared_ptr<HostAsyncQueue> m_queues[num_queues];
+  std::atomic<int> m_next{0};
+};
+
+}  // namespace detail
+
+/*!
+ * \brief Event marking a point in a HostAsync queue, complete when all work
+ *        enqueued before it has finished.
+ */
+class HostAsyncEvent
+{
+public:
+  HostAsyncEvent() = default;
+
+  HostAsyncEvent(std::shared_ptr<detail::HostAsyncQueue> queue,
+                 detail::HostAsyncQueue::ticket_type ticket)
+      : m_queue(std::move(queue)), m_ticket(ticket)
+  {
+  }
+
+  bool check() const { return !m_queue || m_queue->completed() >= m_ticket; }
+
+  void wait() const
+  {
+    if (m_queue) {
+      m_queue->wait(m_ticket);
+    }
+  }
+
+private:
+  std::shared_ptr<detail::HostAsyncQueue> m_queue;
+  detail::HostAsyncQueue::ticket_type m_ticket = 0;
+};
+
+/*!
+ * \brief Host resource that runs work asynchronously, in order, on a worker
+ *        thread from a persistent pool.
+ *
+ * Launches with a HostAsync resource return as soon as the work is
+ * enqueued and return an EventProxy that converts to a waitable event. Work
+ * on different HostAsync resources may run concurrently with each other and
+ * with the calling thread; wait_for orders work on this resource after an
+ * event from any resource.
+ *
+ * Enqueued work holds copies of the loop body and of the iterable, data
+ * they refer to must stay valid until the work completes. Memory from
+ * deallocate is freed in order after previously enqueued work, memcpy and
+ * memset complete before returning.
+ */
+class HostAsync
+{
+public:
+  HostAsync() : m_queue(detail::HostAsyncPool::get().get_next_queue()) {}
+
+  static HostAsync get_default()
+  {
+    static HostAsync h(detail::HostAsyncPool::get().get_default_queue());
+    return h;
+  }
+
+  camp::resources::Platform get_platform() const
+  {
+    return camp::resources::Platform::host;
+  }
+
+  /// Enqueue a callable to run after all previously enqueued work
+  template <typename Task>
+  HostAsyncEvent enqueue(Task&& task)
+  {
+    return HostAsyncEvent(
+        m_queue, m_queue->enqueue(std::function<void()>(std::forward<Task>(task))));
+  }
+
+  template <typename T>
+  T* allocate(size_t size)
+  {
+    return static_cast<T*>(std::malloc(sizeof(T) * size));
+  }
+
+  void* calloc(size_t size)
+  {
+    void* p = allocate<char>(size);
+    std::memset(p, 0, size);
+    return p;
+  }
+
+  void deallocate(void* p)
+  {
+    enqueue([=]() { std::free(p); });
+  }
+
+  /// Copy after previously enqueued work and wait for the copy, like a
+  /// copy to pageable host memory on the Cuda resource; enqueue a copy
+  /// to overlap it with other work
+  void memcpy(void* dst, const void* src, size_t size)
+  {
+    enqueue([=]() { std::memcpy(dst, src, size); }).wait();
+  }
+
+  void memset(void* p, int val, size_t size)
+  {
+    enqueue([=]() { std::memset(p, val, size); }).wait();
+  }
+
+  HostAsyncEvent get_event() const
+  {
+    return HostAsyncEvent(m_queue, m_queue->submitted());
+  }
+
+  Event get_event_erased() const { return Event{get_event()}; }
+
+  /// Wait for all enqueued work, rethrows the first exception thrown by it
+  void wait()
+  {
+    get_event().wait();
+    std::exception_ptr error = m_queue->take_error();
+    if (error) {
+      std::rethrow_exception(error);
+    }
+  }
+
+  /// Order work enqueued after this call after the event e
+  void wait_for(Event* e)
+  {
+    Event event = *e;
+    enqueue([=]() { event.wait(); });
+  }
+
+  bool operator==(HostAsync const& other) const
+  {
+    return m_queue == other.m_queue;
+  }
+
+  bool operator!=(HostAsync const& other) const { return !(*this == other); }
+
+private:
+  explicit HostAsync(std::shared_ptr<detail::HostAsyncQueue> queue)
+      : m_queue(std::move(queue))
+  {
+  }
+
+  std::shared_ptr<detail::HostAsyncQueue> m_queue;
+};
+
+namespace detail
+{
+
+/// Host execution policies can be launched on a HostAsync resource
+template <typename ExecPolicy>
+struct is_host_async_launchable
+    : std::integral_constant<bool,
+                             RAJA::detail::get_platform<
+                                 camp::decay<ExecPolicy>>::value ==
+                                 RAJA::Platform::host> {
+};
+
+}  // namespace detail
+
+}  // namespace resources
+
+namespace type_traits
+{
+template <>
+struct is_resource<resources::HostAsync> : std::true_type {
+};
+}  // namespace type_traits
+
+}  // namespace RAJA
+
+#endif  // closing endif for if defined(RAJA_ENABLE_HOST_ASYNC)
+
+#endif  // closing endif for header file include guard
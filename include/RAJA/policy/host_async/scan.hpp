@@ -0,0 +1,69 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file providing RAJA scan launches of host execution
+ *          policies on the HostAsync resource.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-21, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_scan_host_async_HPP
+#define RAJA_scan_host_async_HPP
+
+#include "RAJA/config.hpp"
+
+#if defined(RAJA_ENABLE_HOST_ASYNC)
+
+#include "RAJA/util/concepts.hpp"
+
+#include "RAJA/policy/host_async/resource.hpp"
+
+namespace RAJA
+{
+namespace impl
+{
+namespace scan
+{
+
+//
+// Each scan enqueues the host resource version of itself with copies of
+// its iterators and functors, so the host versions must already be declared.
+//
+#define RAJA_HOST_ASYNC_FORWARD_SCAN(NAME)                                 \
+  template <typename ExecPolicy, typename... Args>                         \
+  concepts::enable_if_t<                                                   \
+      resources::EventProxy<resources::HostAsync>,                         \
+      resources::detail::is_host_async_launchable<ExecPolicy>>             \
+  NAME(resources::HostAsync async_res, const ExecPolicy& p, Args... args)  \
+  {                                                                        \
+    async_res.enqueue([=]() mutable {                                      \
+      NAME(resources::Host::get_default(), p, args...);                    \
+    });                                                                    \
+    return resources::EventProxy<resources::HostAsync>(async_res);         \
+  }
+
+RAJA_HOST_ASYNC_FORWARD_SCAN(inclusive_inplace)
+RAJA_HOST_ASYNC_FORWARD_SCAN(exclusive_inplace)
+RAJA_HOST_ASYNC_FORWARD_SCAN(inclusive)
+RAJA_HOST_ASYNC_FORWARD_SCAN(exclusive)
+RAJA_HOST_ASYNC_FORWARD_SCAN(inclusive_segmented)
+RAJA_HOST_ASYNC_FORWARD_SCAN(exclusive_segmented)
+
+#undef RAJA_HOST_ASYNC_FORWARD_SCAN
+
+}  // namespace scan
+}  // namespace impl
+}  // namespace RAJA
+
+#endif  // closing endif for if defined(RAJA_ENABLE_HOST_ASYNC)
+
+#endif  // closing endif for header file include guard
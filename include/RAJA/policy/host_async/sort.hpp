@@ -0,0 +1,67 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file providing RAJA sort launches of host execution
+ *          policies on the HostAsync resource.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-21, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_sort_host_async_HPP
+#define RAJA_sort_host_async_HPP
+
+#include "RAJA/config.hpp"
+
+#if defined(RAJA_ENABLE_HOST_ASYNC)
+
+#include "RAJA/util/concepts.hpp"
+
+#include "RAJA/policy/host_async/resource.hpp"
+
+namespace RAJA
+{
+namespace impl
+{
+namespace sort
+{
+
+//
+// Each sort enqueues the host resource version of itself with copies of
+// its iterators and functors, so the host versions must already be declared.
+//
+#define RAJA_HOST_ASYNC_FORWARD_SORT(NAME)                                 \
+  template <typename ExecPolicy, typename... Args>                         \
+  concepts::enable_if_t<                                                   \
+      resources::EventProxy<resources::HostAsync>,                         \
+      resources::detail::is_host_async_launchable<ExecPolicy>>             \
+  NAME(resources::HostAsync async_res, const ExecPolicy& p, Args... args)  \
+  {                                                                        \
+    async_res.enqueue([=]() mutable {                                      \
+      NAME(resources::Host::get_default(), p, args...);                    \
+    });                                                                    \
+    return resources::EventProxy<resources::HostAsync>(async_res);         \
+  }
+
+RAJA_HOST_ASYNC_FORWARD_SORT(unstable)
+RAJA_HOST_ASYNC_FORWARD_SORT(stable)
+RAJA_HOST_ASYNC_FORWARD_SORT(unstable_pairs)
+RAJA_HOST_ASYNC_FORWARD_SORT(stable_pairs)
+
+#undef RAJA_HOST_ASYNC_FORWARD_SORT
+
+}  // namespace sort
+}  // namespace impl
+}  // namespace RAJA
+
+#endif  // closing endif for if defined(RAJA_ENABLE_HOST_ASYNC)
+
+#endif  // closing endif for header file include guard
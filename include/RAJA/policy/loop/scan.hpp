@@ -154,6 +154,85 @@ exclusive(
   return resources::EventProxy<resources::Host>(host_res);
 }
 
+/*!
+        \brief explicit inclusive segmented scan given input range, segment
+   head predicate, output, and function
+*/
+template <typename ExecPolicy,
+          typename HeadFn,
+          typename Iter,
+          typename OutIter,
+          typename BinFn>
+RAJA_INLINE
+concepts::enable_if_t<resources::EventProxy<resources::Host>,
+                      type_traits::is_loop_policy<ExecPolicy>>
+inclusive_segmented(
+    resources::Host host_res,
+    const ExecPolicy &,
+    HeadFn is_head,
+    const Iter begin,
+    const Iter end,
+    OutIter out,
+    BinFn f)
+{
+  using std::distance;
+  const auto n = distance(begin, end);
+  using DistanceT = typename std::remove_const<decltype(n)>::type;
+
+  using ValueT = typename std::iterator_traits<OutIter>::value_type;
+  ValueT agg = begin[0];
+  out[0] = agg;
+
+  for (DistanceT i = 1; i < n; ++i) {
+    agg = is_head(i) ? ValueT(begin[i]) : f(agg, begin[i]);
+    out[i] = agg;
+  }
+
+  return resources::EventProxy<resources::Host>(host_res);
+}
+
+/*!
+        \brief explicit exclusive segmented scan given input range, segment
+   head predicate, output, function, and initial value
+*/
+template <typename ExecPolicy,
+          typename HeadFn,
+          typename Iter,
+          typename OutIter,
+          typename BinFn,
+          typename T>
+RAJA_INLINE
+concepts::enable_if_t<resources::EventProxy<resources::Host>,
+                      type_traits::is_loop_policy<ExecPolicy>>
+exclusive_segmented(
+    resources::Host host_res,
+    const ExecPolicy &,
+    HeadFn is_head,
+    const Iter begin,
+    const Iter end,
+    OutIter out,
+    BinFn f,
+    T v)
+{
+  using std::distance;
+  const auto n = distance(begin, end);
+  using DistanceT = typename std::remove_const<decltype(n)>::type;
+
+  using ValueT = typename std::iterator_traits<OutIter>::value_type;
+  ValueT agg = v;
+
+  for (DistanceT i = 0; i < n; ++i) {
+    auto t = begin[i];
+    if (is_head(i)) {
+      agg = v;
+    }
+    out[i] = agg;
+    agg = f(agg, t);
+  }
+
+  return resources::EventProxy<resources::Host>(host_res);
+}
+
 }  // namespace scan
 
 }  // namespace impl
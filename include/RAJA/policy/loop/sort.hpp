@@ -79,7 +79,9 @@ struct StableSorter
 */
 template <typename ExecPolicy, typename Iter, typename Compare>
 concepts::enable_if_t<resources::EventProxy<resources::Host>,
-                      type_traits::is_loop_policy<ExecPolicy>>
+                      type_traits::is_loop_policy<ExecPolicy>,
+                      concepts::negate<RAJA::detail::is_radix_sortable<
+                          RAJA::detail::IterVal<Iter>, Compare>>>
 unstable(
     resources::Host host_res,
     const ExecPolicy&,
@@ -97,7 +99,9 @@ unstable(
 */
 template <typename ExecPolicy, typename Iter, typename Compare>
 concepts::enable_if_t<resources::EventProxy<resources::Host>,
-                      type_traits::is_loop_policy<ExecPolicy>>
+                      type_traits::is_loop_policy<ExecPolicy>,
+                      concepts::negate<RAJA::detail::is_radix_sortable<
+                          RAJA::detail::IterVal<Iter>, Compare>>>
 stable(
     resources::Host host_res,
     const ExecPolicy&,
@@ -115,7 +119,9 @@ stable(
 */
 template <typename ExecPolicy, typename KeyIter, typename ValIter, typename Compare>
 concepts::enable_if_t<resources::EventProxy<resources::Host>,
-                      type_traits::is_loop_policy<ExecPolicy>>
+                      type_traits::is_loop_policy<ExecPolicy>,
+                      concepts::negate<RAJA::detail::is_radix_sortable<
+                          RAJA::detail::IterVal<KeyIter>, Compare>>>
 unstable_pairs(
     resources::Host host_res,
     const ExecPolicy&,
@@ -137,7 +143,9 @@ unstable_pairs(
 */
 template <typename ExecPolicy, typename KeyIter, typename ValIter, typename Compare>
 concepts::enable_if_t<resources::EventProxy<resources::Host>,
-                      type_traits::is_loop_policy<ExecPolicy>>
+                      type_traits::is_loop_policy<ExecPolicy>,
+                      concepts::negate<RAJA::detail::is_radix_sortable<
+                          RAJA::detail::IterVal<KeyIter>, Compare>>>
 stable_pairs(
     resources::Host host_res,
     const ExecPolicy&,
@@ -154,6 +162,102 @@ stable_pairs(
   return resources::EventProxy<resources::Host>(host_res);
 }
 
+/*!
+        \brief sort given range of arithmetic keys using less or greater
+               with a radix sort, used for both stable and unstable sorts
+*/
+template <typename ExecPolicy, typename Iter, typename Compare>
+concepts::enable_if_t<resources::EventProxy<resources::Host>,
+                      type_traits::is_loop_policy<ExecPolicy>,
+                      RAJA::detail::is_radix_sortable<
+                          RAJA::detail::IterVal<Iter>, Compare>>
+unstable(
+    resources::Host host_res,
+    const ExecPolicy&,
+    Iter begin,
+    Iter end,
+    Compare comp)
+{
+  if (end - begin < RAJA::detail::radix_sort_cutoff()) {
+    detail::StableSorter{}(begin, end, comp);
+  } else {
+    RAJA::detail::radix_sort<RAJA::detail::radix_descending<Compare>::value>(
+        begin, end);
+  }
+
+  return resources::EventProxy<resources::Host>(host_res);
+}
+
+/*!
+        \brief stable sort given range of arithmetic keys using less or
+               greater with a radix sort
+*/
+template <typename ExecPolicy, typename Iter, typename Compare>
+concepts::enable_if_t<resources::EventProxy<resources::Host>,
+                      type_traits::is_loop_policy<ExecPolicy>,
+                      RAJA::detail::is_radix_sortable<
+                          RAJA::detail::IterVal<Iter>, Compare>>
+stable(
+    resources::Host host_res,
+    const ExecPolicy& p,
+    Iter begin,
+    Iter end,
+    Compare comp)
+{
+  return unstable(host_res, p, begin, end, comp);
+}
+
+/*!
+        \brief sort given range of pairs with arithmetic keys using less or
+               greater with a radix sort, used for both stable and unstable
+               sorts
+*/
+template <typename ExecPolicy, typename KeyIter, typename ValIter, typename Compare>
+concepts::enable_if_t<resources::EventProxy<resources::Host>,
+                      type_traits::is_loop_policy<ExecPolicy>,
+                      RAJA::detail::is_radix_sortable<
+                          RAJA::detail::IterVal<KeyIter>, Compare>>
+unstable_pairs(
+    resources::Host host_res,
+    const ExecPolicy&,
+    KeyIter keys_begin,
+    KeyIter keys_end,
+    ValIter vals_begin,
+    Compare comp)
+{
+  if (keys_end - keys_begin < RAJA::detail::radix_sort_cutoff()) {
+    auto begin = RAJA::zip(keys_begin, vals_begin);
+    auto end = RAJA::zip(keys_end, vals_begin+(keys_end-keys_begin));
+    using zip_ref = RAJA::detail::IterRef<camp::decay<decltype(begin)>>;
+    detail::StableSorter{}(begin, end, RAJA::compare_first<zip_ref>(comp));
+  } else {
+    RAJA::detail::radix_sort_pairs<RAJA::detail::radix_descending<Compare>::value>(
+        keys_begin, keys_end, vals_begin);
+  }
+
+  return resources::EventProxy<resources::Host>(host_res);
+}
+
+/*!
+        \brief stable sort given range of pairs with arithmetic keys using
+               less or greater with a radix sort
+*/
+template <typename ExecPolicy, typename KeyIter, typename ValIter, typename Compare>
+concepts::enable_if_t<resources::EventProxy<resources::Host>,
+                      type_traits::is_loop_policy<ExecPolicy>,
+                      RAJA::detail::is_radix_sortable<
+                          RAJA::detail::IterVal<KeyIter>, Compare>>
+stable_pairs(
+    resources::Host host_res,
+    const ExecPolicy& p,
+    KeyIter keys_begin,
+    KeyIter keys_end,
+    ValIter vals_begin,
+    Compare comp)
+{
+  return unstable_pairs(host_res, p, keys_begin, keys_end, vals_begin, comp);
+}
+
 }  // namespace sort
 
 }  // namespace impl
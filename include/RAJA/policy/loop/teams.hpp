@@ -48,7 +48,10 @@ struct LaunchExecute<RAJA::expt::seq_launch_t> {
   template <typename BODY>
   static void exec(LaunchContext const &ctx, BODY const &body)
   {
-    body(ctx);
+    detail::HostSharedMemory shared(1, ctx.shared_mem_bytes);
+    LaunchContext team_ctx(ctx);
+    team_ctx.shared_mem_ptr = shared.slice(0);
+    body(team_ctx);
   }
 };
 
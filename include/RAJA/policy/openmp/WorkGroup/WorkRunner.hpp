@@ -20,8 +20,17 @@
 
 #include "RAJA/config.hpp"
 
+#include <algorithm>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+#include <omp.h>
+
 #include "RAJA/policy/openmp/policy.hpp"
 
+#include "RAJA/pattern/detail/privatizer.hpp"
+
 #include "RAJA/pattern/WorkGroup/WorkRunner.hpp"
 
 
@@ -75,6 +84,164 @@ struct WorkRunner<
         Args...>
 { };
 
+
+/*!
+ * A body and segment holder for storing loops that will be executed
+ * over a range of their iterations on one thread
+ */
+template <typename Segment_type, typename LoopBody,
+          typename index_type, typename ... Args>
+struct HoldOmpFlattenedLoop
+{
+  template < typename segment_in, typename body_in >
+  HoldOmpFlattenedLoop(segment_in&& segment, body_in&& body)
+    : m_segment(std::forward<segment_in>(segment))
+    , m_body(std::forward<body_in>(body))
+  { }
+
+  RAJA_INLINE void operator()(index_type i_begin, index_type i_end, Args... args) const
+  {
+    using RAJA::internal::thread_privatize;
+    auto privatizer = thread_privatize(m_body);
+    auto& body = privatizer.get_priv();
+    const auto begin = m_segment.begin();
+    for ( index_type i = i_begin; i < i_end; ++i ) {
+      body(begin[i], args...);
+    }
+  }
+
+private:
+  Segment_type m_segment;
+  LoopBody m_body;
+};
+
+/*!
+ * Runs work in a storage container out of order in a single parallel region
+ * with the iterations of all the loops flattened into one iteration space
+ * that is split evenly across the threads, so threads are balanced by loop
+ * length and may run parts of several loops
+ */
+template <typename ALLOCATOR_T,
+          typename INDEX_T,
+          typename ... Args>
+struct WorkRunner<
+        RAJA::omp_work,
+        RAJA::policy::omp::unordered_omp_loop_iter_flattened,
+        ALLOCATOR_T,
+        INDEX_T,
+        Args...>
+{
+  using exec_policy = RAJA::omp_work;
+  using order_policy = RAJA::policy::omp::unordered_omp_loop_iter_flattened;
+  using Allocator = ALLOCATOR_T;
+  using index_type = INDEX_T;
+
+  using vtable_type = Vtable<void, index_type, index_type, Args...>;
+
+  WorkRunner() = default;
+
+  WorkRunner(WorkRunner const&) = delete;
+  WorkRunner& operator=(WorkRunner const&) = delete;
+
+  WorkRunner(WorkRunner && o)
+    : m_loop_offsets(std::move(o.m_loop_offsets))
+  {
+    o.m_loop_offsets.clear();
+  }
+  WorkRunner& operator=(WorkRunner && o)
+  {
+    m_loop_offsets = std::move(o.m_loop_offsets);
+
+    o.m_loop_offsets.clear();
+    return *this;
+  }
+
+  // The type  that will hold the segment and loop body in work storage
+  template < typename ITERABLE, typename LOOP_BODY >
+  using holder_type = HoldOmpFlattenedLoop<ITERABLE, LOOP_BODY,
+                                 index_type, Args...>;
+
+  // The policy indicating where the call function is invoked
+  // in this case the values are called on the host in a loop
+  using vtable_exec_policy = RAJA::loop_work;
+
+  // runner interfaces with storage to enqueue so the runner can get
+  // information from the segment and loop at enqueue time
+  template < typename WorkContainer, typename Iterable, typename LoopBody >
+  inline void enqueue(WorkContainer& storage, Iterable&& iter, LoopBody&& loop_body)
+  {
+    using LOOP_BODY = camp::decay<LoopBody>;
+    using ITERABLE  = camp::decay<Iterable>;
+
+    using holder = holder_type<ITERABLE, LOOP_BODY>;
+
+    const index_type len(std::distance(std::begin(iter), std::end(iter)));
+
+    // Only store loops that have something to iterate over
+    if (len > 0) {
+
+      if (m_loop_offsets.empty()) {
+        m_loop_offsets.emplace_back(0);
+      }
+      m_loop_offsets.emplace_back(m_loop_offsets.back() + len);
+
+      storage.template emplace<holder>(
+          get_Vtable<holder, vtable_type>(vtable_exec_policy{}),
+          std::forward<Iterable>(iter), std::forward<LoopBody>(loop_body));
+    }
+  }
+
+  // no extra storage required here
+  using per_run_storage = int;
+
+  template < typename WorkContainer >
+  per_run_storage run(WorkContainer const& storage, Args... args) const
+  {
+    using value_type = typename WorkContainer::value_type;
+
+    per_run_storage run_storage{};
+
+    if (m_loop_offsets.size() < 2) {
+      return run_storage;
+    }
+
+    const auto begin = storage.begin();
+    const index_type* offsets = m_loop_offsets.data();
+    const index_type num_loops = static_cast<index_type>(m_loop_offsets.size() - 1);
+    const index_type total_iterations = offsets[num_loops];
+
+#pragma omp parallel
+    {
+      const index_type num_threads = omp_get_num_threads();
+      const index_type thread = omp_get_thread_num();
+
+      const index_type i_begin = (total_iterations * thread) / num_threads;
+      const index_type i_end = (total_iterations * (thread + 1)) / num_threads;
+
+      // find the loop containing i_begin
+      index_type loop = static_cast<index_type>(
+          std::upper_bound(offsets, offsets + num_loops + 1, i_begin) - offsets) - 1;
+
+      for (index_type i = i_begin; i < i_end; ++loop) {
+        const index_type loop_end = std::min(offsets[loop + 1], i_end);
+        value_type::call(&begin[loop], i - offsets[loop], loop_end - offsets[loop], args...);
+        i = loop_end;
+      }
+    }
+
+    return run_storage;
+  }
+
+  // clear any state so ready to be destroyed or reused
+  void clear()
+  {
+    m_loop_offsets.clear();
+  }
+
+private:
+  std::vector<index_type> m_loop_offsets;
+};
+
 }  // namespace detail
 
 }  // namespace RAJA
@@ -25,13 +25,22 @@
 
 #if defined(RAJA_ENABLE_OPENMP)
 
+#include <algorithm>
+#include <atomic>
+#include <deque>
 #include <iostream>
+#include <memory>
+#include <thread>
 #include <type_traits>
+#include <vector>
 
 #include <omp.h>
 
+#include "RAJA/util/macros.hpp"
+#include "RAJA/util/mutex.hpp"
 #include "RAJA/util/types.hpp"
 
+#include "RAJA/internal/DepGraphNode.hpp"
 #include "RAJA/internal/fault_tolerance.hpp"
 
 #include "RAJA/index/IndexSet.hpp"
@@ -39,6 +48,7 @@
 #include "RAJA/index/RangeSegment.hpp"
 
 #include "RAJA/policy/openmp/policy.hpp"
+#include "RAJA/policy/simd/forall.hpp"
 
 #include "RAJA/pattern/forall.hpp"
 #include "RAJA/pattern/region.hpp"
@@ -68,6 +78,23 @@ RAJA_INLINE resources::EventProxy<resources::Host> forall_impl(resources::Host h
   return resources::EventProxy<resources::Host>(host_res);
 }
 
+///
+/// OpenMP parallel policy implementation with proc_bind(spread)
+///
+template <typename Iterable, typename Func, typename InnerPolicy>
+RAJA_INLINE resources::EventProxy<resources::Host> forall_impl(resources::Host host_res,
+                                                    const omp_parallel_spread_exec<InnerPolicy>&,
+                                                    Iterable&& iter,
+                                                    Func&& loop_body)
+{
+  RAJA::region<RAJA::omp_parallel_spread_region>([&]() {
+    using RAJA::internal::thread_privatize;
+    auto body = thread_privatize(loop_body);
+    forall_impl(host_res, InnerPolicy{}, iter, body.get_priv());
+  });
+  return resources::EventProxy<resources::Host>(host_res);
+}
+
 
 ///
 /// OpenMP parallel for schedule policy implementation
@@ -286,6 +313,151 @@ namespace internal
   }
   #endif
 
+
+  /// Tag dispatch for omp forall with simd
+
+  //
+  // omp for simd (Auto)
+  //
+  template <typename Iterable, typename Func>
+  RAJA_INLINE void forall_impl_simd(const ::RAJA::policy::omp::Auto&,
+                               Iterable&& iter,
+                               Func&& loop_body)
+  {
+    RAJA_EXTRACT_BED_IT(iter);
+    #pragma omp for simd
+    for (decltype(distance_it) i = 0; i < distance_it; ++i) {
+      loop_body(begin_it[i]);
+    }
+  }
+
+  //
+  // omp for simd schedule(static)
+  //
+  template <typename Iterable, typename Func, int ChunkSize,
+    typename std::enable_if<(ChunkSize <= 0)>::type* = nullptr>
+  RAJA_INLINE void forall_impl_simd(const ::RAJA::policy::omp::Static<ChunkSize>&,
+                               Iterable&& iter,
+                               Func&& loop_body)
+  {
+    RAJA_EXTRACT_BED_IT(iter);
+    #pragma omp for simd schedule(static)
+    for (decltype(distance_it) i = 0; i < distance_it; ++i) {
+      loop_body(begin_it[i]);
+    }
+  }
+
+  //
+  // omp for simd schedule(static, ChunkSize)
+  //
+  template <typename Iterable, typename Func, int ChunkSize,
+    typename std::enable_if<(ChunkSize > 0)>::type* = nullptr>
+  RAJA_INLINE void forall_impl_simd(const ::RAJA::policy::omp::Static<ChunkSize>&,
+                               Iterable&& iter,
+                               Func&& loop_body)
+  {
+    RAJA_EXTRACT_BED_IT(iter);
+    #pragma omp for simd schedule(static, ChunkSize)
+    for (decltype(distance_it) i = 0; i < distance_it; ++i) {
+      loop_body(begin_it[i]);
+    }
+  }
+
+  //
+  // omp for simd schedule(dynamic)
+  //
+  template <typename Iterable, typename Func, int ChunkSize,
+    typename std::enable_if<(ChunkSize <= 0)>::type* = nullptr>
+  RAJA_INLINE void forall_impl_simd(const ::RAJA::policy::omp::Dynamic<ChunkSize>&,
+                               Iterable&& iter,
+                               Func&& loop_body)
+  {
+    RAJA_EXTRACT_BED_IT(iter);
+    #pragma omp for simd schedule(dynamic)
+    for (decltype(distance_it) i = 0; i < distance_it; ++i) {
+      loop_body(begin_it[i]);
+    }
+  }
+
+  //
+  // omp for simd schedule(dynamic, ChunkSize)
+  //
+  template <typename Iterable, typename Func, int ChunkSize,
+    typename std::enable_if<(ChunkSize > 0)>::type* = nullptr>
+  RAJA_INLINE void forall_impl_simd(const ::RAJA::policy::omp::Dynamic<ChunkSize>&,
+                               Iterable&& iter,
+                               Func&& loop_body)
+  {
+    RAJA_EXTRACT_BED_IT(iter);
+    #pragma omp for simd schedule(dynamic, ChunkSize)
+    for (decltype(distance_it) i = 0; i < distance_it; ++i) {
+      loop_body(begin_it[i]);
+    }
+  }
+
+  //
+  // omp for simd schedule(guided)
+  //
+  template <typename Iterable, typename Func, int ChunkSize,
+    typename std::enable_if<(ChunkSize <= 0)>::type* = nullptr>
+  RAJA_INLINE void forall_impl_simd(const ::RAJA::policy::omp::Guided<ChunkSize>&,
+                               Iterable&& iter,
+                               Func&& loop_body)
+  {
+    RAJA_EXTRACT_BED_IT(iter);
+    #pragma omp for simd schedule(guided)
+    for (decltype(distance_it) i = 0; i < distance_it; ++i) {
+      loop_body(begin_it[i]);
+    }
+  }
+
+  //
+  // omp for simd schedule(guided, ChunkSize)
+  //
+  template <typename Iterable, typename Func, int ChunkSize,
+    typename std::enable_if<(ChunkSize > 0)>::type* = nullptr>
+  RAJA_INLINE void forall_impl_simd(const ::RAJA::policy::omp::Guided<ChunkSize>&,
+                               Iterable&& iter,
+                               Func&& loop_body)
+  {
+    RAJA_EXTRACT_BED_IT(iter);
+    #pragma omp for simd schedule(guided, ChunkSize)
+    for (decltype(distance_it) i = 0; i < distance_it; ++i) {
+      loop_body(begin_it[i]);
+    }
+  }
+
+  //
+  // omp for simd schedule(runtime)
+  //
+  template <typename Iterable, typename Func>
+  RAJA_INLINE void forall_impl_simd(const ::RAJA::policy::omp::Runtime&,
+                               Iterable&& iter,
+                               Func&& loop_body)
+  {
+    RAJA_EXTRACT_BED_IT(iter);
+    #pragma omp for simd schedule(runtime)
+    for (decltype(distance_it) i = 0; i < distance_it; ++i) {
+      loop_body(begin_it[i]);
+    }
+  }
+
+  #if !defined(RAJA_COMPILER_MSVC)
+  // dynamic & guided
+  template <typename Policy, typename Iterable, typename Func>
+  RAJA_INLINE void forall_impl_simd(const Policy&,
+                               Iterable&& iter,
+                               Func&& loop_body)
+  {
+    omp_sched_t prev_sched;
+    int prev_chunk;
+    omp_get_schedule(&prev_sched, &prev_chunk);
+    omp_set_schedule(Policy::schedule, Policy::chunk_size);
+    forall_impl_simd(::RAJA::policy::omp::Runtime{}, std::forward<Iterable>(iter), std::forward<Func>(loop_body));
+    omp_set_schedule(prev_sched, prev_chunk);
+  }
+  #endif
+
 } // end namespace internal
 
 template <typename Schedule, typename Iterable, typename Func>
@@ -308,6 +480,43 @@ RAJA_INLINE resources::EventProxy<resources::Host> forall_impl(resources::Host h
   return resources::EventProxy<resources::Host>(host_res);
 }
 
+///
+/// OpenMP for simd policy implementation. Loop bodies that capture reducers
+/// can not be vectorized by 'omp for simd', for them the schedule hands out
+/// chunks of num_lanes iterations that each thread runs through its
+/// SimdLanes.
+///
+template <typename Schedule, typename Iterable, typename Func>
+RAJA_INLINE resources::EventProxy<resources::Host> forall_impl(resources::Host host_res,
+                                                               const omp_for_simd_schedule_exec<Schedule>&,
+                                                               Iterable&& iter,
+                                                               Func&& loop_body)
+{
+  if (!::RAJA::policy::simd::internal::captures_reducers(loop_body)) {
+    internal::forall_impl_simd(Schedule{}, std::forward<Iterable>(iter), std::forward<Func>(loop_body));
+    return resources::EventProxy<resources::Host>(host_res);
+  }
+
+  using lanes_type =
+      ::RAJA::policy::simd::internal::SimdLanes<camp::decay<Func>>;
+
+  auto begin = std::begin(iter);
+  auto distance = std::distance(begin, std::end(iter));
+  using diff_type = decltype(distance);
+  constexpr diff_type num_lanes = lanes_type::num_lanes;
+  const diff_type num_chunks = (distance + num_lanes - 1) / num_lanes;
+
+  lanes_type lanes(loop_body);
+  internal::forall_impl(Schedule{},
+                        TypedRangeSegment<diff_type>(0, num_chunks),
+                        [&](diff_type chunk) {
+                          const diff_type lo = chunk * num_lanes;
+                          lanes(begin, lo, std::min(lo + num_lanes, distance));
+                        });
+
+  return resources::EventProxy<resources::Host>(host_res);
+}
+
 //
 //////////////////////////////////////////////////////////////////////
 //
@@ -318,72 +527,357 @@ RAJA_INLINE resources::EventProxy<resources::Host> forall_impl(resources::Host h
 //////////////////////////////////////////////////////////////////////
 //
 
+namespace internal
+{
+
+///
+/// Ready queue of task graph nodes owned by one thread. The owner pushes
+/// and pops at the back, idle threads steal from the front.
+///
+class TaskGraphQueue
+{
+public:
+  void push(int task)
+  {
+    lock_guard<RAJA::omp::mutex> lock(m_mutex);
+    m_tasks.push_back(task);
+  }
+
+  bool pop(int& task)
+  {
+    lock_guard<RAJA::omp::mutex> lock(m_mutex);
+    if (m_tasks.empty()) return false;
+    task = m_tasks.back();
+    m_tasks.pop_back();
+    return true;
+  }
+
+  bool steal(int& task)
+  {
+    lock_guard<RAJA::omp::mutex> lock(m_mutex);
+    if (m_tasks.empty()) return false;
+    task = m_tasks.front();
+    m_tasks.pop_front();
+    return true;
+  }
+
+private:
+  RAJA::omp::mutex m_mutex;
+  std::deque<int> m_tasks;
+};
+
+///
+/// Execute every node of the index set dependency graph once, calling
+/// task_body(task) only after all of the node's predecessors finished.
+///
+/// Each thread owns a ready queue. A node is pushed onto the queue of the
+/// thread that satisfies its last dependency, so threads never wait on a
+/// blocked node; a thread with an empty queue steals from the others.
+/// Node semaphores are reset after use so the graph can be executed again.
+///
+template <typename... SegTypes, typename TaskBody>
+RAJA_INLINE void forall_taskgraph(const TypedIndexSet<SegTypes...>& iset,
+                                  TaskBody&& task_body)
+{
+  if (!iset.dependencyGraphSet()) {
+    RAJA_ABORT_OR_THROW("RAJA IndexSet dependency graph not set");
+  }
+
+  const int num_tasks = static_cast<int>(iset.getNumDepGraphNodes());
+  if (num_tasks == 0) return;
+
+  const int max_threads = omp_get_max_threads();
+  std::unique_ptr<TaskGraphQueue[]> queues(new TaskGraphQueue[max_threads]);
+  std::atomic<int> num_remaining(num_tasks);
+
+#pragma omp parallel
+  {
+    using RAJA::internal::thread_privatize;
+    auto privatizer = thread_privatize(task_body);
+    auto& body = privatizer.get_priv();
+
+    const int num_threads = omp_get_num_threads();
+    const int thread_id = omp_get_thread_num();
+    TaskGraphQueue& my_queue = queues[thread_id];
+
+    // seed the queues round-robin with the initially ready nodes
+    for (int task = thread_id; task < num_tasks; task += num_threads) {
+      if (iset.getDepGraphNode(task)->semaphoreValue() == 0) {
+        my_queue.push(task);
+      }
+    }
+
+#pragma omp barrier
+
+    while (num_remaining.load() > 0) {
+
+      int task = -1;
+      bool found = my_queue.pop(task);
+      for (int i = 1; !found && i < num_threads; ++i) {
+        found = queues[(thread_id + i) % num_threads].steal(task);
+      }
+
+      if (!found) {
+        std::this_thread::yield();
+        continue;
+      }
+
+      body(task);
+
+      DepGraphNode* node = iset.getDepGraphNode(task);
+      node->reset();
+
+      for (int ii = 0; ii < node->numDepTasks(); ++ii) {
+        const int dep = node->depTaskNum(ii);
+        if (iset.getDepGraphNode(dep)->satisfyOne()) {
+          my_queue.push(dep);
+        }
+      }
+
+      num_remaining.fetch_sub(1);
+    }
+  }
+}
+
+}  // namespace internal
+
 /*!
  ******************************************************************************
  *
- * \brief  Iterate over index set segments using an omp parallel loop and
+ * \brief  Iterate over index set segments using an omp parallel region and
  *         segment dependency graph. Individual segment execution will use
  *         execution policy template parameter.
  *
  *         This method assumes that a task dependency graph has been
- *         properly set up for each segment in the index set.
+ *         properly set up with one node for each segment in the index set.
  *
  ******************************************************************************
  */
+template <typename Func, typename... SegTypes>
+RAJA_INLINE resources::EventProxy<resources::Host> forall_impl(resources::Host host_res,
+                                                               const omp_taskgraph_segit&,
+                                                               const TypedIndexSet<SegTypes...>& iset,
+                                                               Func&& loop_body)
+{
+  if (iset.getNumDepGraphNodes() != static_cast<size_t>(iset.getNumSegments())) {
+    RAJA_ABORT_OR_THROW("RAJA IndexSet dependency graph does not match segments");
+  }
+  internal::forall_taskgraph(iset, loop_body);
+  return resources::EventProxy<resources::Host>(host_res);
+}
 
-/*
- * TODO: Fix this!!!
+/*!
+ ******************************************************************************
+ *
+ * \brief  Iterate over index set segment intervals using an omp parallel
+ *         region and interval dependency graph. Each task executes the
+ *         segments [getSegmentIntervalBegin(i), getSegmentIntervalEnd(i))
+ *         in order.
+ *
+ *         This method assumes that a task dependency graph has been
+ *         properly set up with one node for each segment interval.
+ *
+ ******************************************************************************
  */
+template <typename Func, typename... SegTypes>
+RAJA_INLINE resources::EventProxy<resources::Host> forall_impl(resources::Host host_res,
+                                                               const omp_taskgraph_interval_segit&,
+                                                               const TypedIndexSet<SegTypes...>& iset,
+                                                               Func&& loop_body)
+{
+  const TypedIndexSet<SegTypes...>* iset_ptr = &iset;
+  internal::forall_taskgraph(iset, [=](int interval) {
+    const int seg_end = iset_ptr->getSegmentIntervalEnd(interval);
+    for (int seg = iset_ptr->getSegmentIntervalBegin(interval); seg < seg_end; ++seg) {
+      loop_body(seg);
+    }
+  });
+  return resources::EventProxy<resources::Host>(host_res);
+}
 
-/*
-template <typename SEG_EXEC_POLICY_T, typename LOOP_BODY, typename ...
-SEG_TYPES>
-RAJA_INLINE void forall(
-    ExecPolicy<omp_taskgraph_segit, SEG_EXEC_POLICY_T>,
-    const IndexSet<SEG_TYPES ...>& iset,
-    LOOP_BODY loop_body)
+namespace internal
 {
-  if (!iset.dependencyGraphSet()) {
-    std::cerr << "\n RAJA IndexSet dependency graph not set , "
-              << "FILE: " << __FILE__ << " line: " << __LINE__ << std::endl;
-    RAJA_ABORT_OR_THROW("IndexSet dependency graph");
+
+///
+/// Writes the number of iterations of a segment to len
+///
+struct SegmentLength {
+  template <typename T>
+  RAJA_INLINE void operator()(T const& segment, Index_type& len) const
+  {
+    len = segment.size();
   }
+};
 
-  IndexSet& ncis = (*const_cast<IndexSet*>(&iset));
+///
+/// Runs iterations [offset, offset + length) of a segment with the segment
+/// execution policy
+///
+struct CallForallSlice {
+  Index_type offset;
+  Index_type length;
 
-  int num_seg = ncis.getNumSegments();
+  template <typename T, typename ExecPol, typename Body, typename Res>
+  RAJA_INLINE void operator()(T const& segment, ExecPol, Body body, Res r) const
+  {
+    auto slice = RAJA::make_span(segment.begin() + offset, length);
+    // this is only called inside a region, use impl
+    using policy::sequential::forall_impl;
+    forall_impl(r, ExecPol(), slice, body);
+  }
+};
 
-#pragma omp parallel for schedule(static, 1)
-  for (int isi = 0; isi < num_seg; ++isi) {
-    IndexSetSegInfo* seg_info = ncis.getSegmentInfo(isi);
-    DepGraphNode* task = seg_info->getDepGraphNode();
+///
+/// Same as CallForallSlice, the first iteration of the segment has icount
+/// start
+///
+struct CallForallIcountSlice {
+  Index_type offset;
+  Index_type length;
+  Index_type start;
 
-    task->wait();
+  template <typename T, typename ExecPol, typename Body, typename Res>
+  RAJA_INLINE void operator()(T const& segment, ExecPol, Body body, Res r) const
+  {
+    auto slice = RAJA::make_span(segment.begin() + offset, length);
+    const Index_type icount = start + offset;
+    wrap::forall_Icount(r, ExecPol(), slice, icount, body);
+  }
+};
 
-    executeRangeList_forall<SEG_EXEC_POLICY_T>(seg_info, loop_body);
+///
+/// Split the concatenated iterations of all segments of the index set into
+/// one contiguous block per thread of a single parallel region, and call
+/// slice_body(seg, offset, length) for each part of a segment in the block
+/// of the calling thread. The threads do not synchronize between segments.
+///
+template <typename... SegTypes, typename SliceBody>
+RAJA_INLINE void forall_balanced(const TypedIndexSet<SegTypes...>& iset,
+                                 SliceBody&& slice_body)
+{
+  // offsets[seg] is the position of the first iteration of segment seg in
+  // the concatenated iteration space
+  const int num_segs = static_cast<int>(iset.getNumSegments());
+  std::vector<Index_type> offsets(num_segs + 1, 0);
+  for (int seg = 0; seg < num_segs; ++seg) {
+    Index_type len = 0;
+    iset.segmentCall(seg, SegmentLength{}, len);
+    offsets[seg + 1] = offsets[seg] + len;
+  }
 
-    task->reset();
+  const Index_type total = offsets[num_segs];
+  if (total == 0) return;
 
-    if (task->numDepTasks() != 0) {
-      for (int ii = 0; ii < task->numDepTasks(); ++ii) {
-        // Alternateively, we could get the return value of this call
-        // and actively launch the task if we are the last depedent
-        // task. In that case, we would not need the semaphore spin
-        // loop above.
-        int seg = task->depTaskNum(ii);
-        DepGraphNode* dep = ncis.getSegmentInfo(seg)->getDepGraphNode();
-        dep->satisfyOne();
+  RAJA::region<RAJA::omp_parallel_region>([&]() {
+    using RAJA::internal::thread_privatize;
+    auto privatizer = thread_privatize(slice_body);
+    auto& body = privatizer.get_priv();
+
+    // balanced blocks, the first total % num_threads threads get one more
+    const Index_type num_threads = omp_get_num_threads();
+    const Index_type thread = omp_get_thread_num();
+    const Index_type block = total / num_threads;
+    const Index_type extra = total % num_threads;
+    const Index_type lo = block * thread + (thread < extra ? thread : extra);
+    const Index_type hi = lo + block + (thread < extra ? 1 : 0);
+
+    // last segment starting at or before lo, this skips empty segments
+    int seg = static_cast<int>(
+        std::upper_bound(offsets.begin(), offsets.end(), lo) -
+        offsets.begin()) - 1;
+    for (; seg < num_segs && offsets[seg] < hi; ++seg) {
+      const Index_type first = lo > offsets[seg] ? lo : offsets[seg];
+      const Index_type last = hi < offsets[seg + 1] ? hi : offsets[seg + 1];
+      if (first < last) {
+        body(seg, first - offsets[seg], last - first);
       }
     }
-
-  }  // iterate over segments of index set
+  });
 }
-*/
+
+}  // namespace internal
 
 }  // namespace omp
 
 }  // namespace policy
 
+namespace detail
+{
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  Iterate over the concatenated iterations of all index set segments
+ *         in a single omp parallel region, each thread runs one balanced
+ *         block of them. Individual segment slices are executed with the
+ *         segment execution policy, which runs inside the parallel region on
+ *         a single thread and so must not be an OpenMP policy.
+ *
+ ******************************************************************************
+ */
+template <>
+struct IndexSetForall<policy::omp::omp_parallel_balanced_segit> {
+  template <typename SegmentExecPolicy>
+  static RAJA_INLINE void check_segment_policy()
+  {
+    static_assert(!type_traits::is_openmp_policy<SegmentExecPolicy>::value,
+                  "omp_parallel_balanced_segit runs each segment slice on a "
+                  "single thread of its parallel region, the segment "
+                  "execution policy must not be an OpenMP policy");
+  }
+
+  template <typename Res,
+            typename SegmentExecPolicy,
+            typename LoopBody,
+            typename... SegmentTypes>
+  static RAJA_INLINE resources::EventProxy<Res> exec(
+      Res r,
+      SegmentExecPolicy,
+      const TypedIndexSet<SegmentTypes...>& iset,
+      LoopBody loop_body)
+  {
+    check_segment_policy<SegmentExecPolicy>();
+    const TypedIndexSet<SegmentTypes...>* iset_ptr = &iset;
+    policy::omp::internal::forall_balanced(
+        iset, [=](int seg, Index_type offset, Index_type length) {
+          iset_ptr->segmentCall(seg,
+                                policy::omp::internal::CallForallSlice{offset,
+                                                                       length},
+                                SegmentExecPolicy(),
+                                loop_body,
+                                r);
+        });
+    return resources::EventProxy<Res>(r);
+  }
+
+  template <typename Res,
+            typename SegmentExecPolicy,
+            typename LoopBody,
+            typename... SegmentTypes>
+  static RAJA_INLINE resources::EventProxy<Res> exec_icount(
+      Res r,
+      SegmentExecPolicy,
+      const TypedIndexSet<SegmentTypes...>& iset,
+      LoopBody loop_body)
+  {
+    check_segment_policy<SegmentExecPolicy>();
+    const TypedIndexSet<SegmentTypes...>* iset_ptr = &iset;
+    policy::omp::internal::forall_balanced(
+        iset, [=](int seg, Index_type offset, Index_type length) {
+          iset_ptr->segmentCall(
+              seg,
+              policy::omp::internal::CallForallIcountSlice{
+                  offset, length, iset_ptr->getStartingIcount(seg)},
+              SegmentExecPolicy(),
+              loop_body,
+              r);
+        });
+    return resources::EventProxy<Res>(r);
+  }
+};
+
+}  // namespace detail
+
 }  // namespace RAJA
 
 #endif  // closing endif for if defined(RAJA_ENABLE_OPENMP)
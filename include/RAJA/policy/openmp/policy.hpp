@@ -72,8 +72,16 @@ struct For {
 struct NoWait {
 };
 
+struct Simd {
+};
+
+struct ProcBindSpread {
+};
+
 static constexpr int default_chunk_size = -1;
 
+static constexpr size_t default_scan_tile_bytes = 256 * 1024;
+
 struct Auto : private internal::Schedule<omp_sched_auto, default_chunk_size>{
 };
 
@@ -108,6 +116,17 @@ struct omp_parallel_region
                                             Platform::host> {
 };
 
+///
+///  Struct supporting OpenMP 'parallel proc_bind(spread)' region.
+///
+struct omp_parallel_spread_region
+    : make_policy_pattern_launch_platform_t<Policy::openmp,
+                                            Pattern::region,
+                                            Launch::undefined,
+                                            Platform::host,
+                                            omp::ProcBindSpread> {
+};
+
 
 ///
 ///  Struct supporting OpenMP 'for nowait schedule( )'
@@ -140,6 +159,25 @@ struct omp_for_schedule_exec : make_policy_pattern_launch_platform_t<Policy::ope
 };
 
  
+///
+///  Struct supporting OpenMP 'for simd schedule( )'. Loop bodies that
+///  capture reducers instead run in chunks of SIMD lanes through one copy
+///  of the loop body per lane, as with simd_exec, so reductions vectorize
+///  within a thread.
+///
+template <typename Sched>
+struct omp_for_simd_schedule_exec : make_policy_pattern_launch_platform_t<Policy::openmp,
+                                                              Pattern::forall,
+                                                              Launch::undefined,
+                                                              Platform::host,
+                                                              omp::For,
+                                                              omp::Simd,
+                                                              Sched> {
+    static_assert(std::is_base_of<::RAJA::policy::omp::internal::ScheduleTag, Sched>::value,
+        "Schedule type must be one of: Auto|Runtime|Static|Dynamic|Guided");
+};
+
+ 
 ///
 ///  Internal type aliases supporting 'omp for schedule( )' for specific
 ///  schedule types.
@@ -161,6 +199,9 @@ using omp_for_guided_exec = omp_for_schedule_exec<omp::Guided<ChunkSize>>;
 ///
 using omp_for_runtime_exec = omp_for_schedule_exec<omp::Runtime>;
 
+///
+using omp_for_simd_exec = omp_for_simd_schedule_exec<omp::Static<>>;
+
 
 ///
 ///  Internal type aliases supporting 'omp for schedule( ) nowait' for specific
@@ -211,6 +252,57 @@ using omp_parallel_for_guided_exec = omp_parallel_exec<omp_for_schedule_exec<omp
 ///
 using omp_parallel_for_runtime_exec = omp_parallel_exec<omp_for_schedule_exec<omp::Runtime>>;
 
+///
+///  'omp parallel for simd schedule(static)'
+///
+using omp_parallel_for_simd_exec = omp_parallel_exec<omp_for_simd_exec>;
+
+///
+///  Struct supporting OpenMP 'parallel proc_bind(spread)' region containing
+///  an inner loop execution construct. With OMP_PLACES set, e.g. to cores or
+///  sockets, thread t of a team of a given size runs on the same place in
+///  every such region, so a static schedule gives each iteration to a thread
+///  on the same NUMA domain in every launch.
+///
+template <typename InnerPolicy>
+using omp_parallel_spread_exec = make_policy_pattern_launch_platform_t<Policy::openmp,
+                                            Pattern::forall,
+                                            Launch::undefined,
+                                            Platform::host,
+                                            omp::Parallel,
+                                            omp::ProcBindSpread,
+                                            wrapper<InnerPolicy>>;
+
+///
+///  Same as omp_parallel_for_static_exec with threads bound by
+///  proc_bind(spread). Memory initialized by first_touch_allocate with this
+///  policy is placed on the NUMA domain of the threads that process it in
+///  later launches with this policy.
+///
+template <int ChunkSize = default_chunk_size>
+using omp_parallel_for_numa_exec = omp_parallel_spread_exec<omp_for_schedule_exec<omp::Static<ChunkSize>> >;
+
+
+///
+///  Struct supporting a single-pass OpenMP scan.
+///
+///  The range is split into tiles of roughly TileBytes bytes that threads
+///  claim in order. Each tile is reduced, its aggregate is published, and
+///  its exclusive prefix is resolved by looking back at the status flags
+///  of preceding tiles (decoupled lookback). The tile is then scanned
+///  while still cache-resident, so each element is read from memory once.
+///
+template <size_t TileBytes = default_scan_tile_bytes>
+struct omp_parallel_scan_exec
+    : make_policy_pattern_launch_platform_t<Policy::openmp,
+                                            Pattern::forall,
+                                            Launch::undefined,
+                                            Platform::host,
+                                            omp::Parallel> {
+  static_assert(TileBytes > 0, "TileBytes must be positive");
+  static constexpr size_t tile_bytes = TileBytes;
+};
+
 
 ///
 ///////////////////////////////////////////////////////////////////////
@@ -224,6 +316,22 @@ using omp_parallel_for_segit = omp_parallel_for_exec;
 ///
 using omp_parallel_segit = omp_parallel_for_segit;
 
+///
+/// Run the concatenated iterations of all segments in a single parallel
+/// region. Each thread gets one contiguous block of about len/num_threads
+/// iterations, which may span several segments, and runs its part of each
+/// segment with the segment execution policy; threads do not synchronize
+/// between segments. The segment execution policy must not be an OpenMP
+/// policy.
+///
+struct omp_parallel_balanced_segit
+    : make_policy_pattern_launch_platform_t<Policy::openmp,
+                                            Pattern::forall,
+                                            Launch::undefined,
+                                            Platform::host,
+                                            omp::Parallel> {
+};
+
 
 ///
 ///////////////////////////////////////////////////////////////////////
@@ -255,6 +363,13 @@ struct omp_work : make_policy_pattern_launch_platform_t<Policy::openmp,
                                                         Platform::host> {
 };
 
+///
+struct unordered_omp_loop_iter_flattened
+    : make_policy_pattern_platform_t<Policy::openmp,
+                                     Pattern::workgroup_order,
+                                     Platform::host> {
+};
+
 ///
 ///////////////////////////////////////////////////////////////////////
 ///
@@ -300,6 +415,14 @@ using policy::omp::omp_parallel_for_dynamic_exec;
 using policy::omp::omp_parallel_for_guided_exec;
 ///
 using policy::omp::omp_parallel_for_runtime_exec;
+using policy::omp::omp_parallel_for_numa_exec;
+///
+using policy::omp::omp_parallel_for_simd_exec;
+
+///
+/// Type alias for single-pass (decoupled lookback) omp parallel scan
+///
+using policy::omp::omp_parallel_scan_exec;
 
 ///
 /// Type aliases for omp parallel for iteration over indexset segments
@@ -307,12 +430,14 @@ using policy::omp::omp_parallel_for_runtime_exec;
 using policy::omp::omp_parallel_for_segit;
 ///
 using policy::omp::omp_parallel_segit;
+using policy::omp::omp_parallel_balanced_segit;
 
 ///
 /// Type alias for omp parallel region containing an inner 'omp for' loop 
 /// execution policy. Inner policy types follow.
 ///
 using policy::omp::omp_parallel_exec;
+using policy::omp::omp_parallel_spread_exec;
 
 ///
 /// Type alias for 'omp for' loop execution within an omp_parallel_exec construct
@@ -348,10 +473,19 @@ using policy::omp::omp_for_guided_exec;
 ///
 using policy::omp::omp_for_runtime_exec;
 
+///
+/// Type aliases for 'omp for simd' loop execution within an
+/// omp_parallel_exec construct
+///
+using policy::omp::omp_for_simd_schedule_exec;
+///
+using policy::omp::omp_for_simd_exec;
+
 ///
 /// Type aliases for omp parallel region
 ///
 using policy::omp::omp_parallel_region;
+using policy::omp::omp_parallel_spread_region;
 
 ///
 /// Type aliases for omp reductions
@@ -368,6 +502,9 @@ using policy::omp::omp_synchronize;
 ///
 using policy::omp::omp_work;
 
+///
+using policy::omp::unordered_omp_loop_iter_flattened;
+
 }  // namespace RAJA
 
 #endif
@@ -25,16 +25,21 @@
 
 #if defined(RAJA_ENABLE_OPENMP)
 
+#include <atomic>
 #include <memory>
+#include <new>
 #include <vector>
 
 #include <omp.h>
 
 #include "RAJA/util/types.hpp"
 
+#include "RAJA/internal/MemUtils_CPU.hpp"
+
 #include "RAJA/pattern/detail/reduce.hpp"
 #include "RAJA/pattern/reduce.hpp"
 
+#include "RAJA/policy/atomic_builtin.hpp"
 #include "RAJA/policy/openmp/policy.hpp"
 
 namespace RAJA
@@ -42,25 +47,180 @@ namespace RAJA
 
 namespace detail
 {
+/*!
+ * Per thread partial results of a reduction, each padded to a cache line so
+ * threads combining into neighboring partials do not false share.
+ */
+template <typename T>
+class ReduceOMPSlots
+{
+  struct alignas(64) Slot {
+    T value;
+    //! the only thread that may combine into value without a lock
+    std::atomic<const void*> owner;
+
+    explicit Slot(T val) : value(val), owner(nullptr) {}
+  };
+
+  using deleter = FreeAlignedType<Slot, int>;
+
+  std::unique_ptr<Slot, deleter> m_slots;
+
+public:
+  ReduceOMPSlots(int num_slots, T identity_)
+      : m_slots(allocate_aligned_type<Slot>(alignof(Slot),
+                                            num_slots * sizeof(Slot)),
+                deleter{})
+  {
+    for (int i = 0; i < num_slots; ++i) {
+      new (&m_slots.get()[i]) Slot(identity_);
+      ++m_slots.get_deleter().size;
+    }
+  }
+
+  int size() const { return m_slots.get_deleter().size; }
+
+  T& operator[](int i) { return m_slots.get()[i].value; }
+  const T& operator[](int i) const { return m_slots.get()[i].value; }
+
+  //! address unique to the calling OS thread, identifies slot owners
+  static const void* thread_key()
+  {
+    static thread_local char key;
+    return &key;
+  }
+
+  //! true if the calling thread owns slot i, the first thread to ask
+  //! claims it
+  bool claim(int i)
+  {
+    std::atomic<const void*>& slot_owner = m_slots.get()[i].owner;
+    const void* key = thread_key();
+    const void* owner = slot_owner.load(std::memory_order_relaxed);
+    if (owner == nullptr &&
+        slot_owner.compare_exchange_strong(owner,
+                                           key,
+                                           std::memory_order_relaxed)) {
+      return true;
+    }
+    return owner == key;
+  }
+};
+
+/*!
+ * Reducer for omp_reduce.
+ *
+ * Each thread of the team forked by the thread that owns the reducer
+ * combines its copy into its own padded slot when the copy is destroyed, so
+ * tearing down copies takes no locks. get() combines the slots in a tree.
+ * The team level and ancestor thread number alone do not identify that
+ * team: any other OS thread, e.g. a std::thread or a HostAsync worker, that
+ * opens a region at the same level reports the same ancestor. So the first
+ * OS thread to combine into a slot claims it, and only the claiming thread
+ * writes the slot unlocked. Copies destroyed anywhere else, such as in
+ * nested parallel regions, in teams of other OS threads or outside of a
+ * parallel region, combine under a lock held by the reducer instead of a
+ * lock shared by all reducers.
+ */
 template <typename T, typename Reduce>
 class ReduceOMP
     : public reduce::detail::BaseCombinable<T, Reduce, ReduceOMP<T, Reduce>>
 {
   using Base = reduce::detail::BaseCombinable<T, Reduce, ReduceOMP>;
 
+  struct Partials {
+    ReduceOMPSlots<T> slots;
+    T overflow;
+    int level;
+    int thread;
+    omp_lock_t lock;
+
+    Partials(T identity_)
+        : slots(omp_get_max_threads(), identity_),
+          overflow(identity_),
+          level(omp_get_level()),
+          thread(omp_get_thread_num())
+    {
+      omp_init_lock(&lock);
+    }
+    ~Partials() { omp_destroy_lock(&lock); }
+  };
+
+  //! only the reducer constructed by the user owns the partials,
+  //! copies reach them through Base::parent
+  std::unique_ptr<Partials> partials;
+
+  Partials& root_partials() const
+  {
+    return Base::parent
+               ? *static_cast<const ReduceOMP*>(Base::parent)->partials
+               : *partials;
+  }
+
 public:
-  using Base::Base;
   //! prohibit compiler-generated default ctor
   ReduceOMP() = delete;
 
+  explicit ReduceOMP(T init_val, T identity_ = T())
+      : Base(init_val, identity_)
+  {
+    reset(init_val, identity_);
+  }
+
+  ReduceOMP(const ReduceOMP& other) : Base(other) {}
+
+  void reset(T init_val, T identity_)
+  {
+    Base::reset(init_val, identity_);
+    partials.reset(new Partials(identity_));
+  }
+
   ~ReduceOMP()
   {
-    if (Base::parent) {
-#pragma omp critical(ompReduceCritical)
-      Reduce()(Base::parent->local(), Base::my_data);
+    if (Base::parent && Base::my_data != Base::identity) {
+      Partials& p = root_partials();
+      const int level = omp_get_level();
+      const int id = omp_get_thread_num();
+      if (level == p.level + 1 &&
+          omp_get_ancestor_thread_num(p.level) == p.thread &&
+          id < p.slots.size() && p.slots.claim(id)) {
+        Reduce{}(p.slots[id], Base::my_data);
+      } else {
+        omp_set_lock(&p.lock);
+        Reduce{}(p.overflow, Base::my_data);
+        omp_unset_lock(&p.lock);
+      }
       Base::my_data = Base::identity;
     }
   }
+
+  T get_combined() const
+  {
+    if (Base::parent) {
+      return static_cast<const ReduceOMP*>(Base::parent)->get_combined();
+    }
+
+    // pairwise combine the per thread partials
+    std::vector<T> values;
+    values.reserve(partials->slots.size());
+    for (int i = 0; i < partials->slots.size(); ++i) {
+      values.push_back(partials->slots[i]);
+    }
+    for (size_t stride = 1; stride < values.size(); stride *= 2) {
+      for (size_t i = 0; i + stride < values.size(); i += 2 * stride) {
+        Reduce{}(values[i], values[i + stride]);
+      }
+    }
+
+    T res = Base::my_data;
+    if (!values.empty()) {
+      Reduce{}(res, values[0]);
+    }
+    omp_set_lock(&partials->lock);
+    Reduce{}(res, partials->overflow);
+    omp_unset_lock(&partials->lock);
+    return res;
+  }
 };
 
 }  // namespace detail
@@ -81,7 +241,7 @@ class ReduceOMPOrdered
           BaseCombinable<T, Reduce, ReduceOMPOrdered<T, Reduce>>
 {
   using Base = reduce::detail::BaseCombinable<T, Reduce, ReduceOMPOrdered>;
-  std::shared_ptr<std::vector<T>> data;
+  std::shared_ptr<ReduceOMPSlots<T>> data;
 
 public:
   ReduceOMPOrdered() { reset(T(), T()); }
@@ -95,8 +255,8 @@ public:
   void reset(T init_val, T identity_)
   {
     Base::reset(init_val, identity_);
-    data = std::shared_ptr<std::vector<T>>(
-        std::make_shared<std::vector<T>>(omp_get_max_threads(), identity_));
+    data = std::make_shared<ReduceOMPSlots<T>>(omp_get_max_threads(),
+                                               identity_);
   }
 
   ~ReduceOMPOrdered()
@@ -113,7 +273,7 @@ public:
     }
 
     T res = Base::identity;
-    for (size_t i = 0; i < data->size(); ++i) {
+    for (int i = 0; i < data->size(); ++i) {
       Reduce{}(res, (*data)[i]);
     }
     return res;
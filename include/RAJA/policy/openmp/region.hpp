@@ -46,6 +46,31 @@ RAJA_INLINE void region_impl(const omp_parallel_region &, Func &&body)
     }
 }
 
+/*!
+ * \brief RAJA::region implementation for OpenMP with threads bound to
+ *        places spread over the machine.
+ *
+ * Generates an OpenMP parallel region with proc_bind(spread), or a plain
+ * parallel region for OpenMP versions before 4.0.
+ *
+ */
+
+template <typename Func>
+RAJA_INLINE void region_impl(const omp_parallel_spread_region &, Func &&body)
+{
+
+#if _OPENMP >= 201307
+#pragma omp parallel proc_bind(spread)
+#else
+#pragma omp parallel
+#endif
+    { // curly brackets to ensure body() is encapsulated in omp parallel region
+      //thread private copy of body
+      auto loopbody = body;
+      loopbody();
+    }
+}
+
 }  // namespace omp
 
 }  // namespace policy
@@ -21,8 +21,11 @@
 #include "RAJA/config.hpp"
 
 #include <algorithm>
+#include <atomic>
 #include <functional>
 #include <iterator>
+#include <memory>
+#include <thread>
 #include <type_traits>
 #include <vector>
 
@@ -34,6 +37,106 @@
 
 namespace RAJA
 {
+namespace detail
+{
+namespace openmp
+{
+
+/*!
+    \brief status of a tile in a single-pass lookback scan
+*/
+enum scan_tile_status : int {
+  scan_tile_invalid = 0,
+  scan_tile_aggregate = 1,
+  scan_tile_prefix = 2
+};
+
+/*!
+    \brief number of elements of type Value in a tile of TileBytes bytes
+*/
+template <typename Value, typename DistanceT>
+RAJA_INLINE DistanceT scan_tile_size(size_t tile_bytes)
+{
+  return static_cast<DistanceT>(
+      std::max(tile_bytes / sizeof(Value), static_cast<size_t>(1)));
+}
+
+/*!
+    \brief single-pass tiled scan driver using decoupled lookback
+
+    Tiles are claimed in increasing order through an atomic counter so every
+    tile a thread looks back at is owned by a running thread. For each tile,
+    tile_reduce(tb, te) returns the tile aggregate, which is published before
+    the exclusive prefix is resolved from the preceding tiles. The tile is
+    then scanned with tile_scan(tb, te, prefix) while it is cache-resident.
+*/
+template <typename Value,
+          typename DistanceT,
+          typename BinFn,
+          typename TileReduce,
+          typename TileScan>
+RAJA_INLINE void lookback_scan(DistanceT n,
+                               DistanceT tile_size,
+                               BinFn f,
+                               TileReduce&& tile_reduce,
+                               TileScan&& tile_scan)
+{
+  const DistanceT num_tiles = (n + tile_size - 1) / tile_size;
+  const int p0 =
+      std::min(num_tiles, static_cast<DistanceT>(omp_get_max_threads()));
+
+  ::std::vector<Value> aggregates(num_tiles, BinFn::identity());
+  ::std::vector<Value> prefixes(num_tiles, BinFn::identity());
+  ::std::unique_ptr<::std::atomic<int>[]> status(
+      new ::std::atomic<int>[num_tiles]);
+  for (DistanceT t = 0; t < num_tiles; ++t) {
+    status[t].store(scan_tile_invalid, ::std::memory_order_relaxed);
+  }
+  ::std::atomic<DistanceT> next_tile{0};
+
+#pragma omp parallel num_threads(p0)
+  {
+    for (DistanceT t = next_tile.fetch_add(1, ::std::memory_order_relaxed);
+         t < num_tiles;
+         t = next_tile.fetch_add(1, ::std::memory_order_relaxed)) {
+      const DistanceT tb = t * tile_size;
+      const DistanceT te = std::min(tb + tile_size, n);
+
+      const Value agg = tile_reduce(tb, te);
+      Value prefix = BinFn::identity();
+
+      if (t == 0) {
+        prefixes[t] = agg;
+        status[t].store(scan_tile_prefix, ::std::memory_order_release);
+      } else {
+        aggregates[t] = agg;
+        status[t].store(scan_tile_aggregate, ::std::memory_order_release);
+
+        for (DistanceT j = t - 1;; --j) {
+          int s = status[j].load(::std::memory_order_acquire);
+          while (s == scan_tile_invalid) {
+            ::std::this_thread::yield();
+            s = status[j].load(::std::memory_order_acquire);
+          }
+          if (s == scan_tile_prefix) {
+            prefix = f(prefixes[j], prefix);
+            break;
+          }
+          prefix = f(aggregates[j], prefix);
+        }
+
+        prefixes[t] = f(prefix, agg);
+        status[t].store(scan_tile_prefix, ::std::memory_order_release);
+      }
+
+      tile_scan(tb, te, prefix);
+    }
+  }
+}
+
+}  // namespace openmp
+}  // namespace detail
+
 namespace impl
 {
 namespace scan
@@ -179,6 +282,303 @@ exclusive(
   return exclusive_inplace(host_res, exec, out, out + distance(begin, end), f, v);
 }
 
+/*!
+        \brief explicit inclusive segmented scan given input range, segment
+   head predicate, output, and function
+
+   Each thread scans its chunk independently, restarting at segment heads.
+   Only the elements before the first head of a chunk are then fixed up
+   with the carry from the preceding chunks.
+*/
+template <typename Policy,
+          typename HeadFn,
+          typename Iter,
+          typename OutIter,
+          typename BinFn>
+RAJA_INLINE
+concepts::enable_if_t<resources::EventProxy<resources::Host>,
+                      type_traits::is_openmp_policy<Policy>>
+inclusive_segmented(
+    resources::Host host_res,
+    const Policy&,
+    HeadFn is_head,
+    Iter begin,
+    Iter end,
+    OutIter out,
+    BinFn f)
+{
+  using std::distance;
+  using RAJA::detail::firstIndex;
+  using Value = typename ::std::iterator_traits<OutIter>::value_type;
+  const auto n = distance(begin, end);
+  using DistanceT = typename std::remove_const<decltype(n)>::type;
+  const int p0 = std::min(n, static_cast<DistanceT>(omp_get_max_threads()));
+  ::std::vector<Value> sums(p0, BinFn::identity());
+  ::std::vector<char> heads(p0, 0);
+#pragma omp parallel num_threads(p0)
+  {
+    const int p = omp_get_num_threads();
+    const int pid = omp_get_thread_num();
+    const DistanceT idx_begin = firstIndex(n, p, pid);
+    const DistanceT idx_end = firstIndex(n, p, pid + 1);
+    DistanceT first_head = idx_end;
+    if (idx_begin != idx_end) {
+      Value agg = BinFn::identity();
+      for (auto i = idx_begin; i < idx_end; ++i) {
+        auto t = begin[i];
+        if (is_head(i)) {
+          first_head = std::min(first_head, i);
+          agg = t;
+        } else {
+          agg = f(agg, t);
+        }
+        out[i] = agg;
+      }
+      sums[pid] = agg;
+      heads[pid] = (first_head != idx_end);
+    }
+#pragma omp barrier
+    Value carry = BinFn::identity();
+    for (int c = 0; c < pid; ++c) {
+      carry = heads[c] ? sums[c] : f(carry, sums[c]);
+    }
+    for (auto i = idx_begin; i < first_head; ++i) {
+      out[i] = f(carry, out[i]);
+    }
+  }
+
+  return resources::EventProxy<resources::Host>(host_res);
+}
+
+/*!
+        \brief explicit exclusive segmented scan given input range, segment
+   head predicate, output, function, and initial value
+*/
+template <typename Policy,
+          typename HeadFn,
+          typename Iter,
+          typename OutIter,
+          typename BinFn,
+          typename ValueT>
+RAJA_INLINE
+concepts::enable_if_t<resources::EventProxy<resources::Host>,
+                      type_traits::is_openmp_policy<Policy>>
+exclusive_segmented(
+    resources::Host host_res,
+    const Policy&,
+    HeadFn is_head,
+    Iter begin,
+    Iter end,
+    OutIter out,
+    BinFn f,
+    ValueT v)
+{
+  using std::distance;
+  using RAJA::detail::firstIndex;
+  using Value = typename ::std::iterator_traits<OutIter>::value_type;
+  const auto n = distance(begin, end);
+  using DistanceT = typename std::remove_const<decltype(n)>::type;
+  const int p0 = std::min(n, static_cast<DistanceT>(omp_get_max_threads()));
+  ::std::vector<Value> sums(p0, BinFn::identity());
+  ::std::vector<char> heads(p0, 0);
+#pragma omp parallel num_threads(p0)
+  {
+    const int p = omp_get_num_threads();
+    const int pid = omp_get_thread_num();
+    const DistanceT idx_begin = firstIndex(n, p, pid);
+    const DistanceT idx_end = firstIndex(n, p, pid + 1);
+    DistanceT first_head = idx_end;
+    if (idx_begin != idx_end) {
+      Value agg = BinFn::identity();
+      for (auto i = idx_begin; i < idx_end; ++i) {
+        auto t = begin[i];
+        if (is_head(i)) {
+          first_head = std::min(first_head, i);
+          agg = v;
+        }
+        out[i] = agg;
+        agg = f(agg, t);
+      }
+      sums[pid] = agg;
+      heads[pid] = (first_head != idx_end);
+    }
+#pragma omp barrier
+    Value carry = BinFn::identity();
+    for (int c = 0; c < pid; ++c) {
+      carry = heads[c] ? sums[c] : f(carry, sums[c]);
+    }
+    for (auto i = idx_begin; i < first_head; ++i) {
+      out[i] = f(carry, out[i]);
+    }
+  }
+
+  return resources::EventProxy<resources::Host>(host_res);
+}
+
+/*!
+        \brief single-pass inclusive inplace scan given range and function
+*/
+template <size_t TileBytes, typename Iter, typename BinFn>
+RAJA_INLINE resources::EventProxy<resources::Host> inclusive_inplace(
+    resources::Host host_res,
+    const omp_parallel_scan_exec<TileBytes>&,
+    Iter begin,
+    Iter end,
+    BinFn f)
+{
+  using std::distance;
+  using Value = typename ::std::iterator_traits<Iter>::value_type;
+  const auto n = distance(begin, end);
+  using DistanceT = typename std::remove_const<decltype(n)>::type;
+
+  RAJA::detail::openmp::lookback_scan<Value>(
+      n,
+      RAJA::detail::openmp::scan_tile_size<Value, DistanceT>(TileBytes),
+      f,
+      [=](DistanceT tb, DistanceT te) {
+        Value agg = begin[tb];
+        for (DistanceT i = tb + 1; i < te; ++i) {
+          agg = f(agg, begin[i]);
+        }
+        return agg;
+      },
+      [=](DistanceT tb, DistanceT te, Value prefix) {
+        Value agg = prefix;
+        for (DistanceT i = tb; i < te; ++i) {
+          agg = f(agg, begin[i]);
+          begin[i] = agg;
+        }
+      });
+
+  return resources::EventProxy<resources::Host>(host_res);
+}
+
+/*!
+        \brief single-pass exclusive inplace scan given range, function, and
+   initial value
+*/
+template <size_t TileBytes, typename Iter, typename BinFn, typename ValueT>
+RAJA_INLINE resources::EventProxy<resources::Host> exclusive_inplace(
+    resources::Host host_res,
+    const omp_parallel_scan_exec<TileBytes>&,
+    Iter begin,
+    Iter end,
+    BinFn f,
+    ValueT v)
+{
+  using std::distance;
+  using Value = typename ::std::iterator_traits<Iter>::value_type;
+  const auto n = distance(begin, end);
+  using DistanceT = typename std::remove_const<decltype(n)>::type;
+
+  RAJA::detail::openmp::lookback_scan<Value>(
+      n,
+      RAJA::detail::openmp::scan_tile_size<Value, DistanceT>(TileBytes),
+      f,
+      [=](DistanceT tb, DistanceT te) {
+        Value agg = begin[tb];
+        for (DistanceT i = tb + 1; i < te; ++i) {
+          agg = f(agg, begin[i]);
+        }
+        return agg;
+      },
+      [=](DistanceT tb, DistanceT te, Value prefix) {
+        Value agg = f(v, prefix);
+        for (DistanceT i = tb; i < te; ++i) {
+          Value t = begin[i];
+          begin[i] = agg;
+          agg = f(agg, t);
+        }
+      });
+
+  return resources::EventProxy<resources::Host>(host_res);
+}
+
+/*!
+        \brief single-pass inclusive scan given input range, output, and
+   function
+*/
+template <size_t TileBytes, typename Iter, typename OutIter, typename BinFn>
+RAJA_INLINE resources::EventProxy<resources::Host> inclusive(
+    resources::Host host_res,
+    const omp_parallel_scan_exec<TileBytes>&,
+    Iter begin,
+    Iter end,
+    OutIter out,
+    BinFn f)
+{
+  using std::distance;
+  using Value = typename ::std::iterator_traits<OutIter>::value_type;
+  const auto n = distance(begin, end);
+  using DistanceT = typename std::remove_const<decltype(n)>::type;
+
+  RAJA::detail::openmp::lookback_scan<Value>(
+      n,
+      RAJA::detail::openmp::scan_tile_size<Value, DistanceT>(TileBytes),
+      f,
+      [=](DistanceT tb, DistanceT te) {
+        Value agg = begin[tb];
+        for (DistanceT i = tb + 1; i < te; ++i) {
+          agg = f(agg, begin[i]);
+        }
+        return agg;
+      },
+      [=](DistanceT tb, DistanceT te, Value prefix) {
+        Value agg = prefix;
+        for (DistanceT i = tb; i < te; ++i) {
+          agg = f(agg, begin[i]);
+          out[i] = agg;
+        }
+      });
+
+  return resources::EventProxy<resources::Host>(host_res);
+}
+
+/*!
+        \brief single-pass exclusive scan given input range, output, function,
+   and initial value
+*/
+template <size_t TileBytes,
+          typename Iter,
+          typename OutIter,
+          typename BinFn,
+          typename ValueT>
+RAJA_INLINE resources::EventProxy<resources::Host> exclusive(
+    resources::Host host_res,
+    const omp_parallel_scan_exec<TileBytes>&,
+    Iter begin,
+    Iter end,
+    OutIter out,
+    BinFn f,
+    ValueT v)
+{
+  using std::distance;
+  using Value = typename ::std::iterator_traits<OutIter>::value_type;
+  const auto n = distance(begin, end);
+  using DistanceT = typename std::remove_const<decltype(n)>::type;
+
+  RAJA::detail::openmp::lookback_scan<Value>(
+      n,
+      RAJA::detail::openmp::scan_tile_size<Value, DistanceT>(TileBytes),
+      f,
+      [=](DistanceT tb, DistanceT te) {
+        Value agg = begin[tb];
+        for (DistanceT i = tb + 1; i < te; ++i) {
+          agg = f(agg, begin[i]);
+        }
+        return agg;
+      },
+      [=](DistanceT tb, DistanceT te, Value prefix) {
+        Value agg = f(v, prefix);
+        for (DistanceT i = tb; i < te; ++i) {
+          out[i] = agg;
+          agg = f(agg, begin[i]);
+        }
+      });
+
+  return resources::EventProxy<resources::Host>(host_res);
+}
+
 }  // namespace scan
 
 }  // namespace impl
@@ -21,8 +21,11 @@
 #include "RAJA/config.hpp"
 
 #include <algorithm>
+#include <climits>
 #include <functional>
 #include <iterator>
+#include <memory>
+#include <vector>
 
 #include <omp.h>
 
@@ -30,6 +33,8 @@
 
 #include "RAJA/util/concepts.hpp"
 
+#include "RAJA/internal/MemUtils_CPU.hpp"
+
 #include "RAJA/policy/openmp/policy.hpp"
 #include "RAJA/policy/loop/sort.hpp"
 #include "RAJA/pattern/detail/algorithm.hpp"
@@ -49,6 +54,9 @@ namespace openmp
 // this number is arbitrary
 constexpr int get_min_iterates_per_task() { return 128; }
 
+// radix sort passes cost a histogram of radix_sort_buckets per thread
+constexpr int get_min_iterates_per_radix_thread() { return 4096; }
+
 #ifdef RAJA_ENABLE_OPENMP_TASK
 /*!
         \brief sort given range using sorter and comparison function
@@ -88,47 +96,161 @@ inline void sort_task(Sorter sorter,
 
 #else
 
+/*!
+        \brief find the split of a merge of sorted ranges [a, a+a_len) and
+               [b, b+b_len) such that the first k merged items come from
+               [a, a+i) and [b, b+(k-i)); returns i. Ties take from a first
+               so the merge is stable.
+*/
+template <typename Iter1, typename Iter2, typename Compare>
+inline RAJA::detail::IterDiff<Iter1>
+merge_path_split(Iter1 a,
+                 RAJA::detail::IterDiff<Iter1> a_len,
+                 Iter2 b,
+                 RAJA::detail::IterDiff<Iter1> b_len,
+                 RAJA::detail::IterDiff<Iter1> k,
+                 Compare comp)
+{
+  using diff_type = RAJA::detail::IterDiff<Iter1>;
+
+  diff_type lo = std::max(k - b_len, diff_type(0));
+  diff_type hi = std::min(k, a_len);
+
+  while (lo < hi) {
+    const diff_type i = lo + (hi - lo) / 2;
+    if (!comp(b[k - i - 1], a[i])) {
+      lo = i + 1;
+    } else {
+      hi = i;
+    }
+  }
+  return lo;
+}
+
+/*!
+        \brief cooperatively merge the sorted ranges [src+i_begin, src+i_middle)
+               and [src+i_middle, src+i_end) into dst with group_size
+               threads, this thread writing the part of the output given
+               by its rank in the group
+*/
+template <typename SrcIter, typename DstIter, typename Compare>
+inline void merge_path_merge(SrcIter src,
+                             DstIter dst,
+                             RAJA::detail::IterDiff<SrcIter> i_begin,
+                             RAJA::detail::IterDiff<SrcIter> i_middle,
+                             RAJA::detail::IterDiff<SrcIter> i_end,
+                             RAJA::detail::IterDiff<SrcIter> group_size,
+                             RAJA::detail::IterDiff<SrcIter> rank,
+                             Compare comp)
+{
+  using RAJA::detail::firstIndex;
+  using diff_type = RAJA::detail::IterDiff<SrcIter>;
+
+  const diff_type a_len = i_middle - i_begin;
+  const diff_type b_len = i_end - i_middle;
+  const diff_type len = a_len + b_len;
+
+  const diff_type k_begin = firstIndex(len, group_size, rank);
+  const diff_type k_end   = firstIndex(len, group_size, rank + 1);
+
+  const diff_type a_begin = merge_path_split(src + i_begin, a_len,
+                                             src + i_middle, b_len,
+                                             k_begin, comp);
+  const diff_type a_end   = merge_path_split(src + i_begin, a_len,
+                                             src + i_middle, b_len,
+                                             k_end, comp);
+
+  SrcIter a     = src + i_begin + a_begin;
+  SrcIter a_last = src + i_begin + a_end;
+  SrcIter b     = src + i_middle + (k_begin - a_begin);
+  SrcIter b_last = src + i_middle + (k_end - a_end);
+  DstIter out   = dst + i_begin + k_begin;
+
+  while (a != a_last && b != b_last) {
+    if (comp(*b, *a)) {
+      *out = std::move(*b);
+      ++b;
+    } else {
+      *out = std::move(*a);
+      ++a;
+    }
+    ++out;
+  }
+  out = std::move(a, a_last, out);
+  std::move(b, b_last, out);
+}
+
 /*!
         \brief sort given range using sorter and comparison function
                by manually assigning work to threads
+
+        Each thread sorts its chunk, then chunks are merged pairwise in
+        log(P) rounds. In each round every thread takes part in one of the
+        merges, splitting the merged output evenly with merge path, so no
+        thread idles. Merges ping-pong between the range and buf, which must
+        hold n elements of value_type.
 */
 template <typename Sorter, typename Iter, typename Compare>
 inline void sort_parallel_region(Sorter sorter,
                                  Iter begin,
                                  RAJA::detail::IterDiff<Iter> n,
+                                 RAJA::detail::IterVal<Iter>* buf,
                                  Compare comp)
 {
   using RAJA::detail::firstIndex;
   using diff_type = RAJA::detail::IterDiff<Iter>;
+  using value_type = RAJA::detail::IterVal<Iter>;
 
   const diff_type num_threads = omp_get_num_threads();
 
   const diff_type thread_id = omp_get_thread_num();
 
   const diff_type i_begin = firstIndex(n, num_threads, thread_id);
-  {
-    const diff_type i_end = firstIndex(n, num_threads, thread_id + 1);
+  const diff_type i_end   = firstIndex(n, num_threads, thread_id + 1);
 
-    // this thread sorts range [i_begin, i_end)
-    sorter(begin + i_begin, begin + i_end, comp);
+  // this thread sorts range [i_begin, i_end)
+  sorter(begin + i_begin, begin + i_end, comp);
+
+  if (num_threads == 1) {
+    return;
   }
 
-  // hierarchically merge ranges
+  // move construct this thread's sorted range into the buffer
+  for (diff_type i = i_begin; i < i_end; ++i) {
+    new(&buf[i]) value_type(std::move(begin[i]));
+  }
+
+  // hierarchically merge ranges, alternating between buf and begin
+  bool in_buf = true;
   for (diff_type middle_offset = 1; middle_offset < num_threads; middle_offset *= 2) {
 
-    diff_type end_offset = 2*middle_offset;
+    const diff_type end_offset = 2*middle_offset;
 
-    const diff_type i_middle = firstIndex(n, num_threads, std::min(thread_id + middle_offset, num_threads));
-    const diff_type i_end    = firstIndex(n, num_threads, std::min(thread_id + end_offset,    num_threads));
+    const diff_type group_begin = thread_id - thread_id % end_offset;
+    const diff_type group_size  = std::min(end_offset, num_threads - group_begin);
 
-#pragma omp barrier
+    const diff_type g_begin  = firstIndex(n, num_threads, group_begin);
+    const diff_type g_middle = firstIndex(n, num_threads, std::min(group_begin + middle_offset, num_threads));
+    const diff_type g_end    = firstIndex(n, num_threads, group_begin + group_size);
 
-    if (thread_id % end_offset == 0) {
+#pragma omp barrier
 
-      // this thread merges ranges [i_begin, i_middle) and [i_middle, i_end)
-      //std::inplace_merge(begin + i_begin, begin + i_middle, begin + i_end, comp);
-      RAJA::detail::inplace_merge(begin + i_begin, begin + i_middle, begin + i_end, comp);
+    // the threads of this group merge [g_begin, g_middle) and [g_middle, g_end)
+    if (in_buf) {
+      merge_path_merge(buf, begin, g_begin, g_middle, g_end,
+                       group_size, thread_id - group_begin, comp);
+    } else {
+      merge_path_merge(begin, buf, g_begin, g_middle, g_end,
+                       group_size, thread_id - group_begin, comp);
     }
+    in_buf = !in_buf;
+  }
+
+  if (in_buf) {
+
+#pragma omp barrier
+
+    std::move(buf + i_begin, buf + i_end, begin + i_begin);
   }
 }
 
@@ -173,17 +295,203 @@ void sort(Sorter sorter,
 
 #else
 
+    using value_type = RAJA::detail::IterVal<Iter>;
+
     const diff_type requested_num_threads = std::min((n+min_iterates_per_task-1)/min_iterates_per_task, max_threads);
 
+    // a region that runs on one thread needs no merge buffer
+    if (requested_num_threads == 1 ||
+        omp_get_active_level() >= omp_get_max_active_levels()) {
+      sorter(begin, end, comp);
+      return;
+    }
+
+    // Manage the lifetime of the merge buffer and objects constructed in it
+    using buf_deleter_type = RAJA::FreeAlignedType<value_type, diff_type>;
+    buf_deleter_type buf_deleter;
+
+    std::unique_ptr<value_type, buf_deleter_type&> merge_buf(
+        RAJA::allocate_aligned_type<value_type>( RAJA::DATA_ALIGN, n * sizeof(value_type) ),
+        buf_deleter);
+
+    // check memory allocation worked
+    if (merge_buf.get() == nullptr) {
+      RAJA_ABORT_OR_THROW( "openmp sort temporary memory allocation failed" );
+    }
+
+    int num_threads = 1;
+
 #pragma omp parallel num_threads(static_cast<int>(requested_num_threads))
     {
-      sort_parallel_region(sorter, begin, n, comp);
+#pragma omp master
+      num_threads = omp_get_num_threads();
+
+      sort_parallel_region(sorter, begin, n, merge_buf.get(), comp);
+    }
+
+    // every element of the buffer was constructed if more than one thread ran
+    if (num_threads > 1) {
+      buf_deleter.size = n;
     }
 
 #endif
   }
 }
 
+/*!
+        \brief stable LSD radix sort of keys and optional values
+
+        Each thread histograms the digit of its chunk of the current
+        arrangement, then scatters its chunk to offsets given by the
+        digits before it across all threads and the same digit in earlier
+        threads, so the order of equal digits is preserved.
+*/
+template <bool Descending, typename KeyIter, typename ValIter>
+inline
+void radix_sort_pairs(KeyIter keys,
+                      KeyIter keys_end,
+                      ValIter vals)
+{
+  using diff_type = RAJA::detail::IterDiff<KeyIter>;
+  using key_type = RAJA::detail::IterVal<KeyIter>;
+  using bits_type = typename RAJA::detail::radix_key<key_type>::type;
+
+  constexpr int num_passes = sizeof(bits_type) * CHAR_BIT / RAJA::detail::radix_sort_digit_bits();
+  constexpr int num_buckets = RAJA::detail::radix_sort_buckets();
+
+  constexpr diff_type min_iterates_per_thread = get_min_iterates_per_radix_thread();
+
+  const diff_type n = keys_end - keys;
+
+  const diff_type max_threads = omp_get_max_threads();
+
+  const diff_type requested_num_threads = std::min(n/min_iterates_per_thread, max_threads);
+
+  if (requested_num_threads < 2) {
+    RAJA::detail::radix_sort_pairs<Descending>(keys, keys_end, vals);
+    return;
+  }
+
+  // per thread histograms of all digits of the initial arrangement
+  // followed by per thread histograms of the digit of the current pass
+  std::vector<diff_type> all_counts(requested_num_threads * num_passes * num_buckets, 0);
+  std::vector<diff_type> pass_counts(requested_num_threads * num_buckets, 0);
+
+  std::unique_ptr<key_type[]> key_buf(new key_type[n]);
+  RAJA::detail::radix_vals_storage<ValIter> val_storage(n);
+  auto val_buf = val_storage.get();
+
+  bool constructed = false;
+
+#pragma omp parallel num_threads(static_cast<int>(requested_num_threads))
+  {
+    const diff_type num_threads = omp_get_num_threads();
+    const diff_type thread = omp_get_thread_num();
+
+    const diff_type chunk_begin = (n * thread) / num_threads;
+    const diff_type chunk_end = (n * (thread + 1)) / num_threads;
+
+    diff_type* my_all_counts = all_counts.data() + thread * num_passes * num_buckets;
+    for (diff_type i = chunk_begin; i < chunk_end; ++i) {
+      const bits_type bits = RAJA::detail::radix_bits<Descending>(keys[i]);
+      for (int pass = 0; pass < num_passes; ++pass) {
+        ++my_all_counts[pass * num_buckets + RAJA::detail::radix_digit(bits, pass)];
+      }
+    }
+
+#pragma omp barrier
+
+    bool in_buf = false;
+    bool my_constructed = false;
+    for (int pass = 0; pass < num_passes; ++pass) {
+
+      // skip passes where every key has the same digit
+      diff_type totals[num_buckets];
+      bool trivial = false;
+      for (int d = 0; d < num_buckets; ++d) {
+        totals[d] = 0;
+        for (diff_type t = 0; t < num_threads; ++t) {
+          totals[d] += all_counts[(t * num_passes + pass) * num_buckets + d];
+        }
+        trivial = trivial || (totals[d] == n);
+      }
+      if (trivial) {
+        continue;
+      }
+
+      diff_type* my_pass_counts = pass_counts.data() + thread * num_buckets;
+      for (int d = 0; d < num_buckets; ++d) {
+        my_pass_counts[d] = 0;
+      }
+      if (in_buf) {
+        for (diff_type i = chunk_begin; i < chunk_end; ++i) {
+          ++my_pass_counts[RAJA::detail::radix_digit(
+              RAJA::detail::radix_bits<Descending>(key_buf[i]), pass)];
+        }
+      } else {
+        for (diff_type i = chunk_begin; i < chunk_end; ++i) {
+          ++my_pass_counts[RAJA::detail::radix_digit(
+              RAJA::detail::radix_bits<Descending>(keys[i]), pass)];
+        }
+      }
+
+#pragma omp barrier
+
+      diff_type offsets[num_buckets];
+      diff_type sum = 0;
+      for (int d = 0; d < num_buckets; ++d) {
+        offsets[d] = sum;
+        for (diff_type t = 0; t < thread; ++t) {
+          offsets[d] += pass_counts[t * num_buckets + d];
+        }
+        sum += totals[d];
+      }
+
+      if (in_buf) {
+        for (diff_type i = chunk_begin; i < chunk_end; ++i) {
+          const diff_type j = offsets[RAJA::detail::radix_digit(
+              RAJA::detail::radix_bits<Descending>(key_buf[i]), pass)]++;
+          keys[j] = key_buf[i];
+          vals[j] = std::move(val_buf[i]);
+        }
+      } else if (my_constructed) {
+        for (diff_type i = chunk_begin; i < chunk_end; ++i) {
+          const diff_type j = offsets[RAJA::detail::radix_digit(
+              RAJA::detail::radix_bits<Descending>(keys[i]), pass)]++;
+          key_buf[j] = keys[i];
+          val_buf[j] = std::move(vals[i]);
+        }
+      } else {
+        for (diff_type i = chunk_begin; i < chunk_end; ++i) {
+          const diff_type j = offsets[RAJA::detail::radix_digit(
+              RAJA::detail::radix_bits<Descending>(keys[i]), pass)]++;
+          key_buf[j] = keys[i];
+          RAJA::detail::radix_construct(val_storage.construct_ptr(j), std::move(vals[i]));
+        }
+        my_constructed = true;
+      }
+      in_buf = !in_buf;
+
+#pragma omp barrier
+    }
+
+    if (in_buf) {
+      for (diff_type i = chunk_begin; i < chunk_end; ++i) {
+        keys[i] = key_buf[i];
+        vals[i] = std::move(val_buf[i]);
+      }
+    }
+
+#pragma omp master
+    constructed = my_constructed;
+  }
+
+  // every element of the buffer was constructed by the first pass
+  if (constructed) {
+    val_storage.set_constructed(n);
+  }
+}
+
 } // namespace openmp
 
 } // namespace detail
@@ -193,7 +501,9 @@ void sort(Sorter sorter,
 */
 template <typename ExecPolicy, typename Iter, typename Compare>
 concepts::enable_if_t<resources::EventProxy<resources::Host>,
-                      type_traits::is_openmp_policy<ExecPolicy>>
+                      type_traits::is_openmp_policy<ExecPolicy>,
+                      concepts::negate<RAJA::detail::is_radix_sortable<
+                          RAJA::detail::IterVal<Iter>, Compare>>>
 unstable(
     resources::Host host_res,
     const ExecPolicy&,
@@ -211,7 +521,9 @@ unstable(
 */
 template <typename ExecPolicy, typename Iter, typename Compare>
 concepts::enable_if_t<resources::EventProxy<resources::Host>,
-                      type_traits::is_openmp_policy<ExecPolicy>>
+                      type_traits::is_openmp_policy<ExecPolicy>,
+                      concepts::negate<RAJA::detail::is_radix_sortable<
+                          RAJA::detail::IterVal<Iter>, Compare>>>
 stable(
     resources::Host host_res,
     const ExecPolicy&,
@@ -229,7 +541,9 @@ stable(
 */
 template <typename ExecPolicy, typename KeyIter, typename ValIter, typename Compare>
 concepts::enable_if_t<resources::EventProxy<resources::Host>,
-                      type_traits::is_openmp_policy<ExecPolicy>>
+                      type_traits::is_openmp_policy<ExecPolicy>,
+                      concepts::negate<RAJA::detail::is_radix_sortable<
+                          RAJA::detail::IterVal<KeyIter>, Compare>>>
 unstable_pairs(
     resources::Host host_res,
     const ExecPolicy&,
@@ -251,7 +565,9 @@ unstable_pairs(
 */
 template <typename ExecPolicy, typename KeyIter, typename ValIter, typename Compare>
 concepts::enable_if_t<resources::EventProxy<resources::Host>,
-                      type_traits::is_openmp_policy<ExecPolicy>>
+                      type_traits::is_openmp_policy<ExecPolicy>,
+                      concepts::negate<RAJA::detail::is_radix_sortable<
+                          RAJA::detail::IterVal<KeyIter>, Compare>>>
 stable_pairs(
     resources::Host host_res,
     const ExecPolicy&,
@@ -268,6 +584,102 @@ stable_pairs(
   return resources::EventProxy<resources::Host>(host_res);
 }
 
+/*!
+        \brief sort given range of arithmetic keys using less or greater
+               with a radix sort, used for both stable and unstable sorts
+*/
+template <typename ExecPolicy, typename Iter, typename Compare>
+concepts::enable_if_t<resources::EventProxy<resources::Host>,
+                      type_traits::is_openmp_policy<ExecPolicy>,
+                      RAJA::detail::is_radix_sortable<
+                          RAJA::detail::IterVal<Iter>, Compare>>
+unstable(
+    resources::Host host_res,
+    const ExecPolicy&,
+    Iter begin,
+    Iter end,
+    Compare comp)
+{
+  if (end - begin < RAJA::detail::radix_sort_cutoff()) {
+    detail::StableSorter{}(begin, end, comp);
+  } else {
+    detail::openmp::radix_sort_pairs<RAJA::detail::radix_descending<Compare>::value>(
+        begin, end, RAJA::detail::radix_no_vals{});
+  }
+
+  return resources::EventProxy<resources::Host>(host_res);
+}
+
+/*!
+        \brief stable sort given range of arithmetic keys using less or
+               greater with a radix sort
+*/
+template <typename ExecPolicy, typename Iter, typename Compare>
+concepts::enable_if_t<resources::EventProxy<resources::Host>,
+                      type_traits::is_openmp_policy<ExecPolicy>,
+                      RAJA::detail::is_radix_sortable<
+                          RAJA::detail::IterVal<Iter>, Compare>>
+stable(
+    resources::Host host_res,
+    const ExecPolicy& p,
+    Iter begin,
+    Iter end,
+    Compare comp)
+{
+  return unstable(host_res, p, begin, end, comp);
+}
+
+/*!
+        \brief sort given range of pairs with arithmetic keys using less or
+               greater with a radix sort, used for both stable and unstable
+               sorts
+*/
+template <typename ExecPolicy, typename KeyIter, typename ValIter, typename Compare>
+concepts::enable_if_t<resources::EventProxy<resources::Host>,
+                      type_traits::is_openmp_policy<ExecPolicy>,
+                      RAJA::detail::is_radix_sortable<
+                          RAJA::detail::IterVal<KeyIter>, Compare>>
+unstable_pairs(
+    resources::Host host_res,
+    const ExecPolicy&,
+    KeyIter keys_begin,
+    KeyIter keys_end,
+    ValIter vals_begin,
+    Compare comp)
+{
+  if (keys_end - keys_begin < RAJA::detail::radix_sort_cutoff()) {
+    auto begin  = RAJA::zip(keys_begin, vals_begin);
+    auto end    = RAJA::zip(keys_end, vals_begin+(keys_end-keys_begin));
+    using zip_ref = RAJA::detail::IterRef<camp::decay<decltype(begin)>>;
+    detail::StableSorter{}(begin, end, RAJA::compare_first<zip_ref>(comp));
+  } else {
+    detail::openmp::radix_sort_pairs<RAJA::detail::radix_descending<Compare>::value>(
+        keys_begin, keys_end, vals_begin);
+  }
+
+  return resources::EventProxy<resources::Host>(host_res);
+}
+
+/*!
+        \brief stable sort given range of pairs with arithmetic keys using
+               less or greater with a radix sort
+*/
+template <typename ExecPolicy, typename KeyIter, typename ValIter, typename Compare>
+concepts::enable_if_t<resources::EventProxy<resources::Host>,
+                      type_traits::is_openmp_policy<ExecPolicy>,
+                      RAJA::detail::is_radix_sortable<
+                          RAJA::detail::IterVal<KeyIter>, Compare>>
+stable_pairs(
+    resources::Host host_res,
+    const ExecPolicy& p,
+    KeyIter keys_begin,
+    KeyIter keys_end,
+    ValIter vals_begin,
+    Compare comp)
+{
+  return unstable_pairs(host_res, p, keys_begin, keys_end, vals_begin, comp);
+}
+
 }  // namespace sort
 
 }  // namespace impl
@@ -18,6 +18,12 @@
 #ifndef RAJA_pattern_teams_openmp_HPP
 #define RAJA_pattern_teams_openmp_HPP
 
+#include <algorithm>
+#include <memory>
+#include <new>
+
+#include <omp.h>
+
 #include "RAJA/pattern/teams/teams_core.hpp"
 #include "RAJA/policy/openmp/policy.hpp"
 
@@ -36,10 +42,16 @@ struct LaunchExecute<RAJA::expt::omp_launch_t> {
   template <typename BODY>
   static void exec(LaunchContext const &ctx, BODY const &body)
   {
+    // each thread runs whole teams, so each has its own scratch memory
+    detail::HostSharedMemory shared(omp_get_max_threads(), ctx.shared_mem_bytes);
+
     RAJA::region<RAJA::omp_parallel_region>([&]() {
+      LaunchContext thread_ctx(ctx);
+      thread_ctx.shared_mem_ptr = shared.slice(omp_get_thread_num());
+
       using RAJA::internal::thread_privatize;
       auto loop_body = thread_privatize(body);
-      loop_body.get_priv()(ctx);
+      loop_body.get_priv()(thread_ctx);
     });
   }
 };
@@ -497,6 +509,259 @@ struct TileICountExecute<omp_for_exec, SEGMENT> {
   }
 };
 
+
+///
+/// Launch that runs each team on a group of ThreadsPerTeam threads of an
+/// OpenMP parallel region, like a GPU thread block. Loops with
+/// omp_team_exec hand out teams to the groups, and loops with
+/// omp_team_thread_exec inside them split the iterations of a team over
+/// the threads of its group. Threads of a group are synchronized only by
+/// LaunchContext::teamSync(), which is a barrier of the group, and share
+/// the scratch memory returned by LaunchContext::getSharedMemory(), a
+/// separate cache line aligned slice for each group. Use one level of
+/// omp_team_exec and one of omp_team_thread_exec loops, loops nested in
+/// them run on the calling thread with loop_exec.
+///
+template <int ThreadsPerTeam>
+struct omp_team_launch_t {
+  static_assert(ThreadsPerTeam > 0, "ThreadsPerTeam must be positive");
+};
+
+struct omp_team_exec {
+};
+
+struct omp_team_thread_exec {
+};
+
+template <int ThreadsPerTeam>
+struct LaunchExecute<RAJA::expt::omp_team_launch_t<ThreadsPerTeam>> {
+  template <typename BODY>
+  static void exec(LaunchContext const &ctx, BODY const &body)
+  {
+    const int max_threads = omp_get_max_threads();
+    const int max_groups =
+        std::max(1, max_threads / std::min(ThreadsPerTeam, max_threads));
+
+    // new[] does not honor the barrier alignment before C++17
+    using barrier_deleter_type = FreeAlignedType<detail::HostTeamBarrier, int>;
+    barrier_deleter_type barrier_deleter;
+    std::unique_ptr<detail::HostTeamBarrier, barrier_deleter_type &> barriers(
+        RAJA::allocate_aligned_type<detail::HostTeamBarrier>(
+            alignof(detail::HostTeamBarrier),
+            max_groups * sizeof(detail::HostTeamBarrier)),
+        barrier_deleter);
+    if (!barriers) {
+      RAJA_ABORT_OR_THROW("omp_team_launch barrier allocation failed");
+    }
+    for (int &g = barrier_deleter.size; g < max_groups; ++g) {
+      new (&barriers.get()[g]) detail::HostTeamBarrier;
+    }
+    detail::HostSharedMemory shared(max_groups, ctx.shared_mem_bytes);
+
+    RAJA::region<RAJA::omp_parallel_region>([&]() {
+      const int num_threads = omp_get_num_threads();
+      const int team_size = std::min(ThreadsPerTeam, num_threads);
+      const int num_groups = std::min(max_groups, num_threads / team_size);
+      const int thread = omp_get_thread_num();
+      const int group = thread / team_size;
+
+      // threads left over after forming whole groups have no team
+      if (group >= num_groups) {
+        return;
+      }
+
+      LaunchContext team_ctx(ctx);
+      team_ctx.host_team.group = group;
+      team_ctx.host_team.num_groups = num_groups;
+      team_ctx.host_team.thread = thread % team_size;
+      team_ctx.host_team.num_threads = team_size;
+      team_ctx.host_team.barrier = &barriers.get()[group];
+      team_ctx.shared_mem_ptr = shared.slice(group);
+
+      using RAJA::internal::thread_privatize;
+      auto loop_body = thread_privatize(body);
+      loop_body.get_priv()(team_ctx);
+    });
+  }
+};
+
+namespace internal
+{
+
+//! omp_team_exec loops run iterations group, group + num_groups, ...
+struct HostTeamGroupStride {
+  static int first(LaunchContext const &ctx) { return ctx.host_team.group; }
+  static int stride(LaunchContext const &ctx)
+  {
+    return ctx.host_team.num_groups;
+  }
+};
+
+//! omp_team_thread_exec loops run iterations thread, thread + num_threads, ...
+struct HostTeamThreadStride {
+  static int first(LaunchContext const &ctx) { return ctx.host_team.thread; }
+  static int stride(LaunchContext const &ctx)
+  {
+    return ctx.host_team.num_threads;
+  }
+};
+
+//! Loops over one, two or three segments, flattened with segment0 fastest
+template <typename STRIDE, typename SEGMENT>
+struct HostTeamLoopExecute {
+
+  template <typename BODY>
+  static RAJA_INLINE void exec(LaunchContext const &ctx,
+                               SEGMENT const &segment,
+                               BODY const &body)
+  {
+    const int len = segment.end() - segment.begin();
+    for (int i = STRIDE::first(ctx); i < len; i += STRIDE::stride(ctx)) {
+      body(*(segment.begin() + i));
+    }
+  }
+
+  template <typename BODY>
+  static RAJA_INLINE void exec(LaunchContext const &ctx,
+                               SEGMENT const &segment0,
+                               SEGMENT const &segment1,
+                               BODY const &body)
+  {
+    const int len0 = segment0.end() - segment0.begin();
+    const int len = len0 * (segment1.end() - segment1.begin());
+    for (int t = STRIDE::first(ctx); t < len; t += STRIDE::stride(ctx)) {
+      body(*(segment0.begin() + t % len0), *(segment1.begin() + t / len0));
+    }
+  }
+
+  template <typename BODY>
+  static RAJA_INLINE void exec(LaunchContext const &ctx,
+                               SEGMENT const &segment0,
+                               SEGMENT const &segment1,
+                               SEGMENT const &segment2,
+                               BODY const &body)
+  {
+    const int len0 = segment0.end() - segment0.begin();
+    const int len1 = segment1.end() - segment1.begin();
+    const int len = len0 * len1 * (segment2.end() - segment2.begin());
+    for (int t = STRIDE::first(ctx); t < len; t += STRIDE::stride(ctx)) {
+      body(*(segment0.begin() + t % len0),
+           *(segment1.begin() + (t / len0) % len1),
+           *(segment2.begin() + t / (len0 * len1)));
+    }
+  }
+};
+
+template <typename STRIDE, typename SEGMENT>
+struct HostTeamLoopICountExecute {
+
+  template <typename BODY>
+  static RAJA_INLINE void exec(LaunchContext const &ctx,
+                               SEGMENT const &segment,
+                               BODY const &body)
+  {
+    const int len = segment.end() - segment.begin();
+    for (int i = STRIDE::first(ctx); i < len; i += STRIDE::stride(ctx)) {
+      body(*(segment.begin() + i), i);
+    }
+  }
+
+  template <typename BODY>
+  static RAJA_INLINE void exec(LaunchContext const &ctx,
+                               SEGMENT const &segment0,
+                               SEGMENT const &segment1,
+                               BODY const &body)
+  {
+    const int len0 = segment0.end() - segment0.begin();
+    const int len = len0 * (segment1.end() - segment1.begin());
+    for (int t = STRIDE::first(ctx); t < len; t += STRIDE::stride(ctx)) {
+      const int i = t % len0;
+      const int j = t / len0;
+      body(*(segment0.begin() + i), *(segment1.begin() + j), i, j);
+    }
+  }
+};
+
+template <typename STRIDE, typename SEGMENT>
+struct HostTeamTileExecute {
+
+  template <typename TILE_T, typename BODY>
+  static RAJA_INLINE void exec(LaunchContext const &ctx,
+                               TILE_T tile_size,
+                               SEGMENT const &segment,
+                               BODY const &body)
+  {
+    const int len = segment.end() - segment.begin();
+    const int numTiles = (len + tile_size - 1) / tile_size;
+    for (int i = STRIDE::first(ctx); i < numTiles; i += STRIDE::stride(ctx)) {
+      body(segment.slice(i * tile_size, tile_size));
+    }
+  }
+};
+
+template <typename STRIDE, typename SEGMENT>
+struct HostTeamTileICountExecute {
+
+  template <typename TILE_T, typename BODY>
+  static RAJA_INLINE void exec(LaunchContext const &ctx,
+                               TILE_T tile_size,
+                               SEGMENT const &segment,
+                               BODY const &body)
+  {
+    const int len = segment.end() - segment.begin();
+    const int numTiles = (len + tile_size - 1) / tile_size;
+    for (int i = STRIDE::first(ctx); i < numTiles; i += STRIDE::stride(ctx)) {
+      body(segment.slice(i * tile_size, tile_size), i);
+    }
+  }
+};
+
+}  // namespace internal
+
+template <typename SEGMENT>
+struct LoopExecute<omp_team_exec, SEGMENT>
+    : internal::HostTeamLoopExecute<internal::HostTeamGroupStride, SEGMENT> {
+};
+
+template <typename SEGMENT>
+struct LoopICountExecute<omp_team_exec, SEGMENT>
+    : internal::HostTeamLoopICountExecute<internal::HostTeamGroupStride,
+                                          SEGMENT> {
+};
+
+template <typename SEGMENT>
+struct TileExecute<omp_team_exec, SEGMENT>
+    : internal::HostTeamTileExecute<internal::HostTeamGroupStride, SEGMENT> {
+};
+
+template <typename SEGMENT>
+struct TileICountExecute<omp_team_exec, SEGMENT>
+    : internal::HostTeamTileICountExecute<internal::HostTeamGroupStride,
+                                          SEGMENT> {
+};
+
+template <typename SEGMENT>
+struct LoopExecute<omp_team_thread_exec, SEGMENT>
+    : internal::HostTeamLoopExecute<internal::HostTeamThreadStride, SEGMENT> {
+};
+
+template <typename SEGMENT>
+struct LoopICountExecute<omp_team_thread_exec, SEGMENT>
+    : internal::HostTeamLoopICountExecute<internal::HostTeamThreadStride,
+                                          SEGMENT> {
+};
+
+template <typename SEGMENT>
+struct TileExecute<omp_team_thread_exec, SEGMENT>
+    : internal::HostTeamTileExecute<internal::HostTeamThreadStride, SEGMENT> {
+};
+
+template <typename SEGMENT>
+struct TileICountExecute<omp_team_thread_exec, SEGMENT>
+    : internal::HostTeamTileICountExecute<internal::HostTeamThreadStride,
+                                          SEGMENT> {
+};
+
 }  // namespace expt
 
 }  // namespace RAJA
@@ -0,0 +1,64 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file defining the SIMD register architecture tags.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-21, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_policy_register_arch_HPP
+#define RAJA_policy_register_arch_HPP
+
+#include <cstddef>
+
+namespace RAJA
+{
+
+///
+/// Register architecture tags, s_bytes is the width of the register.
+///
+/// Register<T, arch> uses intrinsics for the architecture when the compiler
+/// targets it, and a portable lane by lane implementation of the same
+/// width otherwise.
+///
+struct scalar_register {
+  static constexpr size_t s_bytes = 0;
+};
+
+struct sse_register {
+  static constexpr size_t s_bytes = 16;
+};
+
+struct avx2_register {
+  static constexpr size_t s_bytes = 32;
+};
+
+struct avx512_register {
+  static constexpr size_t s_bytes = 64;
+};
+
+///
+/// Widest register the compiler targets
+///
+#if defined(__AVX512F__)
+using default_register = avx512_register;
+#elif defined(__AVX2__)
+using default_register = avx2_register;
+#elif defined(__SSE2__) || defined(_M_X64)
+using default_register = sse_register;
+#else
+using default_register = scalar_register;
+#endif
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
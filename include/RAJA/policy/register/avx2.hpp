@@ -0,0 +1,508 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file defining the AVX2 float and double registers.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-21, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_policy_register_avx2_HPP
+#define RAJA_policy_register_avx2_HPP
+
+#include "RAJA/config.hpp"
+
+#if defined(__AVX2__)
+
+#include <immintrin.h>
+
+#include "RAJA/pattern/register/Register.hpp"
+
+namespace RAJA
+{
+
+template <>
+class Register<double, avx2_register>
+    : public internal::RegisterBase<Register<double, avx2_register>, double, 4>
+{
+  //! all bits set in the 64 bit lanes below n
+  RAJA_INLINE
+  static __m256i create_mask(camp::idx_t n)
+  {
+    return _mm256_set_epi64x(n > 3 ? -1 : 0,
+                             n > 2 ? -1 : 0,
+                             n > 1 ? -1 : 0,
+                             n > 0 ? -1 : 0);
+  }
+
+  RAJA_INLINE
+  static __m256i expand_mask(mask_type mask)
+  {
+    return _mm256_set_epi64x((mask & 8) ? -1 : 0,
+                             (mask & 4) ? -1 : 0,
+                             (mask & 2) ? -1 : 0,
+                             (mask & 1) ? -1 : 0);
+  }
+
+  RAJA_INLINE
+  static __m256i stride_offsets(camp::idx_t stride)
+  {
+    return _mm256_set_epi64x(3 * stride, 2 * stride, stride, 0);
+  }
+
+public:
+  using register_policy = avx2_register;
+  using register_type = __m256d;
+
+  RAJA_INLINE
+  Register() : m_value(_mm256_setzero_pd()) {}
+
+  RAJA_INLINE
+  Register(register_type value) : m_value(value) {}
+
+  RAJA_INLINE
+  Register(element_type value) : m_value(_mm256_set1_pd(value)) {}
+
+  RAJA_INLINE
+  register_type get_register() const { return m_value; }
+
+  RAJA_INLINE
+  element_type get(camp::idx_t i) const
+  {
+    alignas(32) element_type lanes[4];
+    _mm256_store_pd(lanes, m_value);
+    return lanes[i];
+  }
+
+  RAJA_INLINE
+  Register &set(camp::idx_t i, element_type value)
+  {
+    alignas(32) element_type lanes[4];
+    _mm256_store_pd(lanes, m_value);
+    lanes[i] = value;
+    m_value = _mm256_load_pd(lanes);
+    return *this;
+  }
+
+  RAJA_INLINE
+  Register &broadcast(element_type value)
+  {
+    m_value = _mm256_set1_pd(value);
+    return *this;
+  }
+
+  RAJA_INLINE
+  Register &load_packed(element_type const *ptr)
+  {
+    m_value = _mm256_loadu_pd(ptr);
+    return *this;
+  }
+
+  RAJA_INLINE
+  Register &load_packed_n(element_type const *ptr, camp::idx_t n)
+  {
+    m_value = _mm256_maskload_pd(ptr, create_mask(n));
+    return *this;
+  }
+
+  RAJA_INLINE
+  Register &load_strided(element_type const *ptr, camp::idx_t stride)
+  {
+    m_value = _mm256_i64gather_pd(ptr, stride_offsets(stride), 8);
+    return *this;
+  }
+
+  RAJA_INLINE
+  Register &load_strided_n(element_type const *ptr,
+                           camp::idx_t stride,
+                           camp::idx_t n)
+  {
+    m_value = _mm256_mask_i64gather_pd(_mm256_setzero_pd(),
+                                       ptr,
+                                       stride_offsets(stride),
+                                       _mm256_castsi256_pd(create_mask(n)),
+                                       8);
+    return *this;
+  }
+
+  RAJA_INLINE
+  Register &gather(element_type const *ptr, camp::idx_t const *offsets)
+  {
+    static_assert(sizeof(camp::idx_t) == 8, "expected 64 bit offsets");
+    m_value = _mm256_i64gather_pd(
+        ptr, _mm256_loadu_si256(reinterpret_cast<__m256i const *>(offsets)), 8);
+    return *this;
+  }
+
+  RAJA_INLINE
+  Register const &store_packed(element_type *ptr) const
+  {
+    _mm256_storeu_pd(ptr, m_value);
+    return *this;
+  }
+
+  RAJA_INLINE
+  Register const &store_packed_n(element_type *ptr, camp::idx_t n) const
+  {
+    _mm256_maskstore_pd(ptr, create_mask(n), m_value);
+    return *this;
+  }
+
+  RAJA_INLINE
+  Register add(Register const &b) const
+  {
+    return Register(_mm256_add_pd(m_value, b.m_value));
+  }
+
+  RAJA_INLINE
+  Register subtract(Register const &b) const
+  {
+    return Register(_mm256_sub_pd(m_value, b.m_value));
+  }
+
+  RAJA_INLINE
+  Register multiply(Register const &b) const
+  {
+    return Register(_mm256_mul_pd(m_value, b.m_value));
+  }
+
+  RAJA_INLINE
+  Register divide(Register const &b) const
+  {
+    return Register(_mm256_div_pd(m_value, b.m_value));
+  }
+
+#if defined(__FMA__)
+  RAJA_INLINE
+  Register multiply_add(Register const &b, Register const &c) const
+  {
+    return Register(_mm256_fmadd_pd(m_value, b.m_value, c.m_value));
+  }
+
+  RAJA_INLINE
+  Register multiply_subtract(Register const &b, Register const &c) const
+  {
+    return Register(_mm256_fmsub_pd(m_value, b.m_value, c.m_value));
+  }
+#endif
+
+  RAJA_INLINE
+  Register vmin(Register const &b) const
+  {
+    return Register(_mm256_min_pd(m_value, b.m_value));
+  }
+
+  RAJA_INLINE
+  Register vmax(Register const &b) const
+  {
+    return Register(_mm256_max_pd(m_value, b.m_value));
+  }
+
+  RAJA_INLINE
+  Register blend(Register const &b, mask_type mask) const
+  {
+    return Register(_mm256_blendv_pd(
+        m_value, b.m_value, _mm256_castsi256_pd(expand_mask(mask))));
+  }
+
+  RAJA_INLINE
+  element_type sum() const
+  {
+    __m128d lo = _mm256_castpd256_pd128(m_value);
+    __m128d hi = _mm256_extractf128_pd(m_value, 1);
+    __m128d s = _mm_add_pd(lo, hi);
+    return _mm_cvtsd_f64(_mm_add_sd(s, _mm_unpackhi_pd(s, s)));
+  }
+
+  RAJA_INLINE
+  element_type max() const
+  {
+    __m128d lo = _mm256_castpd256_pd128(m_value);
+    __m128d hi = _mm256_extractf128_pd(m_value, 1);
+    __m128d m = _mm_max_pd(lo, hi);
+    return _mm_cvtsd_f64(_mm_max_sd(m, _mm_unpackhi_pd(m, m)));
+  }
+
+  RAJA_INLINE
+  element_type min() const
+  {
+    __m128d lo = _mm256_castpd256_pd128(m_value);
+    __m128d hi = _mm256_extractf128_pd(m_value, 1);
+    __m128d m = _mm_min_pd(lo, hi);
+    return _mm_cvtsd_f64(_mm_min_sd(m, _mm_unpackhi_pd(m, m)));
+  }
+
+  RAJA_INLINE
+  mask_type cmp_eq(Register const &b) const { return cmp<_CMP_EQ_OQ>(b); }
+
+  RAJA_INLINE
+  mask_type cmp_ne(Register const &b) const { return cmp<_CMP_NEQ_UQ>(b); }
+
+  RAJA_INLINE
+  mask_type cmp_lt(Register const &b) const { return cmp<_CMP_LT_OQ>(b); }
+
+  RAJA_INLINE
+  mask_type cmp_le(Register const &b) const { return cmp<_CMP_LE_OQ>(b); }
+
+  RAJA_INLINE
+  mask_type cmp_gt(Register const &b) const { return cmp<_CMP_GT_OQ>(b); }
+
+  RAJA_INLINE
+  mask_type cmp_ge(Register const &b) const { return cmp<_CMP_GE_OQ>(b); }
+
+private:
+  template <int Predicate>
+  RAJA_INLINE mask_type cmp(Register const &b) const
+  {
+    return static_cast<mask_type>(
+        _mm256_movemask_pd(_mm256_cmp_pd(m_value, b.m_value, Predicate)));
+  }
+
+  register_type m_value;
+};
+
+
+template <>
+class Register<float, avx2_register>
+    : public internal::RegisterBase<Register<float, avx2_register>, float, 8>
+{
+  //! all bits set in the 32 bit lanes below n
+  RAJA_INLINE
+  static __m256i create_mask(camp::idx_t n)
+  {
+    return _mm256_cmpgt_epi32(_mm256_set1_epi32(static_cast<int>(n)),
+                              _mm256_set_epi32(7, 6, 5, 4, 3, 2, 1, 0));
+  }
+
+  RAJA_INLINE
+  static __m256i expand_mask(mask_type mask)
+  {
+    const __m256i bits = _mm256_set_epi32(128, 64, 32, 16, 8, 4, 2, 1);
+    return _mm256_cmpeq_epi32(
+        _mm256_and_si256(_mm256_set1_epi32(static_cast<int>(mask)), bits),
+        bits);
+  }
+
+  RAJA_INLINE
+  static __m256i stride_offsets(camp::idx_t stride)
+  {
+    return _mm256_mullo_epi32(_mm256_set_epi32(7, 6, 5, 4, 3, 2, 1, 0),
+                              _mm256_set1_epi32(static_cast<int>(stride)));
+  }
+
+public:
+  using register_policy = avx2_register;
+  using register_type = __m256;
+
+  RAJA_INLINE
+  Register() : m_value(_mm256_setzero_ps()) {}
+
+  RAJA_INLINE
+  Register(register_type value) : m_value(value) {}
+
+  RAJA_INLINE
+  Register(element_type value) : m_value(_mm256_set1_ps(value)) {}
+
+  RAJA_INLINE
+  register_type get_register() const { return m_value; }
+
+  RAJA_INLINE
+  element_type get(camp::idx_t i) const
+  {
+    alignas(32) element_type lanes[8];
+    _mm256_store_ps(lanes, m_value);
+    return lanes[i];
+  }
+
+  RAJA_INLINE
+  Register &set(camp::idx_t i, element_type value)
+  {
+    alignas(32) element_type lanes[8];
+    _mm256_store_ps(lanes, m_value);
+    lanes[i] = value;
+    m_value = _mm256_load_ps(lanes);
+    return *this;
+  }
+
+  RAJA_INLINE
+  Register &broadcast(element_type value)
+  {
+    m_value = _mm256_set1_ps(value);
+    return *this;
+  }
+
+  RAJA_INLINE
+  Register &load_packed(element_type const *ptr)
+  {
+    m_value = _mm256_loadu_ps(ptr);
+    return *this;
+  }
+
+  RAJA_INLINE
+  Register &load_packed_n(element_type const *ptr, camp::idx_t n)
+  {
+    m_value = _mm256_maskload_ps(ptr, create_mask(n));
+    return *this;
+  }
+
+  //! the strided offsets of all lanes must fit in an int
+  RAJA_INLINE
+  Register &load_strided(element_type const *ptr, camp::idx_t stride)
+  {
+    m_value = _mm256_i32gather_ps(ptr, stride_offsets(stride), 4);
+    return *this;
+  }
+
+  RAJA_INLINE
+  Register &load_strided_n(element_type const *ptr,
+                           camp::idx_t stride,
+                           camp::idx_t n)
+  {
+    m_value = _mm256_mask_i32gather_ps(_mm256_setzero_ps(),
+                                       ptr,
+                                       stride_offsets(stride),
+                                       _mm256_castsi256_ps(create_mask(n)),
+                                       4);
+    return *this;
+  }
+
+  RAJA_INLINE
+  Register const &store_packed(element_type *ptr) const
+  {
+    _mm256_storeu_ps(ptr, m_value);
+    return *this;
+  }
+
+  RAJA_INLINE
+  Register const &store_packed_n(element_type *ptr, camp::idx_t n) const
+  {
+    _mm256_maskstore_ps(ptr, create_mask(n), m_value);
+    return *this;
+  }
+
+  RAJA_INLINE
+  Register add(Register const &b) const
+  {
+    return Register(_mm256_add_ps(m_value, b.m_value));
+  }
+
+  RAJA_INLINE
+  Register subtract(Register const &b) const
+  {
+    return Register(_mm256_sub_ps(m_value, b.m_value));
+  }
+
+  RAJA_INLINE
+  Register multiply(Register const &b) const
+  {
+    return Register(_mm256_mul_ps(m_value, b.m_value));
+  }
+
+  RAJA_INLINE
+  Register divide(Register const &b) const
+  {
+    return Register(_mm256_div_ps(m_value, b.m_value));
+  }
+
+#if defined(__FMA__)
+  RAJA_INLINE
+  Register multiply_add(Register const &b, Register const &c) const
+  {
+    return Register(_mm256_fmadd_ps(m_value, b.m_value, c.m_value));
+  }
+
+  RAJA_INLINE
+  Register multiply_subtract(Register const &b, Register const &c) const
+  {
+    return Register(_mm256_fmsub_ps(m_value, b.m_value, c.m_value));
+  }
+#endif
+
+  RAJA_INLINE
+  Register vmin(Register const &b) const
+  {
+    return Register(_mm256_min_ps(m_value, b.m_value));
+  }
+
+  RAJA_INLINE
+  Register vmax(Register const &b) const
+  {
+    return Register(_mm256_max_ps(m_value, b.m_value));
+  }
+
+  RAJA_INLINE
+  Register blend(Register const &b, mask_type mask) const
+  {
+    return Register(_mm256_blendv_ps(
+        m_value, b.m_value, _mm256_castsi256_ps(expand_mask(mask))));
+  }
+
+  RAJA_INLINE
+  element_type sum() const
+  {
+    __m128 s = _mm_add_ps(_mm256_castps256_ps128(m_value),
+                          _mm256_extractf128_ps(m_value, 1));
+    s = _mm_add_ps(s, _mm_movehl_ps(s, s));
+    return _mm_cvtss_f32(_mm_add_ss(s, _mm_shuffle_ps(s, s, 1)));
+  }
+
+  RAJA_INLINE
+  element_type max() const
+  {
+    __m128 m = _mm_max_ps(_mm256_castps256_ps128(m_value),
+                          _mm256_extractf128_ps(m_value, 1));
+    m = _mm_max_ps(m, _mm_movehl_ps(m, m));
+    return _mm_cvtss_f32(_mm_max_ss(m, _mm_shuffle_ps(m, m, 1)));
+  }
+
+  RAJA_INLINE
+  element_type min() const
+  {
+    __m128 m = _mm_min_ps(_mm256_castps256_ps128(m_value),
+                          _mm256_extractf128_ps(m_value, 1));
+    m = _mm_min_ps(m, _mm_movehl_ps(m, m));
+    return _mm_cvtss_f32(_mm_min_ss(m, _mm_shuffle_ps(m, m, 1)));
+  }
+
+  RAJA_INLINE
+  mask_type cmp_eq(Register const &b) const { return cmp<_CMP_EQ_OQ>(b); }
+
+  RAJA_INLINE
+  mask_type cmp_ne(Register const &b) const { return cmp<_CMP_NEQ_UQ>(b); }
+
+  RAJA_INLINE
+  mask_type cmp_lt(Register const &b) const { return cmp<_CMP_LT_OQ>(b); }
+
+  RAJA_INLINE
+  mask_type cmp_le(Register const &b) const { return cmp<_CMP_LE_OQ>(b); }
+
+  RAJA_INLINE
+  mask_type cmp_gt(Register const &b) const { return cmp<_CMP_GT_OQ>(b); }
+
+  RAJA_INLINE
+  mask_type cmp_ge(Register const &b) const { return cmp<_CMP_GE_OQ>(b); }
+
+private:
+  template <int Predicate>
+  RAJA_INLINE mask_type cmp(Register const &b) const
+  {
+    return static_cast<mask_type>(
+        _mm256_movemask_ps(_mm256_cmp_ps(m_value, b.m_value, Predicate)));
+  }
+
+  register_type m_value;
+};
+
+}  // namespace RAJA
+
+#endif  // closing endif for if defined(__AVX2__)
+
+#endif  // closing endif for header file include guard
@@ -0,0 +1,535 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file defining the AVX-512 float and double registers.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-21, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_policy_register_avx512_HPP
+#define RAJA_policy_register_avx512_HPP
+
+#include "RAJA/config.hpp"
+
+#if defined(__AVX512F__)
+
+#include <immintrin.h>
+
+#include "RAJA/pattern/register/Register.hpp"
+
+namespace RAJA
+{
+
+template <>
+class Register<double, avx512_register>
+    : public internal::RegisterBase<Register<double, avx512_register>,
+                                    double,
+                                    8>
+{
+  RAJA_INLINE
+  static __mmask8 create_mask(camp::idx_t n)
+  {
+    return static_cast<__mmask8>(lane_mask(n));
+  }
+
+  RAJA_INLINE
+  static __m512i stride_offsets(camp::idx_t stride)
+  {
+    return _mm512_set_epi64(7 * stride,
+                            6 * stride,
+                            5 * stride,
+                            4 * stride,
+                            3 * stride,
+                            2 * stride,
+                            stride,
+                            0);
+  }
+
+public:
+  using register_policy = avx512_register;
+  using register_type = __m512d;
+
+  RAJA_INLINE
+  Register() : m_value(_mm512_setzero_pd()) {}
+
+  RAJA_INLINE
+  Register(register_type value) : m_value(value) {}
+
+  RAJA_INLINE
+  Register(element_type value) : m_value(_mm512_set1_pd(value)) {}
+
+  RAJA_INLINE
+  register_type get_register() const { return m_value; }
+
+  RAJA_INLINE
+  element_type get(camp::idx_t i) const
+  {
+    alignas(64) element_type lanes[8];
+    _mm512_store_pd(lanes, m_value);
+    return lanes[i];
+  }
+
+  RAJA_INLINE
+  Register &set(camp::idx_t i, element_type value)
+  {
+    m_value = _mm512_mask_broadcastsd_pd(
+        m_value, static_cast<__mmask8>(1u << i), _mm_set_sd(value));
+    return *this;
+  }
+
+  RAJA_INLINE
+  Register &broadcast(element_type value)
+  {
+    m_value = _mm512_set1_pd(value);
+    return *this;
+  }
+
+  RAJA_INLINE
+  Register &load_packed(element_type const *ptr)
+  {
+    m_value = _mm512_loadu_pd(ptr);
+    return *this;
+  }
+
+  RAJA_INLINE
+  Register &load_packed_n(element_type const *ptr, camp::idx_t n)
+  {
+    m_value = _mm512_maskz_loadu_pd(create_mask(n), ptr);
+    return *this;
+  }
+
+  RAJA_INLINE
+  Register &load_strided(element_type const *ptr, camp::idx_t stride)
+  {
+    m_value = _mm512_i64gather_pd(stride_offsets(stride), ptr, 8);
+    return *this;
+  }
+
+  RAJA_INLINE
+  Register &load_strided_n(element_type const *ptr,
+                           camp::idx_t stride,
+                           camp::idx_t n)
+  {
+    m_value = _mm512_mask_i64gather_pd(
+        _mm512_setzero_pd(), create_mask(n), stride_offsets(stride), ptr, 8);
+    return *this;
+  }
+
+  RAJA_INLINE
+  Register &gather(element_type const *ptr, camp::idx_t const *offsets)
+  {
+    static_assert(sizeof(camp::idx_t) == 8, "expected 64 bit offsets");
+    m_value = _mm512_i64gather_pd(_mm512_loadu_si512(offsets), ptr, 8);
+    return *this;
+  }
+
+  RAJA_INLINE
+  Register &gather_n(element_type const *ptr,
+                     camp::idx_t const *offsets,
+                     camp::idx_t n)
+  {
+    const __mmask8 mask = create_mask(n);
+    m_value = _mm512_mask_i64gather_pd(_mm512_setzero_pd(),
+                                       mask,
+                                       _mm512_maskz_loadu_epi64(mask, offsets),
+                                       ptr,
+                                       8);
+    return *this;
+  }
+
+  RAJA_INLINE
+  Register const &store_packed(element_type *ptr) const
+  {
+    _mm512_storeu_pd(ptr, m_value);
+    return *this;
+  }
+
+  RAJA_INLINE
+  Register const &store_packed_n(element_type *ptr, camp::idx_t n) const
+  {
+    _mm512_mask_storeu_pd(ptr, create_mask(n), m_value);
+    return *this;
+  }
+
+  RAJA_INLINE
+  Register const &store_strided(element_type *ptr, camp::idx_t stride) const
+  {
+    _mm512_i64scatter_pd(ptr, stride_offsets(stride), m_value, 8);
+    return *this;
+  }
+
+  RAJA_INLINE
+  Register const &store_strided_n(element_type *ptr,
+                                  camp::idx_t stride,
+                                  camp::idx_t n) const
+  {
+    _mm512_mask_i64scatter_pd(
+        ptr, create_mask(n), stride_offsets(stride), m_value, 8);
+    return *this;
+  }
+
+  RAJA_INLINE
+  Register const &scatter(element_type *ptr, camp::idx_t const *offsets) const
+  {
+    _mm512_i64scatter_pd(ptr, _mm512_loadu_si512(offsets), m_value, 8);
+    return *this;
+  }
+
+  RAJA_INLINE
+  Register const &scatter_n(element_type *ptr,
+                            camp::idx_t const *offsets,
+                            camp::idx_t n) const
+  {
+    const __mmask8 mask = create_mask(n);
+    _mm512_mask_i64scatter_pd(
+        ptr, mask, _mm512_maskz_loadu_epi64(mask, offsets), m_value, 8);
+    return *this;
+  }
+
+  RAJA_INLINE
+  Register add(Register const &b) const
+  {
+    return Register(_mm512_add_pd(m_value, b.m_value));
+  }
+
+  RAJA_INLINE
+  Register subtract(Register const &b) const
+  {
+    return Register(_mm512_sub_pd(m_value, b.m_value));
+  }
+
+  RAJA_INLINE
+  Register multiply(Register const &b) const
+  {
+    return Register(_mm512_mul_pd(m_value, b.m_value));
+  }
+
+  RAJA_INLINE
+  Register divide(Register const &b) const
+  {
+    return Register(_mm512_div_pd(m_value, b.m_value));
+  }
+
+  RAJA_INLINE
+  Register multiply_add(Register const &b, Register const &c) const
+  {
+    return Register(_mm512_fmadd_pd(m_value, b.m_value, c.m_value));
+  }
+
+  RAJA_INLINE
+  Register multiply_subtract(Register const &b, Register const &c) const
+  {
+    return Register(_mm512_fmsub_pd(m_value, b.m_value, c.m_value));
+  }
+
+  RAJA_INLINE
+  Register vmin(Register const &b) const
+  {
+    return Register(_mm512_min_pd(m_value, b.m_value));
+  }
+
+  RAJA_INLINE
+  Register vmax(Register const &b) const
+  {
+    return Register(_mm512_max_pd(m_value, b.m_value));
+  }
+
+  RAJA_INLINE
+  Register blend(Register const &b, mask_type mask) const
+  {
+    return Register(
+        _mm512_mask_blend_pd(static_cast<__mmask8>(mask), m_value, b.m_value));
+  }
+
+  RAJA_INLINE
+  element_type sum() const { return _mm512_reduce_add_pd(m_value); }
+
+  RAJA_INLINE
+  element_type max() const { return _mm512_reduce_max_pd(m_value); }
+
+  RAJA_INLINE
+  element_type min() const { return _mm512_reduce_min_pd(m_value); }
+
+  RAJA_INLINE
+  element_type max_n(camp::idx_t n) const
+  {
+    return _mm512_mask_reduce_max_pd(create_mask(n), m_value);
+  }
+
+  RAJA_INLINE
+  element_type min_n(camp::idx_t n) const
+  {
+    return _mm512_mask_reduce_min_pd(create_mask(n), m_value);
+  }
+
+  RAJA_INLINE
+  mask_type cmp_eq(Register const &b) const { return cmp<_CMP_EQ_OQ>(b); }
+
+  RAJA_INLINE
+  mask_type cmp_ne(Register const &b) const { return cmp<_CMP_NEQ_UQ>(b); }
+
+  RAJA_INLINE
+  mask_type cmp_lt(Register const &b) const { return cmp<_CMP_LT_OQ>(b); }
+
+  RAJA_INLINE
+  mask_type cmp_le(Register const &b) const { return cmp<_CMP_LE_OQ>(b); }
+
+  RAJA_INLINE
+  mask_type cmp_gt(Register const &b) const { return cmp<_CMP_GT_OQ>(b); }
+
+  RAJA_INLINE
+  mask_type cmp_ge(Register const &b) const { return cmp<_CMP_GE_OQ>(b); }
+
+private:
+  template <int Predicate>
+  RAJA_INLINE mask_type cmp(Register const &b) const
+  {
+    return static_cast<mask_type>(
+        _mm512_cmp_pd_mask(m_value, b.m_value, Predicate));
+  }
+
+  register_type m_value;
+};
+
+
+template <>
+class Register<float, avx512_register>
+    : public internal::RegisterBase<Register<float, avx512_register>,
+                                    float,
+                                    16>
+{
+  RAJA_INLINE
+  static __mmask16 create_mask(camp::idx_t n)
+  {
+    return static_cast<__mmask16>(lane_mask(n));
+  }
+
+  RAJA_INLINE
+  static __m512i stride_offsets(camp::idx_t stride)
+  {
+    return _mm512_mullo_epi32(
+        _mm512_set_epi32(15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0),
+        _mm512_set1_epi32(static_cast<int>(stride)));
+  }
+
+public:
+  using register_policy = avx512_register;
+  using register_type = __m512;
+
+  RAJA_INLINE
+  Register() : m_value(_mm512_setzero_ps()) {}
+
+  RAJA_INLINE
+  Register(register_type value) : m_value(value) {}
+
+  RAJA_INLINE
+  Register(element_type value) : m_value(_mm512_set1_ps(value)) {}
+
+  RAJA_INLINE
+  register_type get_register() const { return m_value; }
+
+  RAJA_INLINE
+  element_type get(camp::idx_t i) const
+  {
+    alignas(64) element_type lanes[16];
+    _mm512_store_ps(lanes, m_value);
+    return lanes[i];
+  }
+
+  RAJA_INLINE
+  Register &set(camp::idx_t i, element_type value)
+  {
+    m_value = _mm512_mask_broadcastss_ps(
+        m_value, static_cast<__mmask16>(1u << i), _mm_set_ss(value));
+    return *this;
+  }
+
+  RAJA_INLINE
+  Register &broadcast(element_type value)
+  {
+    m_value = _mm512_set1_ps(value);
+    return *this;
+  }
+
+  RAJA_INLINE
+  Register &load_packed(element_type const *ptr)
+  {
+    m_value = _mm512_loadu_ps(ptr);
+    return *this;
+  }
+
+  RAJA_INLINE
+  Register &load_packed_n(element_type const *ptr, camp::idx_t n)
+  {
+    m_value = _mm512_maskz_loadu_ps(create_mask(n), ptr);
+    return *this;
+  }
+
+  //! the strided offsets of all lanes must fit in an int
+  RAJA_INLINE
+  Register &load_strided(element_type const *ptr, camp::idx_t stride)
+  {
+    m_value = _mm512_i32gather_ps(stride_offsets(stride), ptr, 4);
+    return *this;
+  }
+
+  RAJA_INLINE
+  Register &load_strided_n(element_type const *ptr,
+                           camp::idx_t stride,
+                           camp::idx_t n)
+  {
+    m_value = _mm512_mask_i32gather_ps(
+        _mm512_setzero_ps(), create_mask(n), stride_offsets(stride), ptr, 4);
+    return *this;
+  }
+
+  RAJA_INLINE
+  Register const &store_packed(element_type *ptr) const
+  {
+    _mm512_storeu_ps(ptr, m_value);
+    return *this;
+  }
+
+  RAJA_INLINE
+  Register const &store_packed_n(element_type *ptr, camp::idx_t n) const
+  {
+    _mm512_mask_storeu_ps(ptr, create_mask(n), m_value);
+    return *this;
+  }
+
+  RAJA_INLINE
+  Register const &store_strided(element_type *ptr, camp::idx_t stride) const
+  {
+    _mm512_i32scatter_ps(ptr, stride_offsets(stride), m_value, 4);
+    return *this;
+  }
+
+  RAJA_INLINE
+  Register const &store_strided_n(element_type *ptr,
+                                  camp::idx_t stride,
+                                  camp::idx_t n) const
+  {
+    _mm512_mask_i32scatter_ps(
+        ptr, create_mask(n), stride_offsets(stride), m_value, 4);
+    return *this;
+  }
+
+  RAJA_INLINE
+  Register add(Register const &b) const
+  {
+    return Register(_mm512_add_ps(m_value, b.m_value));
+  }
+
+  RAJA_INLINE
+  Register subtract(Register const &b) const
+  {
+    return Register(_mm512_sub_ps(m_value, b.m_value));
+  }
+
+  RAJA_INLINE
+  Register multiply(Register const &b) const
+  {
+    return Register(_mm512_mul_ps(m_value, b.m_value));
+  }
+
+  RAJA_INLINE
+  Register divide(Register const &b) const
+  {
+    return Register(_mm512_div_ps(m_value, b.m_value));
+  }
+
+  RAJA_INLINE
+  Register multiply_add(Register const &b, Register const &c) const
+  {
+    return Register(_mm512_fmadd_ps(m_value, b.m_value, c.m_value));
+  }
+
+  RAJA_INLINE
+  Register multiply_subtract(Register const &b, Register const &c) const
+  {
+    return Register(_mm512_fmsub_ps(m_value, b.m_value, c.m_value));
+  }
+
+  RAJA_INLINE
+  Register vmin(Register const &b) const
+  {
+    return Register(_mm512_min_ps(m_value, b.m_value));
+  }
+
+  RAJA_INLINE
+  Register vmax(Register const &b) const
+  {
+    return Register(_mm512_max_ps(m_value, b.m_value));
+  }
+
+  RAJA_INLINE
+  Register blend(Register const &b, mask_type mask) const
+  {
+    return Register(_mm512_mask_blend_ps(
+        static_cast<__mmask16>(mask), m_value, b.m_value));
+  }
+
+  RAJA_INLINE
+  element_type sum() const { return _mm512_reduce_add_ps(m_value); }
+
+  RAJA_INLINE
+  element_type max() const { return _mm512_reduce_max_ps(m_value); }
+
+  RAJA_INLINE
+  element_type min() const { return _mm512_reduce_min_ps(m_value); }
+
+  RAJA_INLINE
+  element_type max_n(camp::idx_t n) const
+  {
+    return _mm512_mask_reduce_max_ps(create_mask(n), m_value);
+  }
+
+  RAJA_INLINE
+  element_type min_n(camp::idx_t n) const
+  {
+    return _mm512_mask_reduce_min_ps(create_mask(n), m_value);
+  }
+
+  RAJA_INLINE
+  mask_type cmp_eq(Register const &b) const { return cmp<_CMP_EQ_OQ>(b); }
+
+  RAJA_INLINE
+  mask_type cmp_ne(Register const &b) const { return cmp<_CMP_NEQ_UQ>(b); }
+
+  RAJA_INLINE
+  mask_type cmp_lt(Register const &b) const { return cmp<_CMP_LT_OQ>(b); }
+
+  RAJA_INLINE
+  mask_type cmp_le(Register const &b) const { return cmp<_CMP_LE_OQ>(b); }
+
+  RAJA_INLINE
+  mask_type cmp_gt(Register const &b) const { return cmp<_CMP_GT_OQ>(b); }
+
+  RAJA_INLINE
+  mask_type cmp_ge(Register const &b) const { return cmp<_CMP_GE_OQ>(b); }
+
+private:
+  template <int Predicate>
+  RAJA_INLINE mask_type cmp(Register const &b) const
+  {
+    return static_cast<mask_type>(
+        _mm512_cmp_ps_mask(m_value, b.m_value, Predicate));
+  }
+
+  register_type m_value;
+};
+
+}  // namespace RAJA
+
+#endif  // closing endif for if defined(__AVX512F__)
+
+#endif  // closing endif for header file include guard
@@ -0,0 +1,424 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file defining the SSE2 float and double registers.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-21, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_policy_register_sse_HPP
+#define RAJA_policy_register_sse_HPP
+
+#include "RAJA/config.hpp"
+
+#if defined(__SSE2__) || defined(_M_X64)
+
+#include <emmintrin.h>
+
+#include "RAJA/pattern/register/Register.hpp"
+
+namespace RAJA
+{
+
+template <>
+class Register<double, sse_register>
+    : public internal::RegisterBase<Register<double, sse_register>, double, 2>
+{
+  RAJA_INLINE
+  static __m128d expand_mask(mask_type mask)
+  {
+    return _mm_castsi128_pd(_mm_set_epi32((mask & 2) ? -1 : 0,
+                                          (mask & 2) ? -1 : 0,
+                                          (mask & 1) ? -1 : 0,
+                                          (mask & 1) ? -1 : 0));
+  }
+
+public:
+  using register_policy = sse_register;
+  using register_type = __m128d;
+
+  RAJA_INLINE
+  Register() : m_value(_mm_setzero_pd()) {}
+
+  RAJA_INLINE
+  Register(register_type value) : m_value(value) {}
+
+  RAJA_INLINE
+  Register(element_type value) : m_value(_mm_set1_pd(value)) {}
+
+  RAJA_INLINE
+  register_type get_register() const { return m_value; }
+
+  RAJA_INLINE
+  element_type get(camp::idx_t i) const
+  {
+    return _mm_cvtsd_f64(i == 0 ? m_value : _mm_unpackhi_pd(m_value, m_value));
+  }
+
+  RAJA_INLINE
+  Register &set(camp::idx_t i, element_type value)
+  {
+    m_value = i == 0 ? _mm_move_sd(m_value, _mm_set_sd(value))
+                     : _mm_unpacklo_pd(m_value, _mm_set_sd(value));
+    return *this;
+  }
+
+  RAJA_INLINE
+  Register &broadcast(element_type value)
+  {
+    m_value = _mm_set1_pd(value);
+    return *this;
+  }
+
+  RAJA_INLINE
+  Register &load_packed(element_type const *ptr)
+  {
+    m_value = _mm_loadu_pd(ptr);
+    return *this;
+  }
+
+  RAJA_INLINE
+  Register &load_packed_n(element_type const *ptr, camp::idx_t n)
+  {
+    m_value = n >= 2 ? _mm_loadu_pd(ptr)
+                     : (n == 1 ? _mm_load_sd(ptr) : _mm_setzero_pd());
+    return *this;
+  }
+
+  RAJA_INLINE
+  Register &load_strided(element_type const *ptr, camp::idx_t stride)
+  {
+    m_value = _mm_set_pd(ptr[stride], ptr[0]);
+    return *this;
+  }
+
+  RAJA_INLINE
+  Register const &store_packed(element_type *ptr) const
+  {
+    _mm_storeu_pd(ptr, m_value);
+    return *this;
+  }
+
+  RAJA_INLINE
+  Register const &store_packed_n(element_type *ptr, camp::idx_t n) const
+  {
+    if (n >= 2) {
+      _mm_storeu_pd(ptr, m_value);
+    } else if (n == 1) {
+      _mm_store_sd(ptr, m_value);
+    }
+    return *this;
+  }
+
+  RAJA_INLINE
+  Register add(Register const &b) const
+  {
+    return Register(_mm_add_pd(m_value, b.m_value));
+  }
+
+  RAJA_INLINE
+  Register subtract(Register const &b) const
+  {
+    return Register(_mm_sub_pd(m_value, b.m_value));
+  }
+
+  RAJA_INLINE
+  Register multiply(Register const &b) const
+  {
+    return Register(_mm_mul_pd(m_value, b.m_value));
+  }
+
+  RAJA_INLINE
+  Register divide(Register const &b) const
+  {
+    return Register(_mm_div_pd(m_value, b.m_value));
+  }
+
+  RAJA_INLINE
+  Register vmin(Register const &b) const
+  {
+    return Register(_mm_min_pd(m_value, b.m_value));
+  }
+
+  RAJA_INLINE
+  Register vmax(Register const &b) const
+  {
+    return Register(_mm_max_pd(m_value, b.m_value));
+  }
+
+  RAJA_INLINE
+  Register blend(Register const &b, mask_type mask) const
+  {
+    const __m128d m = expand_mask(mask);
+    return Register(
+        _mm_or_pd(_mm_and_pd(m, b.m_value), _mm_andnot_pd(m, m_value)));
+  }
+
+  RAJA_INLINE
+  element_type sum() const
+  {
+    return _mm_cvtsd_f64(
+        _mm_add_sd(m_value, _mm_unpackhi_pd(m_value, m_value)));
+  }
+
+  RAJA_INLINE
+  element_type max() const
+  {
+    return _mm_cvtsd_f64(
+        _mm_max_sd(m_value, _mm_unpackhi_pd(m_value, m_value)));
+  }
+
+  RAJA_INLINE
+  element_type min() const
+  {
+    return _mm_cvtsd_f64(
+        _mm_min_sd(m_value, _mm_unpackhi_pd(m_value, m_value)));
+  }
+
+  RAJA_INLINE
+  mask_type cmp_eq(Register const &b) const
+  {
+    return movemask(_mm_cmpeq_pd(m_value, b.m_value));
+  }
+
+  RAJA_INLINE
+  mask_type cmp_ne(Register const &b) const
+  {
+    return movemask(_mm_cmpneq_pd(m_value, b.m_value));
+  }
+
+  RAJA_INLINE
+  mask_type cmp_lt(Register const &b) const
+  {
+    return movemask(_mm_cmplt_pd(m_value, b.m_value));
+  }
+
+  RAJA_INLINE
+  mask_type cmp_le(Register const &b) const
+  {
+    return movemask(_mm_cmple_pd(m_value, b.m_value));
+  }
+
+  RAJA_INLINE
+  mask_type cmp_gt(Register const &b) const
+  {
+    return movemask(_mm_cmpgt_pd(m_value, b.m_value));
+  }
+
+  RAJA_INLINE
+  mask_type cmp_ge(Register const &b) const
+  {
+    return movemask(_mm_cmpge_pd(m_value, b.m_value));
+  }
+
+private:
+  RAJA_INLINE
+  static mask_type movemask(__m128d m)
+  {
+    return static_cast<mask_type>(_mm_movemask_pd(m));
+  }
+
+  register_type m_value;
+};
+
+
+template <>
+class Register<float, sse_register>
+    : public internal::RegisterBase<Register<float, sse_register>, float, 4>
+{
+  RAJA_INLINE
+  static __m128 expand_mask(mask_type mask)
+  {
+    return _mm_castsi128_ps(_mm_set_epi32((mask & 8) ? -1 : 0,
+                                          (mask & 4) ? -1 : 0,
+                                          (mask & 2) ? -1 : 0,
+                                          (mask & 1) ? -1 : 0));
+  }
+
+public:
+  using register_policy = sse_register;
+  using register_type = __m128;
+
+  RAJA_INLINE
+  Register() : m_value(_mm_setzero_ps()) {}
+
+  RAJA_INLINE
+  Register(register_type value) : m_value(value) {}
+
+  RAJA_INLINE
+  Register(element_type value) : m_value(_mm_set1_ps(value)) {}
+
+  RAJA_INLINE
+  register_type get_register() const { return m_value; }
+
+  RAJA_INLINE
+  element_type get(camp::idx_t i) const
+  {
+    alignas(16) element_type lanes[4];
+    _mm_store_ps(lanes, m_value);
+    return lanes[i];
+  }
+
+  RAJA_INLINE
+  Register &set(camp::idx_t i, element_type value)
+  {
+    alignas(16) element_type lanes[4];
+    _mm_store_ps(lanes, m_value);
+    lanes[i] = value;
+    m_value = _mm_load_ps(lanes);
+    return *this;
+  }
+
+  RAJA_INLINE
+  Register &broadcast(element_type value)
+  {
+    m_value = _mm_set1_ps(value);
+    return *this;
+  }
+
+  RAJA_INLINE
+  Register &load_packed(element_type const *ptr)
+  {
+    m_value = _mm_loadu_ps(ptr);
+    return *this;
+  }
+
+  RAJA_INLINE
+  Register &load_strided(element_type const *ptr, camp::idx_t stride)
+  {
+    m_value = _mm_set_ps(ptr[3 * stride], ptr[2 * stride], ptr[stride], ptr[0]);
+    return *this;
+  }
+
+  RAJA_INLINE
+  Register const &store_packed(element_type *ptr) const
+  {
+    _mm_storeu_ps(ptr, m_value);
+    return *this;
+  }
+
+  RAJA_INLINE
+  Register add(Register const &b) const
+  {
+    return Register(_mm_add_ps(m_value, b.m_value));
+  }
+
+  RAJA_INLINE
+  Register subtract(Register const &b) const
+  {
+    return Register(_mm_sub_ps(m_value, b.m_value));
+  }
+
+  RAJA_INLINE
+  Register multiply(Register const &b) const
+  {
+    return Register(_mm_mul_ps(m_value, b.m_value));
+  }
+
+  RAJA_INLINE
+  Register divide(Register const &b) const
+  {
+    return Register(_mm_div_ps(m_value, b.m_value));
+  }
+
+  RAJA_INLINE
+  Register vmin(Register const &b) const
+  {
+    return Register(_mm_min_ps(m_value, b.m_value));
+  }
+
+  RAJA_INLINE
+  Register vmax(Register const &b) const
+  {
+    return Register(_mm_max_ps(m_value, b.m_value));
+  }
+
+  RAJA_INLINE
+  Register blend(Register const &b, mask_type mask) const
+  {
+    const __m128 m = expand_mask(mask);
+    return Register(
+        _mm_or_ps(_mm_and_ps(m, b.m_value), _mm_andnot_ps(m, m_value)));
+  }
+
+  RAJA_INLINE
+  element_type sum() const
+  {
+    __m128 s = _mm_add_ps(m_value, _mm_movehl_ps(m_value, m_value));
+    return _mm_cvtss_f32(_mm_add_ss(s, _mm_shuffle_ps(s, s, 1)));
+  }
+
+  RAJA_INLINE
+  element_type max() const
+  {
+    __m128 m = _mm_max_ps(m_value, _mm_movehl_ps(m_value, m_value));
+    return _mm_cvtss_f32(_mm_max_ss(m, _mm_shuffle_ps(m, m, 1)));
+  }
+
+  RAJA_INLINE
+  element_type min() const
+  {
+    __m128 m = _mm_min_ps(m_value, _mm_movehl_ps(m_value, m_value));
+    return _mm_cvtss_f32(_mm_min_ss(m, _mm_shuffle_ps(m, m, 1)));
+  }
+
+  RAJA_INLINE
+  mask_type cmp_eq(Register const &b) const
+  {
+    return movemask(_mm_cmpeq_ps(m_value, b.m_value));
+  }
+
+  RAJA_INLINE
+  mask_type cmp_ne(Register const &b) const
+  {
+    return movemask(_mm_cmpneq_ps(m_value, b.m_value));
+  }
+
+  RAJA_INLINE
+  mask_type cmp_lt(Register const &b) const
+  {
+    return movemask(_mm_cmplt_ps(m_value, b.m_value));
+  }
+
+  RAJA_INLINE
+  mask_type cmp_le(Register const &b) const
+  {
+    return movemask(_mm_cmple_ps(m_value, b.m_value));
+  }
+
+  RAJA_INLINE
+  mask_type cmp_gt(Register const &b) const
+  {
+    return movemask(_mm_cmpgt_ps(m_value, b.m_value));
+  }
+
+  RAJA_INLINE
+  mask_type cmp_ge(Register const &b) const
+  {
+    return movemask(_mm_cmpge_ps(m_value, b.m_value));
+  }
+
+private:
+  RAJA_INLINE
+  static mask_type movemask(__m128 m)
+  {
+    return static_cast<mask_type>(_mm_movemask_ps(m));
+  }
+
+  register_type m_value;
+};
+
+}  // namespace RAJA
+
+#endif  // closing endif for if defined(__SSE2__)
+
+#endif  // closing endif for header file include guard
@@ -28,6 +28,7 @@
 #include "RAJA/pattern/detail/reduce.hpp"
 #include "RAJA/pattern/reduce.hpp"
 
+#include "RAJA/policy/atomic_builtin.hpp"
 #include "RAJA/policy/sequential/policy.hpp"
 
 #include "RAJA/util/types.hpp"
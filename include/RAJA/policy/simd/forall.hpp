@@ -35,8 +35,13 @@
 
 #include "RAJA/internal/fault_tolerance.hpp"
 
+#include "RAJA/pattern/detail/reduce.hpp"
+
+#include "RAJA/policy/register/arch.hpp"
 #include "RAJA/policy/simd/policy.hpp"
 
+#include "camp/camp.hpp"
+
 namespace RAJA
 {
 namespace policy
@@ -44,7 +49,100 @@ namespace policy
 namespace simd
 {
 
+namespace internal
+{
+
+//! lanes of a register of floats on the target, at least 4
+static constexpr camp::idx_t default_num_lanes =
+    default_register::s_bytes / sizeof(float) > 4
+        ? static_cast<camp::idx_t>(default_register::s_bytes / sizeof(float))
+        : 4;
+
+/*!
+ * \brief NumLanes copies of a loop body, one per SIMD lane.
+ *
+ * Copying the body privatizes the reducers it captures, as thread_privatize
+ * does for threads, so lane k accumulates into its own copy and the copies
+ * combine into the original reducer when they are destroyed. With the lane
+ * loop fully unrolled the accumulators of all lanes live in one register
+ * and the loop carries no dependence through a single reducer.
+ */
+template <typename Func, camp::idx_t NumLanes = default_num_lanes>
+class SimdLanes
+{
+  Func m_lanes[NumLanes];
+
+  template <camp::idx_t... Lanes>
+  RAJA_INLINE SimdLanes(Func const &body, camp::idx_seq<Lanes...>)
+      : m_lanes{((void)Lanes, body)...}
+  {
+  }
+
+public:
+  static constexpr camp::idx_t num_lanes = NumLanes;
+
+  RAJA_INLINE
+  explicit SimdLanes(Func const &body)
+      : SimdLanes(body, camp::make_idx_seq_t<NumLanes>{})
+  {
+  }
 
+  //! run iterations [lo, hi) of the iterator begin
+  template <typename Iterator, typename DiffT>
+  RAJA_INLINE void operator()(Iterator begin, DiffT lo, DiffT hi)
+  {
+    DiffT i = lo;
+    for (; i + NumLanes <= hi; i += NumLanes) {
+      // a simd pragma here keeps compilers from unrolling the lanes
+      for (camp::idx_t lane = 0; lane < NumLanes; ++lane) {
+        m_lanes[lane](*(begin + i + lane));
+      }
+    }
+    for (; i < hi; ++i) {
+      m_lanes[0](*(begin + i));
+    }
+  }
+};
+
+/*!
+ * \brief Returns true if loop bodies of type Func capture host reducers.
+ *
+ * Whether copying a body copies reducers only depends on its type, so
+ * the first body of each type is copied once, with a
+ * reducer_copy_probe set, to find out.
+ */
+template <typename Func>
+RAJA_INLINE bool captures_reducers(Func const &body)
+{
+  struct ProbeGuard {
+    unsigned long count = 0;
+    unsigned long *outer;
+    ProbeGuard() : outer(::RAJA::reduce::detail::reducer_copy_probe())
+    {
+      ::RAJA::reduce::detail::reducer_copy_probe() = &count;
+    }
+    ~ProbeGuard() { ::RAJA::reduce::detail::reducer_copy_probe() = outer; }
+  };
+
+  static const bool captures = [&body]() {
+    ProbeGuard guard;
+    {
+      Func copy(body);
+      RAJA_UNUSED_VAR(copy);
+    }
+    return guard.count != 0;
+  }();
+  return captures;
+}
+
+}  // namespace internal
+
+
+/*!
+ * Runs the iterations in a RAJA_SIMD loop. Loop bodies that capture
+ * reducers instead run through one copy of loop_body per SIMD lane, see
+ * internal::SimdLanes, so the reductions vectorize.
+ */
 template <typename Iterable, typename Func>
 RAJA_INLINE resources::EventProxy<resources::Host> forall_impl(RAJA::resources::Host host_res,
                                                                const simd_exec &,
@@ -54,9 +152,14 @@ RAJA_INLINE resources::EventProxy<resources::Host> forall_impl(RAJA::resources::
   auto begin = std::begin(iter);
   auto end = std::end(iter);
   auto distance = std::distance(begin, end);
-  RAJA_SIMD
-  for (decltype(distance) i = 0; i < distance; ++i) {
-    loop_body(*(begin + i));
+  if (internal::captures_reducers(loop_body)) {
+    internal::SimdLanes<camp::decay<Func>> lanes(loop_body);
+    lanes(begin, decltype(distance)(0), distance);
+  } else {
+    RAJA_SIMD
+    for (decltype(distance) i = 0; i < distance; ++i) {
+      loop_body(*(begin + i));
+    }
   }
 
   return RAJA::resources::EventProxy<resources::Host>(host_res);
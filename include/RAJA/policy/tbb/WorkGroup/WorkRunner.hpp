@@ -20,6 +20,8 @@
 
 #include "RAJA/config.hpp"
 
+#include <tbb/task_group.h>
+
 #include "RAJA/policy/tbb/policy.hpp"
 
 #include "RAJA/pattern/WorkGroup/WorkRunner.hpp"
@@ -75,6 +77,61 @@ struct WorkRunner<
         Args...>
 { };
 
+/*!
+ * Runs work in a storage container concurrently using a TBB task_group,
+ * one task per loop, and returns any per run resources
+ */
+template <typename ALLOCATOR_T,
+          typename INDEX_T,
+          typename ... Args>
+struct WorkRunner<
+        RAJA::tbb_work,
+        RAJA::unordered_tbb_task_group,
+        ALLOCATOR_T,
+        INDEX_T,
+        Args...>
+    : WorkRunnerForallOrdered_base<
+        RAJA::tbb_for_exec,
+        RAJA::tbb_work,
+        RAJA::unordered_tbb_task_group,
+        ALLOCATOR_T,
+        INDEX_T,
+        Args...>
+{
+  using base = WorkRunnerForallOrdered_base<
+        RAJA::tbb_for_exec,
+        RAJA::tbb_work,
+        RAJA::unordered_tbb_task_group,
+        ALLOCATOR_T,
+        INDEX_T,
+        Args...>;
+  using base::base;
+
+  // run the loops concurrently, each loop is itself a tbb parallel_for
+  // so large loops are still split across threads
+  template < typename WorkContainer >
+  typename base::per_run_storage run(WorkContainer const& storage, Args... args) const
+  {
+    using value_type = typename WorkContainer::value_type;
+
+    typename base::per_run_storage run_storage{};
+
+    ::tbb::task_group tasks;
+
+    auto end = storage.end();
+    for (auto iter = storage.begin(); iter != end; ++iter) {
+      const value_type* loop = &*iter;
+      tasks.run([&, loop]() {
+        value_type::call(loop, args...);
+      });
+    }
+
+    tasks.wait();
+
+    return run_storage;
+  }
+};
+
 }  // namespace detail
 
 }  // namespace RAJA
@@ -74,6 +74,13 @@ struct tbb_work : make_policy_pattern_launch_platform_t<Policy::tbb,
                                                         Platform::host> {
 };
 
+///
+struct unordered_tbb_task_group
+    : make_policy_pattern_platform_t<Policy::tbb,
+                                     Pattern::workgroup_order,
+                                     Platform::host> {
+};
+
 
 ///
 ///////////////////////////////////////////////////////////////////////
@@ -97,6 +104,7 @@ using policy::tbb::tbb_for_static;
 using policy::tbb::tbb_reduce;
 using policy::tbb::tbb_segit;
 using policy::tbb::tbb_work;
+using policy::tbb::unordered_tbb_task_group;
 
 }  // namespace RAJA
 
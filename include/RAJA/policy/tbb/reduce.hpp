@@ -25,8 +25,10 @@
 
 #if defined(RAJA_ENABLE_TBB)
 
+#include <atomic>
 #include <memory>
 #include <tuple>
+#include <vector>
 
 #include <tbb/tbb.h>
 
@@ -35,6 +37,7 @@
 #include "RAJA/pattern/detail/reduce.hpp"
 #include "RAJA/pattern/reduce.hpp"
 
+#include "RAJA/policy/atomic_builtin.hpp"
 #include "RAJA/policy/tbb/policy.hpp"
 
 #include "RAJA/util/types.hpp"
@@ -44,43 +47,143 @@ namespace RAJA
 
 namespace detail
 {
+/*!
+ * Reducer for tbb_reduce with parallel_reduce style semantics.
+ *
+ * Every copy of the reducer made by a TBB task accumulates into its own
+ * value, without touching shared state. When a copy is destroyed its value
+ * is joined into the cache line padded partial of its arena slot, so joins
+ * need no locks. get() combines the partials in a tree.
+ *
+ * Slot indices are only unique within one arena, and TBB has no public
+ * arena id, so the first thread to join into a slot claims it. Any other
+ * thread with the same index, e.g. from another arena or a worker that
+ * took over the slot later, and threads outside any arena, join under a
+ * lock.
+ */
 template <typename T, typename Reduce>
 class ReduceTBB
+    : public reduce::detail::BaseCombinable<T, Reduce, ReduceTBB<T, Reduce>>
 {
-  //! TBB native per-thread container
-  std::shared_ptr<tbb::combinable<T>> data;
+  using Base = reduce::detail::BaseCombinable<T, Reduce, ReduceTBB>;
+
+  struct alignas(64) Partial {
+    T value;
+    std::atomic<const void*> owner;
+
+    explicit Partial(T val) : value(val), owner(nullptr) {}
+
+    Partial(const Partial& other) : value(other.value), owner(nullptr) {}
+
+    Partial& operator=(const Partial& other)
+    {
+      value = other.value;
+      owner.store(nullptr, std::memory_order_relaxed);
+      return *this;
+    }
+  };
+
+  //! address unique to the calling thread, identifies slot owners
+  static const void* thread_key()
+  {
+    static thread_local char key;
+    return &key;
+  }
+
+  static bool claim(Partial& part)
+  {
+    const void* key = thread_key();
+    const void* owner = part.owner.load(std::memory_order_relaxed);
+    if (owner == nullptr &&
+        part.owner.compare_exchange_strong(owner,
+                                           key,
+                                           std::memory_order_relaxed)) {
+      return true;
+    }
+    return owner == key;
+  }
+
+  struct Partials {
+    std::vector<Partial, tbb::cache_aligned_allocator<Partial>> data;
+    tbb::spin_mutex mutex;
+    T overflow;
+  };
+
+  //! only the reducer constructed by the user owns the partials,
+  //! copies reach them through Base::parent
+  std::unique_ptr<Partials> partials;
+
+  Partials& root_partials() const
+  {
+    return Base::parent
+               ? *static_cast<const ReduceTBB*>(Base::parent)->partials
+               : *partials;
+  }
 
 public:
   //! default constructor calls the reset method
-  ReduceTBB() { reset(T(), T()); }
+  ReduceTBB() : Base() { reset(T(), T()); }
 
   //! constructor requires a default value for the reducer
-  explicit ReduceTBB(T init_val, T initializer)
+  explicit ReduceTBB(T init_val, T identity_) : Base(init_val, identity_)
   {
-    reset(init_val, initializer);
+    reset(init_val, identity_);
   }
 
-  void reset(T init_val, T initializer)
+  ReduceTBB(const ReduceTBB& other) : Base(other) {}
+
+  void reset(T init_val, T identity_)
   {
-    data = std::shared_ptr<tbb::combinable<T>>(
-        std::make_shared<tbb::combinable<T>>([=]() { return initializer; }));
-    data->local() = init_val;
+    Base::reset(init_val, identity_);
+    if (!partials) {
+      partials.reset(new Partials);
+    }
+    partials->data.assign(tbb::this_task_arena::max_concurrency(),
+                          Partial{identity_});
+    partials->overflow = identity_;
   }
 
-  /*!
-   *  \return the calculated reduced value
-   */
-  T get() const { return data->combine(typename Reduce::operator_type{}); }
-
-  /*!
-   *  \return update the local value
-   */
-  void combine(const T& other) { Reduce{}(this->local(), other); }
+  ~ReduceTBB()
+  {
+    if (Base::parent && Base::my_data != Base::identity) {
+      Partials& p = root_partials();
+      const int id = tbb::this_task_arena::current_thread_index();
+      if (id >= 0 && static_cast<size_t>(id) < p.data.size() &&
+          claim(p.data[id])) {
+        Reduce{}(p.data[id].value, Base::my_data);
+      } else {
+        tbb::spin_mutex::scoped_lock lock(p.mutex);
+        Reduce{}(p.overflow, Base::my_data);
+      }
+      Base::my_data = Base::identity;
+    }
+  }
 
-  /*!
-   *  \return reference to the local value
-   */
-  T& local() { return data->local(); }
+  T get_combined() const
+  {
+    if (Base::parent) {
+      return static_cast<const ReduceTBB*>(Base::parent)->get_combined();
+    }
+
+    // pairwise combine the per thread partials
+    std::vector<T> values;
+    values.reserve(partials->data.size());
+    for (const Partial& part : partials->data) {
+      values.push_back(part.value);
+    }
+    for (size_t stride = 1; stride < values.size(); stride *= 2) {
+      for (size_t i = 0; i + stride < values.size(); i += 2 * stride) {
+        Reduce{}(values[i], values[i + stride]);
+      }
+    }
+
+    T res = Base::my_data;
+    if (!values.empty()) {
+      Reduce{}(res, values[0]);
+    }
+    Reduce{}(res, partials->overflow);
+    return res;
+  }
 };
 }  // namespace detail
 
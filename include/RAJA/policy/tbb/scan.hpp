@@ -98,6 +98,84 @@ struct scan_adapter_exclusive : scan_adapter<T, InIter, OutIter, Fn> {
     }
   }
 };
+/*!
+    \brief parallel_scan body for segmented scans; the state is the
+    aggregate of the open segment and whether a segment head was seen
+*/
+template <typename T, typename HeadFn, typename InIter, typename OutIter,
+          typename Fn, bool Inclusive>
+struct segmented_scan_adapter {
+  T agg;
+  bool has_head;
+  HeadFn is_head;
+  InIter in;
+  OutIter out;
+  Fn fn;
+  T const init;
+
+  segmented_scan_adapter(HeadFn is_head_,
+                         InIter in_,
+                         OutIter out_,
+                         Fn fn_,
+                         T const& init_)
+      : agg(Fn::identity()),
+        has_head(false),
+        is_head(is_head_),
+        in(in_),
+        out(out_),
+        fn(fn_),
+        init(init_)
+  {
+  }
+
+  segmented_scan_adapter(segmented_scan_adapter& b, tbb::split)
+      : agg(Fn::identity()),
+        has_head(false),
+        is_head(b.is_head),
+        in(b.in),
+        out(b.out),
+        fn(b.fn),
+        init(b.init)
+  {
+  }
+
+  template <typename Tag>
+  void operator()(const tbb::blocked_range<Index_type>& r, Tag)
+  {
+    T temp = agg;
+    for (Index_type i = r.begin(); i < r.end(); ++i) {
+      auto t = in[i];
+      if (Inclusive) {
+        if (is_head(i)) {
+          has_head = true;
+          temp = t;
+        } else {
+          temp = fn(temp, t);
+        }
+        if (Tag::is_final_scan()) out[i] = temp;
+      } else {
+        if (is_head(i)) {
+          has_head = true;
+          temp = init;
+        }
+        if (Tag::is_final_scan()) out[i] = temp;
+        temp = fn(temp, t);
+      }
+    }
+    agg = temp;
+  }
+
+  void reverse_join(const segmented_scan_adapter& a)
+  {
+    if (!has_head) agg = fn(a.agg, agg);
+    has_head = has_head || a.has_head;
+  }
+  void assign(const segmented_scan_adapter& b)
+  {
+    agg = b.agg;
+    has_head = b.has_head;
+  }
+};
 }  // namespace detail
 
 /*!
@@ -216,6 +294,78 @@ exclusive(
   return resources::EventProxy<resources::Host>(host_res);
 }
 
+/*!
+        \brief explicit inclusive segmented scan given input range, segment
+   head predicate, output, and function
+*/
+template <typename ExecPolicy,
+          typename HeadFn,
+          typename Iter,
+          typename OutIter,
+          typename BinFn>
+RAJA_INLINE
+concepts::enable_if_t<resources::EventProxy<resources::Host>,
+                      type_traits::is_tbb_policy<ExecPolicy>>
+inclusive_segmented(
+    resources::Host host_res,
+    const ExecPolicy&,
+    HeadFn is_head,
+    const Iter begin,
+    const Iter end,
+    OutIter out,
+    BinFn f)
+{
+  auto adapter = detail::segmented_scan_adapter<
+      typename std::iterator_traits<OutIter>::value_type,
+      HeadFn,
+      Iter,
+      OutIter,
+      BinFn,
+      true>{is_head, begin, out, f, BinFn::identity()};
+  tbb::parallel_scan(tbb::blocked_range<Index_type>{0,
+                                                    std::distance(begin, end)},
+                     adapter);
+
+  return resources::EventProxy<resources::Host>(host_res);
+}
+
+/*!
+        \brief explicit exclusive segmented scan given input range, segment
+   head predicate, output, function, and initial value
+*/
+template <typename ExecPolicy,
+          typename HeadFn,
+          typename Iter,
+          typename OutIter,
+          typename BinFn,
+          typename T>
+RAJA_INLINE
+concepts::enable_if_t<resources::EventProxy<resources::Host>,
+                      type_traits::is_tbb_policy<ExecPolicy>>
+exclusive_segmented(
+    resources::Host host_res,
+    const ExecPolicy&,
+    HeadFn is_head,
+    const Iter begin,
+    const Iter end,
+    OutIter out,
+    BinFn f,
+    T v)
+{
+  auto adapter = detail::segmented_scan_adapter<
+      typename std::iterator_traits<OutIter>::value_type,
+      HeadFn,
+      Iter,
+      OutIter,
+      BinFn,
+      false>{is_head, begin, out, f, v};
+  tbb::parallel_scan(tbb::blocked_range<Index_type>{0,
+                                                    std::distance(begin, end)},
+                     adapter);
+
+  return resources::EventProxy<resources::Host>(host_res);
+}
+
 }  // namespace scan
 
 }  // namespace impl
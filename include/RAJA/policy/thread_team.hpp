@@ -0,0 +1,33 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file containing RAJA headers for execution on a
+ *          persistent thread team.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-21, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_thread_team_HPP
+#define RAJA_thread_team_HPP
+
+#include "RAJA/config.hpp"
+
+#if defined(RAJA_ENABLE_THREAD_TEAM)
+
+#include "RAJA/policy/thread_team/policy.hpp"
+#include "RAJA/policy/thread_team/team.hpp"
+#include "RAJA/policy/thread_team/forall.hpp"
+#include "RAJA/policy/thread_team/reduce.hpp"
+
+#endif
+
+#endif  // closing endif for header file include guard
@@ -0,0 +1,86 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file containing RAJA index set and segment iteration
+ *          template methods for the persistent thread team.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-21, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_forall_thread_team_HPP
+#define RAJA_forall_thread_team_HPP
+
+#include "RAJA/config.hpp"
+
+#if defined(RAJA_ENABLE_THREAD_TEAM)
+
+#include "RAJA/index/IndexSet.hpp"
+#include "RAJA/index/ListSegment.hpp"
+#include "RAJA/index/RangeSegment.hpp"
+#include "RAJA/internal/fault_tolerance.hpp"
+#include "RAJA/pattern/forall.hpp"
+#include "RAJA/policy/thread_team/policy.hpp"
+#include "RAJA/policy/thread_team/team.hpp"
+#include "RAJA/util/types.hpp"
+
+namespace RAJA
+{
+namespace policy
+{
+namespace thread_team
+{
+
+/**
+ * @brief Persistent thread team for implementation
+ *
+ * @param iter any iterable
+ * @param loop_body loop body
+ *
+ * Runs the loop on the threads of the persistent team, each thread runs its
+ * part of the static partition with its own copy of the loop body. Unlike
+ * the OpenMP policies no parallel region is created, the workers wait for
+ * the launch in a spin loop, so short loops avoid most of the fork/join
+ * cost.
+ */
+template <typename Iterable, typename Func, int ChunkSize>
+RAJA_INLINE resources::EventProxy<resources::Host> forall_impl(
+    resources::Host host_res,
+    const thread_team_for_exec<ChunkSize>&,
+    Iterable&& iter,
+    Func&& loop_body)
+{
+  RAJA_EXTRACT_BED_IT(iter);
+  using diff_type = decltype(distance_it);
+
+  if (distance_it > 0) {
+    ::RAJA::detail::ThreadTeam::get().run([&](int thread, int num_threads) {
+      using RAJA::internal::thread_privatize;
+      auto body = thread_privatize(loop_body);
+      ::RAJA::detail::ThreadTeam::for_static<ChunkSize>(
+          thread, num_threads, distance_it, [&](diff_type i) {
+            body.get_priv()(begin_it[i]);
+          });
+    });
+  }
+
+  return resources::EventProxy<resources::Host>(host_res);
+}
+
+}  // namespace thread_team
+
+}  // namespace policy
+
+}  // namespace RAJA
+
+#endif  // closing endif for if defined(RAJA_ENABLE_THREAD_TEAM)
+
+#endif  // closing endif for header file include guard
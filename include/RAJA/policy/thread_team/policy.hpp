@@ -0,0 +1,83 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file containing RAJA persistent thread team policy
+ *          definitions.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-21, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef policy_thread_team_HPP
+#define policy_thread_team_HPP
+
+#include "RAJA/policy/PolicyBase.hpp"
+
+namespace RAJA
+{
+namespace policy
+{
+namespace thread_team
+{
+
+//
+//////////////////////////////////////////////////////////////////////
+//
+// Execution policies
+//
+//////////////////////////////////////////////////////////////////////
+//
+
+///
+/// Segment execution policy, the iteration space is split statically
+/// over the threads of the persistent team. With ChunkSize > 0 chunks of
+/// ChunkSize iterations are dealt to threads round robin, otherwise each
+/// thread gets one contiguous block.
+///
+template <int ChunkSize = -1>
+struct thread_team_for_exec
+    : make_policy_pattern_launch_platform_t<Policy::thread_team,
+                                            Pattern::forall,
+                                            Launch::undefined,
+                                            Platform::host> {
+  static constexpr int chunk_size = ChunkSize;
+};
+
+///
+/// Index set segment iteration policies
+///
+using thread_team_segit = thread_team_for_exec<>;
+
+//
+//////////////////////////////////////////////////////////////////////
+//
+// Reduction policies
+//
+//////////////////////////////////////////////////////////////////////
+//
+
+struct thread_team_reduce
+    : make_policy_pattern_launch_platform_t<Policy::thread_team,
+                                            Pattern::reduce,
+                                            Launch::undefined,
+                                            Platform::host> {
+};
+
+}  // namespace thread_team
+}  // namespace policy
+
+using policy::thread_team::thread_team_for_exec;
+using policy::thread_team::thread_team_segit;
+using policy::thread_team::thread_team_reduce;
+
+}  // namespace RAJA
+
+#endif
@@ -0,0 +1,170 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file containing RAJA reduction templates for the
+ *          persistent thread team.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-21, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_thread_team_reduce_HPP
+#define RAJA_thread_team_reduce_HPP
+
+#include "RAJA/config.hpp"
+
+#if defined(RAJA_ENABLE_THREAD_TEAM)
+
+#include <memory>
+#include <mutex>
+#include <new>
+#include <vector>
+
+#include "RAJA/internal/MemUtils_CPU.hpp"
+
+#include "RAJA/pattern/detail/reduce.hpp"
+#include "RAJA/pattern/reduce.hpp"
+
+#include "RAJA/policy/atomic_builtin.hpp"
+#include "RAJA/policy/thread_team/policy.hpp"
+#include "RAJA/policy/thread_team/team.hpp"
+
+#include "RAJA/util/types.hpp"
+
+namespace RAJA
+{
+
+namespace detail
+{
+/*!
+ * Reducer for thread_team_reduce.
+ *
+ * Copies destroyed by the threads of a thread team launch combine into the
+ * cache line padded partial of their thread without locking. Copies
+ * destroyed anywhere else, such as in launches that run on a single thread,
+ * combine under a lock held by the reducer. get() combines the partials in
+ * a tree.
+ */
+template <typename T, typename Reduce>
+class ReduceThreadTeam
+    : public reduce::detail::BaseCombinable<T,
+                                            Reduce,
+                                            ReduceThreadTeam<T, Reduce>>
+{
+  using Base = reduce::detail::BaseCombinable<T, Reduce, ReduceThreadTeam>;
+
+  struct alignas(64) Partial {
+    T value;
+  };
+
+  using deleter = FreeAlignedType<Partial, size_t>;
+
+  struct Partials {
+    std::unique_ptr<Partial, deleter> data{nullptr, deleter{}};
+    std::mutex mutex;
+    T overflow;
+
+    size_t size() const { return data.get_deleter().size; }
+  };
+
+  //! only the reducer constructed by the user owns the partials,
+  //! copies reach them through Base::parent
+  std::unique_ptr<Partials> partials;
+
+  Partials& root_partials() const
+  {
+    return Base::parent
+               ? *static_cast<const ReduceThreadTeam*>(Base::parent)->partials
+               : *partials;
+  }
+
+public:
+  //! prohibit compiler-generated default ctor
+  ReduceThreadTeam() = delete;
+
+  explicit ReduceThreadTeam(T init_val, T identity_ = T())
+      : Base(init_val, identity_)
+  {
+    reset(init_val, identity_);
+  }
+
+  ReduceThreadTeam(const ReduceThreadTeam& other) : Base(other) {}
+
+  void reset(T init_val, T identity_)
+  {
+    Base::reset(init_val, identity_);
+    if (!partials) {
+      partials.reset(new Partials);
+    }
+    const size_t num_partials = ThreadTeam::get().get_num_threads();
+    partials->data.reset(allocate_aligned_type<Partial>(
+        alignof(Partial), num_partials * sizeof(Partial)));
+    partials->data.get_deleter().size = 0;
+    for (size_t i = 0; i < num_partials; ++i) {
+      new (&partials->data.get()[i]) Partial{identity_};
+      ++partials->data.get_deleter().size;
+    }
+    partials->overflow = identity_;
+  }
+
+  ~ReduceThreadTeam()
+  {
+    if (Base::parent && Base::my_data != Base::identity) {
+      Partials& p = root_partials();
+      const size_t id = static_cast<size_t>(ThreadTeam::thread_num());
+      if (ThreadTeam::team_size() > 1 && id < p.size()) {
+        Reduce{}(p.data.get()[id].value, Base::my_data);
+      } else {
+        std::lock_guard<std::mutex> lock(p.mutex);
+        Reduce{}(p.overflow, Base::my_data);
+      }
+      Base::my_data = Base::identity;
+    }
+  }
+
+  T get_combined() const
+  {
+    if (Base::parent) {
+      return static_cast<const ReduceThreadTeam*>(Base::parent)
+          ->get_combined();
+    }
+
+    // pairwise combine the per thread partials
+    std::vector<T> values;
+    values.reserve(partials->size());
+    for (size_t i = 0; i < partials->size(); ++i) {
+      values.push_back(partials->data.get()[i].value);
+    }
+    for (size_t stride = 1; stride < values.size(); stride *= 2) {
+      for (size_t i = 0; i + stride < values.size(); i += 2 * stride) {
+        Reduce{}(values[i], values[i + stride]);
+      }
+    }
+
+    T res = Base::my_data;
+    if (!values.empty()) {
+      Reduce{}(res, values[0]);
+    }
+    std::lock_guard<std::mutex> lock(partials->mutex);
+    Reduce{}(res, partials->overflow);
+    return res;
+  }
+};
+
+}  // namespace detail
+
+RAJA_DECLARE_ALL_REDUCERS(thread_team_reduce, detail::ReduceThreadTeam)
+
+}  // namespace RAJA
+
+#endif  // closing endif for if defined(RAJA_ENABLE_THREAD_TEAM)
+
+#endif  // closing endif for header file include guard
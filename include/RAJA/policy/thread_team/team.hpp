@@ -0,0 +1,382 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file defining the persistent thread team that runs
+ *          thread_team policies.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-21, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_thread_team_team_HPP
+#define RAJA_thread_team_team_HPP
+
+#include "RAJA/config.hpp"
+
+#if defined(RAJA_ENABLE_THREAD_TEAM)
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdlib>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#include "RAJA/util/macros.hpp"
+
+namespace RAJA
+{
+
+namespace detail
+{
+
+//! Hint to the processor that the calling thread is spin waiting
+RAJA_INLINE void thread_team_cpu_relax()
+{
+#if (defined(__GNUC__) || defined(__clang__)) && \
+    (defined(__x86_64__) || defined(__i386__))
+  __builtin_ia32_pause();
+#elif (defined(__GNUC__) || defined(__clang__)) && defined(__aarch64__)
+  asm volatile("yield");
+#endif
+}
+
+/*!
+ * \brief Team of worker threads that stay alive between launches.
+ *
+ * run(func) calls func(thread, num_threads) on every thread of the team,
+ * the calling thread is thread 0, and returns when all calls are done.
+ * Between launches the workers spin for a while, so back to back launches
+ * start without a system call, and then park on a condition variable.
+ * barrier() synchronizes the threads of a running launch.
+ *
+ * One launch runs on the team at a time. Launches from inside a launch, or
+ * from another thread while the team is busy, run on the calling thread
+ * alone as a team of one.
+ *
+ * The team has RAJA_THREAD_TEAM_NUM_THREADS threads if that environment
+ * variable is set, and std::thread::hardware_concurrency() otherwise.
+ */
+class ThreadTeam
+{
+public:
+  //! iterations a waiting thread spins before it parks or yields, when the
+  //! team has no more threads than the machine has hardware threads
+  static constexpr int spin_count = 1 << 14;
+
+  static ThreadTeam& get()
+  {
+    static ThreadTeam team;
+    return team;
+  }
+
+  ThreadTeam(ThreadTeam const&) = delete;
+  ThreadTeam& operator=(ThreadTeam const&) = delete;
+
+  ~ThreadTeam()
+  {
+    std::lock_guard<std::mutex> lock(m_dispatch_mutex);
+    stop_workers();
+  }
+
+  int get_num_threads() const { return m_requested.load(); }
+
+  //! Set the size of the team, takes effect at the next launch
+  void set_num_threads(int num_threads)
+  {
+    if (context().team != nullptr) {
+      RAJA_ABORT_OR_THROW(
+          "ThreadTeam size cannot be changed from inside a launch");
+    }
+    m_requested.store(num_threads > 0 ? num_threads : 1);
+  }
+
+  //! Thread number of the calling thread in its running launch, or 0
+  static int thread_num() { return context().thread; }
+
+  //! Number of threads in the running launch of the calling thread, or 1
+  static int team_size() { return context().num_threads; }
+
+  template <typename Func>
+  void run(Func&& func)
+  {
+    using func_type = typename std::remove_reference<Func>::type;
+
+    std::unique_lock<std::mutex> lock(m_dispatch_mutex, std::defer_lock);
+    if (context().team != nullptr || !lock.try_lock()) {
+      run_alone(func);
+      return;
+    }
+
+    const int num_threads = m_requested.load();
+    if (static_cast<int>(m_workers.size()) != num_threads - 1) {
+      stop_workers();
+      start_workers(num_threads - 1);
+    }
+    if (num_threads == 1) {
+      run_alone(func);
+      return;
+    }
+
+    m_invoke = &invoke<func_type>;
+    m_func = const_cast<void*>(static_cast<const void*>(&func));
+    m_num_threads = num_threads;
+    m_remaining.store(num_threads - 1, std::memory_order_relaxed);
+    m_barrier_count.store(0, std::memory_order_relaxed);
+    wake_workers();
+
+    ContextGuard context_guard(this, 0, num_threads);
+    CompletionGuard completion_guard(*this);
+    func(0, num_threads);
+  }
+
+  /// Call body(i) for the iterations in [0, len) that thread gets in the
+  /// static partition of thread_team_for_exec<ChunkSize>
+  template <int ChunkSize, typename IndexType, typename Func>
+  static void for_static(int thread,
+                         int num_threads,
+                         IndexType len,
+                         Func&& body)
+  {
+    if (ChunkSize > 0) {
+      const IndexType stride = static_cast<IndexType>(ChunkSize) * num_threads;
+      for (IndexType c = static_cast<IndexType>(ChunkSize) * thread; c < len;
+           c += stride) {
+        const IndexType c_end = (len - c < ChunkSize) ? len : c + ChunkSize;
+        for (IndexType i = c; i < c_end; ++i) {
+          body(i);
+        }
+      }
+    } else {
+      // balanced blocks, the first len % num_threads threads get one more
+      const IndexType block = len / num_threads;
+      const IndexType extra = len % num_threads;
+      const IndexType begin =
+          block * thread + (thread < extra ? thread : extra);
+      const IndexType end = begin + block + (thread < extra ? 1 : 0);
+      for (IndexType i = begin; i < end; ++i) {
+        body(i);
+      }
+    }
+  }
+
+  /// Wait until every thread of the running launch has reached the barrier.
+  /// Must be called by all threads of the launch, or by none.
+  static void barrier()
+  {
+    const Context& ctx = context();
+    if (ctx.num_threads > 1) {
+      ctx.team->barrier_wait(ctx.num_threads);
+    }
+  }
+
+private:
+  struct Context {
+    ThreadTeam* team;
+    int thread;
+    int num_threads;
+  };
+
+  static Context& context()
+  {
+    static thread_local Context ctx{nullptr, 0, 1};
+    return ctx;
+  }
+
+  //! Sets the context of the calling thread for the duration of a launch
+  struct ContextGuard {
+    Context saved;
+
+    ContextGuard(ThreadTeam* team, int thread, int num_threads)
+        : saved(context())
+    {
+      context() = Context{team, thread, num_threads};
+    }
+    ~ContextGuard() { context() = saved; }
+  };
+
+  //! Waits for the workers, also when thread 0 throws
+  struct CompletionGuard {
+    ThreadTeam& team;
+
+    explicit CompletionGuard(ThreadTeam& team_) : team(team_) {}
+    ~CompletionGuard()
+    {
+      while (!team.spin_until([&]() {
+        return team.m_remaining.load(std::memory_order_acquire) == 0;
+      })) {
+        std::this_thread::yield();
+      }
+    }
+  };
+
+  template <typename Func>
+  static void invoke(void* func, int thread, int num_threads)
+  {
+    (*static_cast<Func*>(func))(thread, num_threads);
+  }
+
+  template <typename Func>
+  void run_alone(Func& func)
+  {
+    ContextGuard context_guard(this, 0, 1);
+    func(0, 1);
+  }
+
+  ThreadTeam()
+  {
+    int num_threads = static_cast<int>(std::thread::hardware_concurrency());
+    const char* env = std::getenv("RAJA_THREAD_TEAM_NUM_THREADS");
+    if (env) {
+      num_threads = std::atoi(env);
+    }
+    m_requested.store(num_threads > 0 ? num_threads : 1);
+  }
+
+  //! Spin until done() returns true or m_spin_count spins have passed,
+  //! returns the last value of done()
+  template <typename Pred>
+  bool spin_until(Pred&& done) const
+  {
+    for (int spins = 0; spins < m_spin_count; ++spins) {
+      if (done()) {
+        return true;
+      }
+      thread_team_cpu_relax();
+    }
+    return done();
+  }
+
+  void start_workers(int num_workers)
+  {
+    // spinning threads that share processors delay the threads doing the
+    // work, oversubscribed teams yield and park right away
+    const unsigned num_procs = std::thread::hardware_concurrency();
+    m_spin_count = (num_procs == 0 ||
+                    static_cast<unsigned>(num_workers) < num_procs)
+                       ? spin_count
+                       : 0;
+    m_stop.store(false);
+    const unsigned long long generation = m_generation.load();
+    for (int t = 1; t <= num_workers; ++t) {
+      m_workers.emplace_back(&ThreadTeam::work, this, t, generation);
+    }
+  }
+
+  void stop_workers()
+  {
+    if (m_workers.empty()) {
+      return;
+    }
+    m_stop.store(true);
+    wake_workers();
+    for (std::thread& worker : m_workers) {
+      worker.join();
+    }
+    m_workers.clear();
+  }
+
+  void wake_workers()
+  {
+    // the sleeper count and the generation are both sequentially
+    // consistent, so either a parking worker sees the new generation or
+    // the count shows it is parking and it is notified under the mutex
+    m_generation.fetch_add(1);
+    if (m_sleepers.load() > 0) {
+      std::lock_guard<std::mutex> lock(m_park_mutex);
+      m_park_cv.notify_all();
+    }
+  }
+
+  void work(int thread, unsigned long long seen)
+  {
+    while (true) {
+      if (!spin_until([&]() { return m_generation.load() != seen; })) {
+        std::unique_lock<std::mutex> lock(m_park_mutex);
+        m_sleepers.fetch_add(1);
+        m_park_cv.wait(lock, [&]() { return m_generation.load() != seen; });
+        m_sleepers.fetch_sub(1);
+      }
+      seen = m_generation.load();
+
+      if (m_stop.load()) {
+        return;
+      }
+
+      {
+        ContextGuard context_guard(this, thread, m_num_threads);
+        m_invoke(m_func, thread, m_num_threads);
+      }
+      m_remaining.fetch_sub(1, std::memory_order_acq_rel);
+    }
+  }
+
+  void barrier_wait(int num_threads)
+  {
+    // sense reversing barrier, the last thread to arrive resets the count
+    // before it releases the others
+    const unsigned phase = m_barrier_phase.load(std::memory_order_acquire);
+    if (m_barrier_count.fetch_add(1, std::memory_order_acq_rel) ==
+        num_threads - 1) {
+      m_barrier_count.store(0, std::memory_order_relaxed);
+      m_barrier_phase.fetch_add(1, std::memory_order_release);
+      return;
+    }
+    while (!spin_until([&]() {
+      return m_barrier_phase.load(std::memory_order_acquire) != phase;
+    })) {
+      std::this_thread::yield();
+    }
+  }
+
+  std::mutex m_dispatch_mutex;
+  std::vector<std::thread> m_workers;
+  std::atomic<int> m_requested{1};
+  int m_spin_count = spin_count;
+
+  // launch description, written by thread 0 before the generation is
+  // incremented and read by the workers after they see the increment
+  void (*m_invoke)(void*, int, int) = nullptr;
+  void* m_func = nullptr;
+  int m_num_threads = 1;
+
+  std::atomic<unsigned long long> m_generation{0};
+  std::atomic<bool> m_stop{false};
+  std::atomic<int> m_remaining{0};
+
+  std::mutex m_park_mutex;
+  std::condition_variable m_park_cv;
+  std::atomic<int> m_sleepers{0};
+
+  std::atomic<int> m_barrier_count{0};
+  std::atomic<unsigned> m_barrier_phase{0};
+};
+
+}  // namespace detail
+
+//! Number of threads used by launches with thread_team policies
+inline int getThreadTeamNumThreads()
+{
+  return detail::ThreadTeam::get().get_num_threads();
+}
+
+//! Set the number of threads used by later launches with thread_team policies
+inline void setThreadTeamNumThreads(int num_threads)
+{
+  detail::ThreadTeam::get().set_num_threads(num_threads);
+}
+
+}  // namespace RAJA
+
+#endif  // closing endif for if defined(RAJA_ENABLE_THREAD_TEAM)
+
+#endif  // closing endif for header file include guard
@@ -0,0 +1,222 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file containing user interface for
+ *          RAJA::Teams::thread_team
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-21, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_pattern_teams_thread_team_HPP
+#define RAJA_pattern_teams_thread_team_HPP
+
+#include "RAJA/config.hpp"
+
+#if defined(RAJA_ENABLE_THREAD_TEAM)
+
+#include "RAJA/pattern/detail/privatizer.hpp"
+#include "RAJA/pattern/teams/teams_core.hpp"
+#include "RAJA/policy/thread_team/policy.hpp"
+#include "RAJA/policy/thread_team/team.hpp"
+
+
+namespace RAJA
+{
+
+namespace expt
+{
+
+///
+/// Runs the launch body on every thread of the persistent thread team.
+/// Loops with thread_team_for_exec inside the body split their iterations
+/// over the threads and end with a team barrier, like 'omp for' inside the
+/// parallel region of omp_launch_t. Such loops must not be nested in other
+/// loops of the body, every thread has to reach the barrier that ends each
+/// of them.
+///
+struct thread_team_launch_t {
+};
+
+template <>
+struct LaunchExecute<RAJA::expt::thread_team_launch_t> {
+  template <typename BODY>
+  static void exec(LaunchContext const &ctx, BODY const &body)
+  {
+    ::RAJA::detail::ThreadTeam &team = ::RAJA::detail::ThreadTeam::get();
+    detail::HostSharedMemory shared(team.get_num_threads(),
+                                    ctx.shared_mem_bytes);
+
+    team.run([&](int thread, int) {
+      LaunchContext thread_ctx(ctx);
+      thread_ctx.shared_mem_ptr = shared.slice(thread);
+
+      using RAJA::internal::thread_privatize;
+      auto loop_body = thread_privatize(body);
+      loop_body.get_priv()(thread_ctx);
+    });
+  }
+};
+
+
+template <int ChunkSize, typename SEGMENT>
+struct LoopExecute<thread_team_for_exec<ChunkSize>, SEGMENT> {
+
+  template <typename BODY>
+  static RAJA_INLINE void exec(LaunchContext const RAJA_UNUSED_ARG(&ctx),
+                               SEGMENT const &segment,
+                               BODY const &body)
+  {
+    const int len = segment.end() - segment.begin();
+
+    ::RAJA::detail::ThreadTeam::for_static<ChunkSize>(
+        ::RAJA::detail::ThreadTeam::thread_num(),
+        ::RAJA::detail::ThreadTeam::team_size(),
+        len,
+        [&](int i) { body(*(segment.begin() + i)); });
+
+    ::RAJA::detail::ThreadTeam::barrier();
+  }
+
+  template <typename BODY>
+  static RAJA_INLINE void exec(LaunchContext const RAJA_UNUSED_ARG(&ctx),
+                               SEGMENT const &segment0,
+                               SEGMENT const &segment1,
+                               BODY const &body)
+  {
+    const int len1 = segment1.end() - segment1.begin();
+    const int len0 = segment0.end() - segment0.begin();
+
+    ::RAJA::detail::ThreadTeam::for_static<ChunkSize>(
+        ::RAJA::detail::ThreadTeam::thread_num(),
+        ::RAJA::detail::ThreadTeam::team_size(),
+        len1,
+        [&](int j) {
+          for (int i = 0; i < len0; i++) {
+            body(*(segment0.begin() + i), *(segment1.begin() + j));
+          }
+        });
+
+    ::RAJA::detail::ThreadTeam::barrier();
+  }
+
+  template <typename BODY>
+  static RAJA_INLINE void exec(LaunchContext const RAJA_UNUSED_ARG(&ctx),
+                               SEGMENT const &segment0,
+                               SEGMENT const &segment1,
+                               SEGMENT const &segment2,
+                               BODY const &body)
+  {
+    const int len2 = segment2.end() - segment2.begin();
+    const int len1 = segment1.end() - segment1.begin();
+    const int len0 = segment0.end() - segment0.begin();
+
+    ::RAJA::detail::ThreadTeam::for_static<ChunkSize>(
+        ::RAJA::detail::ThreadTeam::thread_num(),
+        ::RAJA::detail::ThreadTeam::team_size(),
+        len2,
+        [&](int k) {
+          for (int j = 0; j < len1; j++) {
+            for (int i = 0; i < len0; i++) {
+              body(*(segment0.begin() + i),
+                   *(segment1.begin() + j),
+                   *(segment2.begin() + k));
+            }
+          }
+        });
+
+    ::RAJA::detail::ThreadTeam::barrier();
+  }
+};
+
+//
+// Return local index
+//
+template <int ChunkSize, typename SEGMENT>
+struct LoopICountExecute<thread_team_for_exec<ChunkSize>, SEGMENT> {
+
+  template <typename BODY>
+  static RAJA_INLINE void exec(LaunchContext const RAJA_UNUSED_ARG(&ctx),
+                               SEGMENT const &segment,
+                               BODY const &body)
+  {
+    const int len = segment.end() - segment.begin();
+
+    ::RAJA::detail::ThreadTeam::for_static<ChunkSize>(
+        ::RAJA::detail::ThreadTeam::thread_num(),
+        ::RAJA::detail::ThreadTeam::team_size(),
+        len,
+        [&](int i) { body(*(segment.begin() + i), i); });
+
+    ::RAJA::detail::ThreadTeam::barrier();
+  }
+
+  template <typename BODY>
+  static RAJA_INLINE void exec(LaunchContext const RAJA_UNUSED_ARG(&ctx),
+                               SEGMENT const &segment0,
+                               SEGMENT const &segment1,
+                               BODY const &body)
+  {
+    const int len1 = segment1.end() - segment1.begin();
+    const int len0 = segment0.end() - segment0.begin();
+
+    ::RAJA::detail::ThreadTeam::for_static<ChunkSize>(
+        ::RAJA::detail::ThreadTeam::thread_num(),
+        ::RAJA::detail::ThreadTeam::team_size(),
+        len1,
+        [&](int j) {
+          for (int i = 0; i < len0; i++) {
+            body(*(segment0.begin() + i), *(segment1.begin() + j), i, j);
+          }
+        });
+
+    ::RAJA::detail::ThreadTeam::barrier();
+  }
+
+  template <typename BODY>
+  static RAJA_INLINE void exec(LaunchContext const RAJA_UNUSED_ARG(&ctx),
+                               SEGMENT const &segment0,
+                               SEGMENT const &segment1,
+                               SEGMENT const &segment2,
+                               BODY const &body)
+  {
+    const int len2 = segment2.end() - segment2.begin();
+    const int len1 = segment1.end() - segment1.begin();
+    const int len0 = segment0.end() - segment0.begin();
+
+    ::RAJA::detail::ThreadTeam::for_static<ChunkSize>(
+        ::RAJA::detail::ThreadTeam::thread_num(),
+        ::RAJA::detail::ThreadTeam::team_size(),
+        len2,
+        [&](int k) {
+          for (int j = 0; j < len1; j++) {
+            for (int i = 0; i < len0; i++) {
+              body(*(segment0.begin() + i),
+                   *(segment1.begin() + j),
+                   *(segment2.begin() + k),
+                   i,
+                   j,
+                   k);
+            }
+          }
+        });
+
+    ::RAJA::detail::ThreadTeam::barrier();
+  }
+};
+
+}  // namespace expt
+
+}  // namespace RAJA
+
+#endif  // closing endif for if defined(RAJA_ENABLE_THREAD_TEAM)
+
+#endif  // closing endif for header file include guard
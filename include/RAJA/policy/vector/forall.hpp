@@ -0,0 +1,97 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file containing RAJA segment template methods for
+ *          execution with vector registers.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-21, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_forall_vector_HPP
+#define RAJA_forall_vector_HPP
+
+#include "RAJA/config.hpp"
+
+#include <iterator>
+#include <type_traits>
+
+#include "RAJA/util/types.hpp"
+
+#include "RAJA/index/RangeSegment.hpp"
+
+#include "RAJA/internal/fault_tolerance.hpp"
+
+#include "RAJA/pattern/vector/VectorIndex.hpp"
+
+#include "RAJA/policy/vector/policy.hpp"
+
+namespace RAJA
+{
+namespace policy
+{
+namespace vector
+{
+
+namespace internal
+{
+
+//! vector_exec needs consecutive indices
+template <typename Iterable>
+struct is_unit_stride_range : std::false_type {
+};
+
+template <typename StorageT, typename DiffT>
+struct is_unit_stride_range<TypedRangeSegment<StorageT, DiffT>>
+    : std::true_type {
+};
+
+}  // namespace internal
+
+
+template <typename Iterable, typename Func, typename VECTOR_TYPE>
+RAJA_INLINE resources::EventProxy<resources::Host> forall_impl(RAJA::resources::Host host_res,
+                                                               const vector_exec<VECTOR_TYPE> &,
+                                                               Iterable &&iter,
+                                                               Func &&loop_body)
+{
+  static_assert(internal::is_unit_stride_range<camp::decay<Iterable>>::value,
+                "vector_exec requires a TypedRangeSegment");
+
+  using value_type = camp::decay<decltype(*std::begin(iter))>;
+  using vector_index_type = VectorIndex<value_type, VECTOR_TYPE>;
+
+  auto begin = std::begin(iter);
+  auto end = std::end(iter);
+  auto distance = std::distance(begin, end);
+  using diff_type = decltype(distance);
+  constexpr diff_type num_elem = VECTOR_TYPE::s_num_elem;
+
+  diff_type i = 0;
+  for (; i + num_elem <= distance; i += num_elem) {
+    loop_body(vector_index_type(*(begin + i), num_elem));
+  }
+
+  // masked remainder
+  if (i < distance) {
+    loop_body(vector_index_type(*(begin + i), distance - i));
+  }
+
+  return RAJA::resources::EventProxy<resources::Host>(host_res);
+}
+
+}  // namespace vector
+
+}  // namespace policy
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
@@ -0,0 +1,60 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file containing RAJA vector policy definitions.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-21, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef policy_vector_HPP
+#define policy_vector_HPP
+
+#include "RAJA/policy/PolicyBase.hpp"
+
+namespace RAJA
+{
+namespace policy
+{
+namespace vector
+{
+
+//
+//////////////////////////////////////////////////////////////////////
+//
+// Execution policies
+//
+//////////////////////////////////////////////////////////////////////
+//
+
+///
+/// Segment execution policy that calls the loop body once per
+/// VECTOR_TYPE::s_num_elem iterations with a VectorIndex, the last call
+/// gets the remaining iterations. Indexing Views with the VectorIndex
+/// loads and stores VECTOR_TYPE registers.
+///
+template <typename VECTOR_TYPE>
+struct vector_exec : make_policy_pattern_launch_platform_t<Policy::sequential,
+                                                           Pattern::forall,
+                                                           Launch::undefined,
+                                                           Platform::host> {
+  using vector_type = VECTOR_TYPE;
+};
+
+}  // end of namespace vector
+
+}  // end of namespace policy
+
+using policy::vector::vector_exec;
+
+}  // end of namespace RAJA
+
+#endif
@@ -0,0 +1,217 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file defining an exact floating point sum accumulator.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-21, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_util_ExactSum_HPP
+#define RAJA_util_ExactSum_HPP
+
+#include "RAJA/config.hpp"
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+namespace RAJA
+{
+
+/*!
+ * \brief Accumulates a sum of floating point values without rounding.
+ *
+ * Every finite double is an integer multiple of 2^-1074 and is added exactly
+ * into a fixed point integer stored in 32 bit chunks held in 64 bit
+ * integers, so additions and combining of accumulators are associative and
+ * the result does not depend on the order in which values are summed.
+ * value() rounds the exact sum to nearest once at the end.
+ *
+ * float values are accumulated exactly as doubles and the result is rounded
+ * to double and then to float.
+ */
+template <typename T>
+class ExactSum
+{
+  static_assert(std::is_floating_point<T>::value,
+                "ExactSum requires a floating point type");
+
+  // chunk i holds bits [32*i, 32*i+32) of the sum in units of 2^-1074,
+  // finite doubles reach chunk 66, the rest hold carries
+  static constexpr int num_chunks = 72;
+  static constexpr int chunk_bits = 32;
+  static constexpr int64_t chunk_mask = (int64_t(1) << chunk_bits) - 1;
+
+  // each addition changes a chunk by less than 2^32, normalizing before
+  // 2^30 additions keeps every chunk far from overflow
+  static constexpr int64_t max_pending = int64_t(1) << 30;
+
+  int64_t m_chunks[num_chunks];
+  int64_t m_pending;
+  // sum of the infinities and nans, this is independent of order
+  double m_special;
+
+public:
+  ExactSum() : m_chunks{}, m_pending(0), m_special(0.0) {}
+
+  explicit ExactSum(T val) : ExactSum() { *this += val; }
+
+  ExactSum& operator+=(T val)
+  {
+    const double d = static_cast<double>(val);
+
+    uint64_t bits;
+    std::memcpy(&bits, &d, sizeof(bits));
+
+    const int exp = static_cast<int>((bits >> 52) & 0x7ff);
+    if (exp == 0x7ff) {
+      m_special += d;
+      return *this;
+    }
+
+    // d = +-mant * 2^(pos - 1074), zero and subnormals have exp == 0
+    const uint64_t mant =
+        (bits & ((uint64_t(1) << 52) - 1)) | (uint64_t(exp != 0) << 52);
+    const int pos = exp - (exp != 0);
+
+    const int i = pos / chunk_bits;
+    const int shift = pos % chunk_bits;
+
+    // the shifted mantissa spans at most 85 bits
+    const uint64_t low_bits = mant << shift;
+    const uint64_t high_bits = (mant >> 1) >> (2 * chunk_bits - 1 - shift);
+
+    // add or subtract without branching on the sign
+    const int64_t neg = -static_cast<int64_t>(bits >> 63);
+    m_chunks[i] += (static_cast<int64_t>(low_bits & chunk_mask) ^ neg) - neg;
+    m_chunks[i + 1] += (static_cast<int64_t>(low_bits >> chunk_bits) ^ neg) - neg;
+    m_chunks[i + 2] += (static_cast<int64_t>(high_bits) ^ neg) - neg;
+
+    if (++m_pending == max_pending) {
+      normalize();
+    }
+    return *this;
+  }
+
+  ExactSum& operator+=(ExactSum other)
+  {
+    if (m_pending + other.m_pending + 1 >= max_pending) {
+      normalize();
+      other.normalize();
+    }
+    for (int i = 0; i < num_chunks; ++i) {
+      m_chunks[i] += other.m_chunks[i];
+    }
+    m_pending += other.m_pending + 1;
+    m_special += other.m_special;
+    return *this;
+  }
+
+  //! the sum rounded to nearest
+  T value() const
+  {
+    if (m_special != 0.0 || std::isnan(m_special)) {
+      return static_cast<T>(m_special);
+    }
+
+    ExactSum sum(*this);
+    sum.normalize();
+
+    double sign = 1.0;
+    if (sum.m_chunks[num_chunks - 1] < 0) {
+      sign = -1.0;
+      for (int i = 0; i < num_chunks; ++i) {
+        sum.m_chunks[i] = -sum.m_chunks[i];
+      }
+      sum.normalize();
+    }
+
+    int k = num_chunks - 1;
+    while (k >= 0 && sum.m_chunks[k] == 0) {
+      --k;
+    }
+    if (k < 0) {
+      return static_cast<T>(0);
+    }
+    if (sum.m_chunks[k] > chunk_mask) {
+      return static_cast<T>(sign * HUGE_VAL);
+    }
+
+    auto chunk = [&](int j) -> uint64_t {
+      return j >= 0 ? static_cast<uint64_t>(sum.m_chunks[j]) : 0;
+    };
+
+    // the top 96 bits of the sum, the leading bit is in top
+    uint64_t top = (chunk(k) << chunk_bits) | chunk(k - 1);
+    uint64_t low = chunk(k - 2);
+    bool sticky = false;
+    for (int j = k - 3; j >= 0 && !sticky; --j) {
+      sticky = sum.m_chunks[j] != 0;
+    }
+
+    int lz = 0;
+    while (!(top & (uint64_t(1) << 63))) {
+      ++lz;
+      top <<= 1;
+    }
+    if (lz) {
+      top |= low >> (chunk_bits - lz);
+      sticky = sticky || ((low << lz) & chunk_mask) != 0;
+    } else {
+      sticky = sticky || low != 0;
+    }
+
+    // round the 64 bits in top to the 53 bits of a double
+    uint64_t mant = top >> 11;
+    const uint64_t rest = top & 0x7ff;
+    const uint64_t half = 0x400;
+    if (rest > half || (rest == half && (sticky || (mant & 1)))) {
+      ++mant;
+    }
+
+    const int exp = chunk_bits * (k - 1) - lz + 11 - 1074;
+    return static_cast<T>(sign * std::ldexp(static_cast<double>(mant), exp));
+  }
+
+  bool operator==(const ExactSum& other) const
+  {
+    ExactSum lhs(*this);
+    ExactSum rhs(other);
+    lhs.normalize();
+    rhs.normalize();
+    for (int i = 0; i < num_chunks; ++i) {
+      if (lhs.m_chunks[i] != rhs.m_chunks[i]) {
+        return false;
+      }
+    }
+    return lhs.m_special == rhs.m_special;
+  }
+
+  bool operator!=(const ExactSum& other) const { return !(*this == other); }
+
+private:
+  // propagate carries so every chunk except the last is in [0, 2^32)
+  void normalize()
+  {
+    for (int i = 0; i < num_chunks - 1; ++i) {
+      const int64_t carry = m_chunks[i] >> chunk_bits;
+      m_chunks[i] -= carry * (int64_t(1) << chunk_bits);
+      m_chunks[i + 1] += carry;
+    }
+    m_pending = 0;
+  }
+};
+
+}  // namespace RAJA
+
+#endif  // RAJA_util_ExactSum_HPP
@@ -127,7 +127,7 @@ struct OffsetLayout_impl<camp::idx_seq<RangeInts...>, IdxLin> {
   RAJA_HOST_DEVICE
   constexpr
   IndexLinear get_dim_stride() const {
-    return base_.get_dim_stride();
+    return base_.template get_dim_stride<DIM>();
   }
 };
 
@@ -8,6 +8,11 @@
 #ifndef RAJA_plugin_context_HPP
 #define RAJA_plugin_context_HPP
 
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+
 #include "RAJA/policy/PolicyBase.hpp"
 #include "RAJA/internal/get_platform.hpp"
 
@@ -16,13 +21,166 @@ namespace util {
 
 class KokkosPluginLoader;
 
+namespace detail {
+
+/*!
+ * Returns a string that contains the name of type T, for display. Different
+ * types may print the same, e.g. two lambdas in one function, and the
+ * compiler may share one copy of equal strings, so use type_id as a key.
+ */
+template <typename T>
+const char* type_signature()
+{
+#if defined(_MSC_VER)
+  return __FUNCSIG__;
+#else
+  return __PRETTY_FUNCTION__;
+#endif
+}
+
+template <typename T>
+struct type_tag {
+  static const char tag;
+};
+
+template <typename T>
+const char type_tag<T>::tag = 0;
+
+/*!
+ * Returns an address unique to type T, usable as a key.
+ */
+template <typename T>
+const void* type_id()
+{
+  return &type_tag<T>::tag;
+}
+
+/*!
+ * Returns the name of the type in a type_signature string, or "unknown" for
+ * nullptr.
+ */
+inline std::string signature_name(const char* signature)
+{
+  if (signature == nullptr) return "unknown";
+  std::string sig(signature);
+  size_t pos = sig.find("T = ");
+  if (pos != std::string::npos) {
+    std::string name = sig.substr(pos + 4);
+    if (!name.empty() && name.back() == ']') name.pop_back();
+    return name;
+  }
+  pos = sig.find("type_signature<");
+  size_t end = sig.rfind(">(");
+  if (pos != std::string::npos && end != std::string::npos && end > pos) {
+    pos += std::strlen("type_signature<");
+    return sig.substr(pos, end - pos);
+  }
+  return sig;
+}
+
+//! name given to the kernels launched by this thread, see ScopedKernelName
+inline const char*& current_kernel_name()
+{
+  static thread_local const char* name = nullptr;
+  return name;
+}
+
+} // closing brace for detail namespace
+
+/*!
+ * Names the kernels launched by this thread while the object is alive,
+ * plugins see the name in PluginContext::kernel_name. Names nest, the
+ * innermost one is used. The string must outlive the object.
+ *
+ *   {
+ *     RAJA::util::ScopedKernelName name("daxpy");
+ *     RAJA::forall<RAJA::seq_exec>(range, [=](int i) { y[i] += a * x[i]; });
+ *   }
+ */
+class ScopedKernelName
+{
+  public:
+    explicit ScopedKernelName(const char* name) :
+      m_previous(detail::current_kernel_name())
+    {
+      detail::current_kernel_name() = name;
+    }
+
+    ~ScopedKernelName() { detail::current_kernel_name() = m_previous; }
+
+    ScopedKernelName(const ScopedKernelName&) = delete;
+    ScopedKernelName& operator=(const ScopedKernelName&) = delete;
+
+  private:
+    const char* m_previous;
+};
+
 struct PluginContext {
   public:
     PluginContext(const Platform p) :
       platform(p) {}
 
+    PluginContext(const Platform p,
+                  const char* policy,
+                  const void* kernel,
+                  const char* kernel_sig,
+                  size_t iterations) :
+      platform(p),
+      policy_id(policy),
+      kernel_id(kernel),
+      kernel_signature(kernel_sig),
+      num_iterations(iterations) {}
+
     Platform platform;
 
+    //! type_signature of the execution policy, or nullptr
+    const char* policy_id = nullptr;
+
+    //! type_id of the loop bodies, identifies the call site, or nullptr
+    const void* kernel_id = nullptr;
+
+    //! type_signature of the loop bodies, or nullptr
+    const char* kernel_signature = nullptr;
+
+    //! size of the iteration space, 0 if unknown
+    size_t num_iterations = 0;
+
+    //! name from the enclosing ScopedKernelName, or nullptr, filled in
+    //! when the plugins are called so launches without plugins skip it
+    mutable const char* kernel_name = nullptr;
+
+    //! type_signature of the resource the kernel runs on, or nullptr
+    const char* resource_id = nullptr;
+
+    //! the resource the kernel runs on, valid until postLaunch
+    const void* resource = nullptr;
+
+    //! readable name of the execution policy type
+    std::string policy_name() const
+    {
+      return detail::signature_name(policy_id);
+    }
+
+    //! kernel_name if set, else the readable name of the loop body types
+    std::string name() const
+    {
+      return kernel_name ? std::string(kernel_name)
+                         : detail::signature_name(kernel_signature);
+    }
+
+    //! the resource of the kernel if it has type Res, else nullptr;
+    //! compares the signatures as strings, since a plugin in another
+    //! shared library has its own copy of each signature
+    template <typename Res>
+    const Res* get_resource() const
+    {
+      const char* sig = detail::type_signature<Res>();
+      return resource_id &&
+                     (resource_id == sig || std::strcmp(resource_id, sig) == 0)
+                 ? static_cast<const Res*>(resource)
+                 : nullptr;
+    }
+
   private:
     mutable uint64_t kID;
 
@@ -32,7 +190,34 @@ struct PluginContext {
 template<typename Policy>
 PluginContext make_context()
 {
-  return PluginContext{detail::get_platform<Policy>::value};
+  return PluginContext{RAJA::detail::get_platform<Policy>::value,
+                       detail::type_signature<Policy>(),
+                       nullptr,
+                       nullptr,
+                       0};
+}
+
+template<typename Policy, typename Body>
+PluginContext make_context(size_t num_iterations)
+{
+  return PluginContext{RAJA::detail::get_platform<Policy>::value,
+                       detail::type_signature<Policy>(),
+                       detail::type_id<Body>(),
+                       detail::type_signature<Body>(),
+                       num_iterations};
+}
+
+template<typename Policy, typename Body, typename Res>
+PluginContext make_context(size_t num_iterations, const Res& resource)
+{
+  PluginContext context{RAJA::detail::get_platform<Policy>::value,
+                        detail::type_signature<Policy>(),
+                        detail::type_id<Body>(),
+                        detail::type_signature<Body>(),
+                        num_iterations};
+  context.resource_id = detail::type_signature<Res>();
+  context.resource = &resource;
+  return context;
 }
 
 } // closing brace for util namespace
@@ -8,15 +8,27 @@
 #ifndef RAJA_Plugin_Linker_HPP
 #define RAJA_Plugin_Linker_HPP
 
+#include "RAJA/config.hpp"
+
+#if defined(RAJA_ENABLE_RUNTIME_PLUGINS)
 #include "RAJA/util/RuntimePluginLoader.hpp"
 #include "RAJA/util/KokkosPluginLoader.hpp"
+#endif
+#if defined(RAJA_ENABLE_PROFILING_PLUGIN)
+#include "RAJA/util/ProfilingPlugin.hpp"
+#endif
 
 namespace {
   namespace anonymous_RAJA {
     struct pluginLinker {
       inline pluginLinker() {
+#if defined(RAJA_ENABLE_RUNTIME_PLUGINS)
         (void)RAJA::util::linkRuntimePluginLoader();
         (void)RAJA::util::linkKokkosPluginLoader();
+#endif
+#if defined(RAJA_ENABLE_PROFILING_PLUGIN)
+        (void)RAJA::util::linkProfilingPlugin();
+#endif
       }
     } pluginLinker;
   }
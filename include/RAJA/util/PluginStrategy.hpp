@@ -37,6 +37,9 @@ class PluginStrategy
 
 using PluginRegistry = Registry<PluginStrategy>;
 
+// defined by RAJA_INSTANTIATE_REGISTRY(PluginRegistry) in the RAJA library
+extern template PluginRegistry::node* Registry<PluginStrategy>::Head;
+
 } // closing brace for util namespace
 } // closing brace for RAJA namespace
 
@@ -0,0 +1,113 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-21, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_Profiling_Plugin_HPP
+#define RAJA_Profiling_Plugin_HPP
+
+#include <atomic>
+#include <cstdint>
+#include <iosfwd>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "RAJA/util/PluginOptions.hpp"
+#include "RAJA/util/PluginStrategy.hpp"
+
+namespace RAJA {
+namespace util {
+
+  /*!
+   * \brief Plugin that records every kernel launch and prints per-kernel
+   *        aggregated statistics at finalize.
+   *
+   * Kernels are identified by their call site (loop body type), execution
+   * policy, platform and ScopedKernelName, so launches of one call site
+   * under different names are reported separately. For each kernel the
+   * plugin keeps the number of launches, iterations, total/min/max wall
+   * time and a log2 histogram of launch times. Records are kept per thread
+   * and per plugin, written only by their thread without locking, and
+   * merged when reporting.
+   *
+   * The environment variable RAJA_PROFILE_OUTPUT selects the report: unset
+   * prints a summary sorted by total time to stdout, a path ending in .json
+   * writes JSON to that file, any other path writes the summary there.
+   * The report is written by finalize, or when the plugin is destroyed if
+   * finalize was never called.
+   */
+  class ProfilingPlugin : public ::RAJA::util::PluginStrategy
+  {
+  public:
+    using Parent = ::RAJA::util::PluginStrategy;
+
+    //! number of log2 buckets of launch times in nanoseconds
+    static constexpr int num_histogram_buckets = 40;
+
+    struct KernelStats {
+      const void* kernel_id = nullptr;
+      const char* kernel_signature = nullptr;
+      const char* policy_id = nullptr;
+      //! name from the enclosing ScopedKernelName, or empty
+      std::string kernel_name;
+      Platform platform = Platform::undefined;
+      uint64_t num_launches = 0;
+      uint64_t num_iterations = 0;
+      uint64_t total_ns = 0;
+      uint64_t min_ns = UINT64_MAX;
+      uint64_t max_ns = 0;
+      uint64_t histogram[num_histogram_buckets] = {};
+
+      //! estimate the given quantile in [0, 1] from the histogram, in ns
+      double quantile_ns(double q) const;
+    };
+
+    struct ThreadData;
+
+    ProfilingPlugin();
+
+    ~ProfilingPlugin();
+
+    void preLaunch(const RAJA::util::PluginContext& p) override;
+
+    void postLaunch(const RAJA::util::PluginContext& p) override;
+
+    void finalize() override;
+
+    //! merge the per thread records into one entry per kernel,
+    //! sorted by decreasing total time
+    std::vector<KernelStats> getStats() const;
+
+    //! write a text summary of getStats()
+    void printSummary(std::ostream& os) const;
+
+    //! write getStats() as a JSON array
+    void printJSON(std::ostream& os) const;
+
+    //! discard all records; launches that complete concurrently with the
+    //! reset may be discarded as well
+    void reset();
+
+  private:
+    ThreadData& getThreadData();
+
+    void report();
+
+    mutable std::mutex m_mutex;
+    std::vector<std::unique_ptr<ThreadData>> m_thread_data;
+    uint64_t m_id;
+    std::atomic<uint64_t> m_epoch;
+    bool m_reported;
+
+  };  // end ProfilingPlugin class
+
+  void linkProfilingPlugin();
+
+}  // end namespace util
+}  // end namespace RAJA
+
+#endif
@@ -89,6 +89,11 @@ namespace util {
     static RAJASHAREDDLL_API iterator begin();
     static iterator end()   { return iterator(nullptr); }
 
+    /// True if nothing was added, reads the list head directly so checking
+    /// costs one load. Needs an explicit instantiation declaration of Head
+    /// next to the registry type, see PluginStrategy.hpp.
+    static bool empty() { return Head == nullptr; }
+
     /// A static registration template.
     template <typename V>
     class add {
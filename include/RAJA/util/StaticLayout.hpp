@@ -217,7 +217,7 @@ struct TypedStaticLayoutImpl<Layout, camp::list<DimTypes...>> {
   RAJA_HOST_DEVICE
   constexpr
   IndexLinear get_dim_stride() const {
-    return Layout{}.get_dim_stride();
+    return Layout{}.template get_dim_stride<DIM>();
   }
 
   RAJA_INLINE
@@ -26,6 +26,19 @@
 #include <caliper/Annotation.h>
 #endif
 
+#if defined(RAJA_ENABLE_PERF_COUNTERS)
+#define RAJA_HAVE_PERF_COUNTER_TIMER
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <cstdint>
+#include <cstring>
+#include <initializer_list>
+#include <vector>
+#endif
+
 
 // libstdc++ on BGQ only has gettimeofday for some reason
 #if defined(__bgq__) && (!defined(_LIBCPP_VERSION))
@@ -273,6 +286,268 @@ public:
 #endif
 };
 
+
+#if defined(RAJA_HAVE_PERF_COUNTER_TIMER)
+
+/*!
+ * \brief  Hardware events that can be read by PerfCounterTimer.
+ */
+enum class PerfCounter {
+  cycles,
+  instructions,
+  cache_references,
+  cache_misses,
+  branch_instructions,
+  branch_misses,
+  stalled_cycles_frontend,
+  stalled_cycles_backend,
+  llc_read_misses,
+  llc_write_misses
+};
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  Timer class that also reads hardware performance counters using
+ *         the Linux perf_event_open interface.
+ *
+ *         Elapsed time is measured as with Timer. Between start and stop the
+ *         selected counters are enabled, and their deltas accumulate until
+ *         reset, in the same way elapsed time does. The deltas of the most
+ *         recent start/stop interval are also kept, so a PluginStrategy can
+ *         start the timer in preLaunch and read per-kernel deltas in
+ *         postLaunch.
+ *
+ *         Counters measure the thread that created the timer and threads
+ *         it creates later. Counts are scaled when the kernel multiplexes
+ *         more events than there are hardware counters. Events that can not
+ *         be opened, for example due to perf_event_paranoid settings or in
+ *         a virtual machine, are reported as unavailable and read as zero.
+ *
+ ******************************************************************************
+ */
+class PerfCounterTimer : public Timer
+{
+public:
+  using CounterType = long long;
+
+  PerfCounterTimer()
+      : PerfCounterTimer({PerfCounter::cycles,
+                          PerfCounter::instructions,
+                          PerfCounter::llc_read_misses})
+  {
+  }
+
+  explicit PerfCounterTimer(std::initializer_list<PerfCounter> counters)
+  {
+    for (PerfCounter c : counters) {
+      m_events.push_back(Event{c, open_event(c), 0, 0, 0, 0, 0});
+    }
+  }
+
+  PerfCounterTimer(const PerfCounterTimer&) = delete;
+  PerfCounterTimer& operator=(const PerfCounterTimer&) = delete;
+
+  ~PerfCounterTimer()
+  {
+    for (Event& e : m_events) {
+      if (e.fd >= 0) close(e.fd);
+    }
+  }
+
+  void start()
+  {
+    startCounters();
+    Timer::start();
+  }
+
+  void stop()
+  {
+    Timer::stop();
+    stopCounters();
+  }
+
+  void start(const char* name)
+  {
+    startCounters();
+    Timer::start(name);
+  }
+
+  void stop(const char* name)
+  {
+    Timer::stop(name);
+    stopCounters();
+  }
+
+  void reset()
+  {
+    Timer::reset();
+    for (Event& e : m_events) {
+      e.last = 0;
+      e.total = 0;
+    }
+  }
+
+  //! Return the number of counters requested.
+  size_t numCounters() const { return m_events.size(); }
+
+  //! Return the i-th counter requested.
+  PerfCounter getCounter(size_t i) const { return m_events[i].counter; }
+
+  //! Return true if the i-th counter could be opened.
+  bool available(size_t i) const { return m_events[i].fd >= 0; }
+
+  //! Return the i-th counter's total delta since the last reset.
+  CounterType counter(size_t i) const { return m_events[i].total; }
+
+  //! Return the i-th counter's delta for the last start/stop interval.
+  CounterType lastCounter(size_t i) const { return m_events[i].last; }
+
+  //! Return the total delta of the given counter, or zero if not requested.
+  CounterType counter(PerfCounter c) const
+  {
+    for (const Event& e : m_events) {
+      if (e.counter == c) return e.total;
+    }
+    return 0;
+  }
+
+  //! Return a short name for the given counter.
+  static const char* name(PerfCounter c)
+  {
+    switch (c) {
+      case PerfCounter::cycles: return "cycles";
+      case PerfCounter::instructions: return "instructions";
+      case PerfCounter::cache_references: return "cache-references";
+      case PerfCounter::cache_misses: return "cache-misses";
+      case PerfCounter::branch_instructions: return "branch-instructions";
+      case PerfCounter::branch_misses: return "branch-misses";
+      case PerfCounter::stalled_cycles_frontend:
+        return "stalled-cycles-frontend";
+      case PerfCounter::stalled_cycles_backend:
+        return "stalled-cycles-backend";
+      case PerfCounter::llc_read_misses: return "LLC-load-misses";
+      case PerfCounter::llc_write_misses: return "LLC-store-misses";
+    }
+    return "unknown";
+  }
+
+private:
+  struct Event {
+    PerfCounter counter;
+    int fd;
+    CounterType start_value;
+    CounterType start_enabled;
+    CounterType start_running;
+    CounterType last;
+    CounterType total;
+  };
+
+  std::vector<Event> m_events;
+
+  void startCounters()
+  {
+    for (Event& e : m_events) {
+      if (e.fd >= 0) {
+        read_event(e, e.start_value, e.start_enabled, e.start_running);
+        ioctl(e.fd, PERF_EVENT_IOC_ENABLE, 0);
+      }
+    }
+  }
+
+  void stopCounters()
+  {
+    for (Event& e : m_events) {
+
+      if (e.fd >= 0) {
+        ioctl(e.fd, PERF_EVENT_IOC_DISABLE, 0);
+        CounterType value, enabled, running;
+        read_event(e, value, enabled, running);
+        CounterType delta = value - e.start_value;
+        const CounterType d_enabled = enabled - e.start_enabled;
+        const CounterType d_running = running - e.start_running;
+        if (d_running > 0 && d_running < d_enabled) {
+          delta = static_cast<CounterType>(static_cast<double>(delta) *
+                                           d_enabled / d_running);
+        }
+        e.last = delta;
+        e.total += delta;
+      }
+    }
+  }
+
+  static int open_event(PerfCounter c)
+  {
+    perf_event_attr attr;
+    std::memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    attr.type = PERF_TYPE_HARDWARE;
+    switch (c) {
+      case PerfCounter::cycles:
+        attr.config = PERF_COUNT_HW_CPU_CYCLES;
+        break;
+      case PerfCounter::instructions:
+        attr.config = PERF_COUNT_HW_INSTRUCTIONS;
+        break;
+      case PerfCounter::cache_references:
+        attr.config = PERF_COUNT_HW_CACHE_REFERENCES;
+        break;
+      case PerfCounter::cache_misses:
+        attr.config = PERF_COUNT_HW_CACHE_MISSES;
+        break;
+      case PerfCounter::branch_instructions:
+        attr.config = PERF_COUNT_HW_BRANCH_INSTRUCTIONS;
+        break;
+      case PerfCounter::branch_misses:
+        attr.config = PERF_COUNT_HW_BRANCH_MISSES;
+        break;
+      case PerfCounter::stalled_cycles_frontend:
+        attr.config = PERF_COUNT_HW_STALLED_CYCLES_FRONTEND;
+        break;
+      case PerfCounter::stalled_cycles_backend:
+        attr.config = PERF_COUNT_HW_STALLED_CYCLES_BACKEND;
+        break;
+      case PerfCounter::llc_read_misses:
+        attr.type = PERF_TYPE_HW_CACHE;
+        attr.config = PERF_COUNT_HW_CACHE_LL |
+                      (PERF_COUNT_HW_CACHE_OP_READ << 8) |
+                      (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+        break;
+      case PerfCounter::llc_write_misses:
+        attr.type = PERF_TYPE_HW_CACHE;
+        attr.config = PERF_COUNT_HW_CACHE_LL |
+                      (PERF_COUNT_HW_CACHE_OP_WRITE << 8) |
+                      (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+        break;
+    }
+    attr.disabled = 1;
+    attr.inherit = 1;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    attr.read_format =
+        PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+
+    return static_cast<int>(
+        syscall(__NR_perf_event_open, &attr, 0, -1, -1, 0));
+  }
+
+  static void read_event(const Event& e,
+                         CounterType& value,
+                         CounterType& enabled,
+                         CounterType& running)
+  {
+    uint64_t data[3] = {0, 0, 0};
+    if (read(e.fd, data, sizeof(data)) != static_cast<ssize_t>(sizeof(data))) {
+      data[0] = data[1] = data[2] = 0;
+    }
+    value = static_cast<CounterType>(data[0]);
+    enabled = static_cast<CounterType>(data[1]);
+    running = static_cast<CounterType>(data[2]);
+  }
+};
+
+#endif
+
 }  // namespace RAJA
 
 #endif  // closing endif for header file include guard
@@ -23,6 +23,8 @@
 #include "RAJA/config.hpp"
 
 #include "RAJA/pattern/atomic.hpp"
+#include "RAJA/pattern/vector/VectorIndex.hpp"
+#include "RAJA/pattern/vector/VectorRef.hpp"
 
 #include "RAJA/util/Layout.hpp"
 #include "RAJA/util/OffsetLayout.hpp"
@@ -70,6 +72,37 @@ namespace internal
 
 
 
+  template<typename ... ARGS>
+  struct CountTensorArgs;
+
+  template<>
+  struct CountTensorArgs<>{
+      static constexpr camp::idx_t value = 0;
+  };
+
+  template<typename ARG, typename ... ARGS>
+  struct CountTensorArgs<ARG, ARGS...>{
+      static constexpr camp::idx_t value =
+        (is_vector_index<ARG>::value ? 1 : 0) + CountTensorArgs<ARGS...>::value;
+  };
+
+  /*
+   * Position of the first VectorIndex argument, or -1
+   */
+  template<camp::idx_t I, typename ... ARGS>
+  struct FirstTensorArg;
+
+  template<camp::idx_t I>
+  struct FirstTensorArg<I>{
+      static constexpr camp::idx_t value = -1;
+  };
+
+  template<camp::idx_t I, typename ARG, typename ... ARGS>
+  struct FirstTensorArg<I, ARG, ARGS...>{
+      static constexpr camp::idx_t value =
+        is_vector_index<ARG>::value ? I : FirstTensorArg<I+1, ARGS...>::value;
+  };
+
   /*
    * Returns the number of arguments which are VectorIndexs
    */
@@ -77,7 +110,7 @@ namespace internal
   RAJA_INLINE
   RAJA_HOST_DEVICE
   static constexpr camp::idx_t count_num_tensor_args(){
-		return 0;
+		return CountTensorArgs<ARGS...>::value;
   }
 
 
@@ -95,7 +128,7 @@ namespace internal
   template<camp::idx_t NumVectors, typename Args, typename ElementType, typename PointerType, typename LinIdx, camp::idx_t StrideOneDim>
   struct ViewReturnHelper
   {
-      static_assert(NumVectors == 0, "Vectors and Matrices not supported yet");
+      static_assert(NumVectors <= 1, "Only one VectorIndex argument is supported");
   };
 
 
@@ -118,6 +151,35 @@ namespace internal
   };
 
 
+  /*
+   * Specialization for a single VectorIndex argument, returns a VectorRef
+   * to the elements along the dimension of the VectorIndex
+   */
+  template<typename ... Args, typename ElementType, typename PointerType, typename LinIdx, camp::idx_t StrideOneDim>
+  struct ViewReturnHelper<1, camp::list<Args...>, ElementType, PointerType, LinIdx, StrideOneDim>
+  {
+      static constexpr camp::idx_t vector_dim = FirstTensorArg<0, Args...>::value;
+
+      using vector_type = typename camp::at_v<camp::list<Args...>, vector_dim>::vector_type;
+
+      static_assert(std::is_same<camp::decay<ElementType>,
+                                 typename vector_type::element_type>::value,
+                    "VectorIndex register type does not match View value type");
+
+      using return_type = VectorRef<vector_type, PointerType, vector_dim == StrideOneDim>;
+
+      template<typename LayoutType>
+      RAJA_INLINE
+      static
+      return_type make_return(LayoutType const &layout, PointerType const &data, Args const &... args){
+        return return_type(
+            data + stripIndexType(layout(vector_index_value(args)...)),
+            layout.template get_dim_stride<vector_dim>(),
+            camp::get<vector_dim>(camp::make_tuple(args...)).size());
+      }
+  };
+
+
 
   } // namespace detail
 
@@ -193,6 +255,24 @@ namespace internal
   };
 
 
+  /*
+   * Specialization for VectorIndex arguments, strips any strongly typed
+   * index inside the VectorIndex.
+   */
+  template<typename Expected, typename IDX, typename VECTOR_TYPE>
+  struct MatchTypedViewArgHelper<Expected, VectorIndex<IDX, VECTOR_TYPE>>{
+    static_assert(std::is_convertible<IDX, Expected>::value,
+        "Argument isn't compatible");
+
+    using type = VectorIndex<strip_index_type_t<IDX>, VECTOR_TYPE>;
+
+    static RAJA_INLINE
+    constexpr
+    type extract(VectorIndex<IDX, VECTOR_TYPE> vec_arg){
+      return type(stripIndexType(*vec_arg), vec_arg.size());
+    }
+  };
+
   } //namespace detail
 
 
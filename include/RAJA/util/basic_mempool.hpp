@@ -18,12 +18,17 @@
 #ifndef RAJA_BASIC_MEMPOOL_HPP
 #define RAJA_BASIC_MEMPOOL_HPP
 
+#include <algorithm>
+#include <atomic>
 #include <cassert>
 #include <cstddef>
+#include <cstdint>
 #include <cstdio>
 #include <cstdlib>
 #include <list>
 #include <map>
+#include <memory>
+#include <vector>
 
 #include "RAJA/util/align.hpp"
 #include "RAJA/util/mutex.hpp"
@@ -34,6 +39,48 @@ namespace RAJA
 namespace basic_mempool
 {
 
+/*!
+ * \brief statistics for a MemPool
+ *
+ * Counts from thread caches are folded in when a cache refills from or
+ * flushes to the shared free lists, or when its thread exits, so they may
+ * lag by up to a cache's worth of operations per thread.
+ */
+struct MemPoolStats {
+  //! number of calls to malloc and free
+  size_t num_mallocs = 0;
+  size_t num_frees = 0;
+  //! mallocs served by a thread cache or a shared free list
+  size_t num_cache_hits = 0;
+  size_t num_free_list_hits = 0;
+  //! mallocs that needed new blocks or were too large for size classes
+  size_t num_misses = 0;
+  //! total bytes asked for and total bytes of blocks handed out by malloc
+  size_t bytes_requested = 0;
+  size_t bytes_allocated = 0;
+  //! bytes currently handed out and the most handed out at once
+  size_t bytes_in_use = 0;
+  size_t high_water_bytes = 0;
+  //! bytes obtained from the underlying allocator
+  size_t bytes_reserved = 0;
+
+  //! fraction of mallocs served without new blocks
+  double hit_rate() const
+  {
+    return num_mallocs ? double(num_cache_hits + num_free_list_hits) /
+                             double(num_mallocs)
+                       : 0.0;
+  }
+
+  //! fraction of handed out bytes lost to rounding up to a size class
+  double fragmentation() const
+  {
+    return bytes_allocated
+               ? 1.0 - double(bytes_requested) / double(bytes_allocated)
+               : 0.0;
+  }
+};
+
 namespace detail
 {
 
@@ -116,6 +163,16 @@ public:
     return ptr_out;
   }
 
+  //! get the size of the used chunk at ptr, 0 if there is none
+  size_t used_size(void* ptr)
+  {
+    used_type::iterator found = m_used_space.find(ptr);
+    if (found == m_used_space.end()) {
+      return 0;
+    }
+    return static_cast<char*>(found->second) - static_cast<char*>(found->first);
+  }
+
   bool give(void* ptr)
   {
     if (m_allocation.begin <= ptr && ptr < m_allocation.end) {
@@ -239,6 +296,428 @@ private:
   used_type m_used_space;
 };
 
+
+//! number of size classes used by SizeClassState, blocks of 64 B to 64 KiB
+constexpr size_t size_class_count() { return 11; }
+
+//! log2 of the bytes in the smallest size class
+constexpr size_t size_class_min_log2() { return 6; }
+
+//! bytes in a block of the given size class
+constexpr size_t size_class_bytes(size_t size_class)
+{
+  return size_t(1) << (size_class_min_log2() + size_class);
+}
+
+//! bytes in a batch of blocks, batches are aligned to their size
+constexpr size_t size_class_batch_bytes()
+{
+  return size_class_bytes(size_class_count() - 1);
+}
+
+//! log2 of the max number of blocks in a batch
+constexpr size_t size_class_batch_blocks_log2()
+{
+  return size_class_count() - 1;
+}
+
+//! max number of blocks of each size class kept in a thread cache
+constexpr uint32_t size_class_cache_capacity() { return 16; }
+
+/*!
+ * \brief get the size class for an allocation of nbytes with the given
+ * alignment, returns size_class_count() if it is too large for any class
+ */
+inline size_t get_size_class(size_t nbytes, size_t alignment)
+{
+  const size_t size = std::max(nbytes, alignment);
+  size_t size_class = 0;
+  while (size_class < size_class_count() &&
+         size_class_bytes(size_class) < size) {
+    ++size_class;
+  }
+  return size_class;
+}
+
+/*! \class SizeClassState
+ ******************************************************************************
+ *
+ * \brief  SizeClassState holds the blocks of each size class for class
+ * MemPool
+ *
+ * Blocks are carved out of batches of size_class_batch_bytes aligned to their
+ * size, so a block can be found from its pointer without touching the memory
+ * it points to. Free blocks of each size class are kept in a lock-free stack
+ * whose head packs the block id with a tag to avoid ABA problems. The links
+ * are kept on the host so this works with device memory.
+ *
+ * Batches are only added, and live as long as the SizeClassState, so lookups
+ * and free list operations can read them without locking.
+ *
+ ******************************************************************************
+ */
+class SizeClassState
+{
+public:
+  struct batch {
+    char* base;
+    size_t size_class;
+    uint32_t first_id;
+    std::unique_ptr<std::atomic<uint32_t>[]> next;
+    batch* hash_next;
+  };
+
+  explicit SizeClassState(uint64_t id) : m_id(id)
+  {
+    for (size_t i = 0; i < num_dir_chunks; ++i) {
+      m_dir[i].store(nullptr, std::memory_order_relaxed);
+    }
+    for (size_t i = 0; i < num_hash_buckets; ++i) {
+      m_hash[i].store(nullptr, std::memory_order_relaxed);
+    }
+  }
+
+  SizeClassState(SizeClassState const&) = delete;
+  SizeClassState& operator=(SizeClassState const&) = delete;
+
+  ~SizeClassState()
+  {
+    for (size_t i = 0; i < num_dir_chunks; ++i) {
+      delete[] m_dir[i].load(std::memory_order_relaxed);
+    }
+  }
+
+  uint64_t id() const { return m_id; }
+
+  //! get the batch containing ptr or nullptr
+  batch* find_batch(const void* ptr) const
+  {
+    const uintptr_t key = reinterpret_cast<uintptr_t>(ptr) &
+                          ~uintptr_t(size_class_batch_bytes() - 1);
+    batch* b = m_hash[hash(key)].load(std::memory_order_acquire);
+    while (b != nullptr && reinterpret_cast<uintptr_t>(b->base) != key) {
+      b = b->hash_next;
+    }
+    return b;
+  }
+
+  //! get the block id of ptr in batch b
+  static uint32_t block_id(batch const* b, const void* ptr)
+  {
+    const size_t offset =
+        static_cast<const char*>(ptr) - static_cast<const char*>(b->base);
+    return b->first_id +
+           static_cast<uint32_t>(offset >> (size_class_min_log2() + b->size_class));
+  }
+
+  //! get the pointer to the block with the given id
+  void* block_ptr(uint32_t id) const
+  {
+    batch const* b = get_batch(id);
+    return b->base + (size_t(block_index(id)) << (size_class_min_log2() + b->size_class));
+  }
+
+  /*!
+   * \brief add a batch of blocks of size_class at base, base must be aligned
+   * to size_class_batch_bytes, puts the id of the first block in id
+   *
+   * Returns false, adding nothing, if the maximum number of batches has
+   * been reached. Must not be called concurrently with itself.
+   */
+  bool add_batch(void* base, size_t size_class, uint32_t& id)
+  {
+    const size_t batch_index = m_batches.size();
+    const size_t chunk = batch_index / dir_chunk_size;
+    if (chunk >= num_dir_chunks) {
+      return false;
+    }
+
+    std::unique_ptr<batch> b(new batch{
+        static_cast<char*>(base),
+        size_class,
+        static_cast<uint32_t>(batch_index << size_class_batch_blocks_log2()),
+        std::unique_ptr<std::atomic<uint32_t>[]>(
+            new std::atomic<uint32_t>[num_blocks(size_class)]),
+        nullptr});
+
+    std::atomic<batch*>* dir_chunk = m_dir[chunk].load(std::memory_order_relaxed);
+    if (dir_chunk == nullptr) {
+      dir_chunk = new std::atomic<batch*>[dir_chunk_size];
+      m_dir[chunk].store(dir_chunk, std::memory_order_release);
+    }
+    dir_chunk[batch_index % dir_chunk_size].store(b.get(), std::memory_order_release);
+
+    std::atomic<batch*>& bucket =
+        m_hash[hash(reinterpret_cast<uintptr_t>(base))];
+    b->hash_next = bucket.load(std::memory_order_relaxed);
+    bucket.store(b.get(), std::memory_order_release);
+
+    m_batches.emplace_back(std::move(b));
+    id = m_batches.back()->first_id;
+    return true;
+  }
+
+  //! number of blocks of size_class in a batch
+  static constexpr uint32_t num_blocks(size_t size_class)
+  {
+    return static_cast<uint32_t>(size_class_batch_bytes() /
+                                 size_class_bytes(size_class));
+  }
+
+  //! push block id onto the free list of size_class
+  void push(size_t size_class, uint32_t id)
+  {
+    std::atomic<uint32_t>& link = get_batch(id)->next[block_index(id)];
+    std::atomic<uint64_t>& head = m_free[size_class].head;
+    uint64_t old_head = head.load(std::memory_order_relaxed);
+    uint64_t new_head;
+    do {
+      link.store(static_cast<uint32_t>(old_head), std::memory_order_relaxed);
+      new_head = ((old_head >> 32) + 1) << 32 | (uint64_t(id) + 1);
+    } while (!head.compare_exchange_weak(old_head,
+                                         new_head,
+                                         std::memory_order_release,
+                                         std::memory_order_relaxed));
+  }
+
+  //! pop a block id from the free list of size_class, false if it is empty
+  bool pop(size_t size_class, uint32_t& id)
+  {
+    std::atomic<uint64_t>& head = m_free[size_class].head;
+    uint64_t old_head = head.load(std::memory_order_acquire);
+    uint64_t new_head;
+    do {
+      if (static_cast<uint32_t>(old_head) == 0) {
+        return false;
+      }
+      id = static_cast<uint32_t>(old_head) - 1;
+      const uint32_t next =
+          get_batch(id)->next[block_index(id)].load(std::memory_order_relaxed);
+      new_head = ((old_head >> 32) + 1) << 32 | next;
+    } while (!head.compare_exchange_weak(old_head,
+                                         new_head,
+                                         std::memory_order_acquire,
+                                         std::memory_order_acquire));
+    return true;
+  }
+
+  /*!
+   * \brief fold counts into the statistics, bytes_in_use_peak is the largest
+   * partial sum of the changes making up bytes_in_use_delta
+   */
+  void add_stats(MemPoolStats const& delta,
+                 std::ptrdiff_t bytes_in_use_delta,
+                 std::ptrdiff_t bytes_in_use_peak)
+  {
+    m_num_mallocs.fetch_add(delta.num_mallocs, std::memory_order_relaxed);
+    m_num_frees.fetch_add(delta.num_frees, std::memory_order_relaxed);
+    m_num_cache_hits.fetch_add(delta.num_cache_hits, std::memory_order_relaxed);
+    m_num_free_list_hits.fetch_add(delta.num_free_list_hits, std::memory_order_relaxed);
+    m_num_misses.fetch_add(delta.num_misses, std::memory_order_relaxed);
+    m_bytes_requested.fetch_add(delta.bytes_requested, std::memory_order_relaxed);
+    m_bytes_allocated.fetch_add(delta.bytes_allocated, std::memory_order_relaxed);
+    m_bytes_reserved.fetch_add(delta.bytes_reserved, std::memory_order_relaxed);
+
+    const std::ptrdiff_t in_use =
+        m_bytes_in_use.fetch_add(bytes_in_use_delta, std::memory_order_relaxed) +
+        bytes_in_use_peak;
+    std::ptrdiff_t high_water = m_high_water_bytes.load(std::memory_order_relaxed);
+    while (in_use > high_water &&
+           !m_high_water_bytes.compare_exchange_weak(high_water,
+                                                     in_use,
+                                                     std::memory_order_relaxed)) {
+    }
+  }
+
+  MemPoolStats get_stats() const
+  {
+    MemPoolStats stats;
+    stats.num_mallocs = m_num_mallocs.load(std::memory_order_relaxed);
+    stats.num_frees = m_num_frees.load(std::memory_order_relaxed);
+    stats.num_cache_hits = m_num_cache_hits.load(std::memory_order_relaxed);
+    stats.num_free_list_hits = m_num_free_list_hits.load(std::memory_order_relaxed);
+    stats.num_misses = m_num_misses.load(std::memory_order_relaxed);
+    stats.bytes_requested = m_bytes_requested.load(std::memory_order_relaxed);
+    stats.bytes_allocated = m_bytes_allocated.load(std::memory_order_relaxed);
+    stats.bytes_in_use = static_cast<size_t>(
+        std::max(m_bytes_in_use.load(std::memory_order_relaxed), std::ptrdiff_t(0)));
+    stats.high_water_bytes = static_cast<size_t>(
+        m_high_water_bytes.load(std::memory_order_relaxed));
+    stats.bytes_reserved = m_bytes_reserved.load(std::memory_order_relaxed);
+    return stats;
+  }
+
+private:
+  static constexpr size_t num_hash_buckets = 1024;
+  static constexpr size_t dir_chunk_size = 1024;
+  static constexpr size_t num_dir_chunks =
+      (size_t(1) << (32 - size_class_batch_blocks_log2())) / dir_chunk_size;
+
+  struct alignas(64) free_list {
+    // low 32 bits are the top block id + 1 or 0 if empty, high 32 bits a tag
+    std::atomic<uint64_t> head{0};
+  };
+
+  static size_t hash(uintptr_t key)
+  {
+    return (key / size_class_batch_bytes()) % num_hash_buckets;
+  }
+
+  static uint32_t block_index(uint32_t id)
+  {
+    return id & ((uint32_t(1) << size_class_batch_blocks_log2()) - 1);
+  }
+
+  batch* get_batch(uint32_t id) const
+  {
+    const size_t batch_index = id >> size_class_batch_blocks_log2();
+    return m_dir[batch_index / dir_chunk_size]
+        .load(std::memory_order_acquire)[batch_index % dir_chunk_size]
+        .load(std::memory_order_acquire);
+  }
+
+  const uint64_t m_id;
+  free_list m_free[size_class_count()];
+  std::atomic<std::atomic<batch*>*> m_dir[num_dir_chunks];
+  std::atomic<batch*> m_hash[num_hash_buckets];
+  std::vector<std::unique_ptr<batch>> m_batches;
+
+  std::atomic<size_t> m_num_mallocs{0};
+  std::atomic<size_t> m_num_frees{0};
+  std::atomic<size_t> m_num_cache_hits{0};
+  std::atomic<size_t> m_num_free_list_hits{0};
+  std::atomic<size_t> m_num_misses{0};
+  std::atomic<size_t> m_bytes_requested{0};
+  std::atomic<size_t> m_bytes_allocated{0};
+  std::atomic<size_t> m_bytes_reserved{0};
+  std::atomic<std::ptrdiff_t> m_bytes_in_use{0};
+  std::atomic<std::ptrdiff_t> m_high_water_bytes{0};
+};
+
+//! get a unique id for a SizeClassState
+inline uint64_t get_size_class_state_id()
+{
+  static std::atomic<uint64_t> s_id{0};
+  return ++s_id;
+}
+
+/*! \class SizeClassCache
+ ******************************************************************************
+ *
+ * \brief  SizeClassCache is a per thread cache of free blocks of each size
+ * class bound to one SizeClassState at a time
+ *
+ * Blocks go back to the shared free lists when the cache is full, when it is
+ * bound to another SizeClassState, or when its thread exits. If the
+ * SizeClassState it was bound to no longer exists the blocks are dropped.
+ *
+ ******************************************************************************
+ */
+class SizeClassCache
+{
+public:
+  SizeClassCache() = default;
+
+  SizeClassCache(SizeClassCache const&) = delete;
+  SizeClassCache& operator=(SizeClassCache const&) = delete;
+
+  ~SizeClassCache() { flush(); }
+
+  uint64_t owner_id() const { return m_owner_id; }
+
+  void bind(std::shared_ptr<SizeClassState> const& owner)
+  {
+    flush();
+    m_owner = owner;
+    m_owner_id = owner->id();
+  }
+
+  bool pop(size_t size_class, uint32_t& id)
+  {
+    if (m_count[size_class] == 0) {
+      return false;
+    }
+    id = m_ids[size_class][--m_count[size_class]];
+    return true;
+  }
+
+  //! push a block, returns false if the cache for size_class is full
+  bool push(size_t size_class, uint32_t id)
+  {
+    if (m_count[size_class] == size_class_cache_capacity()) {
+      return false;
+    }
+    m_ids[size_class][m_count[size_class]++] = id;
+    return true;
+  }
+
+  //! move half of the cache for size_class to the shared free list
+  void spill(SizeClassState& owner, size_t size_class)
+  {
+    while (m_count[size_class] > size_class_cache_capacity() / 2) {
+      owner.push(size_class, m_ids[size_class][--m_count[size_class]]);
+    }
+  }
+
+  //! fill half of the cache for size_class from the shared free list
+  void fill(SizeClassState& owner, size_t size_class)
+  {
+    uint32_t id;
+    while (m_count[size_class] < size_class_cache_capacity() / 2 &&
+           owner.pop(size_class, id)) {
+      m_ids[size_class][m_count[size_class]++] = id;
+    }
+  }
+
+  //! fold counts into the statistics of owner
+  void fold_stats(SizeClassState& owner)
+  {
+    owner.add_stats(m_stats, m_bytes_in_use_delta, m_bytes_in_use_peak);
+    m_stats = MemPoolStats{};
+    m_bytes_in_use_delta = 0;
+    m_bytes_in_use_peak = 0;
+  }
+
+  MemPoolStats& stats() { return m_stats; }
+
+  //! record a change in the bytes handed out by this thread
+  void add_bytes_in_use(std::ptrdiff_t bytes)
+  {
+    m_bytes_in_use_delta += bytes;
+    m_bytes_in_use_peak = std::max(m_bytes_in_use_peak, m_bytes_in_use_delta);
+  }
+
+private:
+  void flush()
+  {
+    std::shared_ptr<SizeClassState> owner = m_owner.lock();
+    if (owner) {
+      for (size_t size_class = 0; size_class < size_class_count(); ++size_class) {
+        while (m_count[size_class] > 0) {
+          owner->push(size_class, m_ids[size_class][--m_count[size_class]]);
+        }
+      }
+      fold_stats(*owner);
+    }
+    for (size_t size_class = 0; size_class < size_class_count(); ++size_class) {
+      m_count[size_class] = 0;
+    }
+    m_stats = MemPoolStats{};
+    m_bytes_in_use_delta = 0;
+    m_bytes_in_use_peak = 0;
+    m_owner.reset();
+    m_owner_id = 0;
+  }
+
+  std::weak_ptr<SizeClassState> m_owner;
+  uint64_t m_owner_id = 0;
+  uint32_t m_count[size_class_count()] = {};
+  uint32_t m_ids[size_class_count()][size_class_cache_capacity()];
+  MemPoolStats m_stats;
+  std::ptrdiff_t m_bytes_in_use_delta = 0;
+  std::ptrdiff_t m_bytes_in_use_peak = 0;
+};
+
 } /* end namespace detail */
 
 
@@ -248,8 +727,13 @@ private:
  * \brief  MemPool pre-allocates a large chunk of memory and provides generic
  * malloc/free for the user to allocate aligned data within the pool
  *
- * MemPool uses MemoryArena to do the heavy lifting of maintaining access to
- * the used/free space.
+ * Allocations of up to size_class_batch_bytes are rounded up to a power of two
+ * size class and served from per thread caches of blocks backed by lock-free
+ * free lists in SizeClassState. Batches of blocks and larger allocations are
+ * taken from MemoryArenas, which do the heavy lifting of maintaining access to
+ * the used/free space. Memory in size classes is not returned to the arenas
+ * until free_chunks is called. get_stats reports hit rate, fragmentation and
+ * the high-water mark of bytes in use.
  *
  * MemPool provides an example generic_allocator which can guide more
  *specialized
@@ -297,7 +781,11 @@ public:
   static const size_t default_default_arena_size = 32ull * 1024ull * 1024ull;
 
   MemPool()
-      : m_arenas(), m_default_arena_size(default_default_arena_size), m_alloc()
+      : m_arenas(),
+        m_default_arena_size(default_default_arena_size),
+        m_alloc(),
+        m_state(std::make_shared<detail::SizeClassState>(
+            detail::get_size_class_state_id()))
   {
   }
 
@@ -309,6 +797,10 @@ public:
   }
 
 
+  /*!
+   * \brief free all memory held by the pool, must not be called concurrently
+   * with malloc or free
+   */
   void free_chunks()
   {
 #if defined(RAJA_ENABLE_OPENMP)
@@ -320,6 +812,10 @@ public:
       m_alloc.free(allocation_ptr);
       m_arenas.pop_front();
     }
+
+    // thread caches bound to the old state drop their blocks
+    m_state = std::make_shared<detail::SizeClassState>(
+        detail::get_size_class_state_id());
   }
 
   size_t arena_size()
@@ -342,32 +838,39 @@ public:
     return prev_size;
   }
 
+  //! get the statistics of the pool, see MemPoolStats
+  MemPoolStats get_stats()
+  {
+    detail::SizeClassCache& cache = get_cache();
+    cache.fold_stats(*m_state);
+    return m_state->get_stats();
+  }
+
   template <typename T>
   T* malloc(size_t nTs, size_t alignment = alignof(T))
   {
+    const size_t size = nTs * sizeof(T);
+    const size_t size_class = detail::get_size_class(size, alignment);
+
+    if (size_class < detail::size_class_count()) {
+      return static_cast<T*>(malloc_size_class(size, size_class));
+    }
+
 #if defined(RAJA_ENABLE_OPENMP)
     lock_guard<omp::mutex> lock(m_mutex);
 #endif
 
-    const size_t size = nTs * sizeof(T);
-    void* ptr = nullptr;
-    arena_container_type::iterator end = m_arenas.end();
-    for (arena_container_type::iterator iter = m_arenas.begin(); iter != end;
-         ++iter) {
-      ptr = iter->get(size, alignment);
-      if (ptr != nullptr) {
-        break;
-      }
-    }
+    void* ptr = get_from_arenas(size, alignment);
 
-    if (ptr == nullptr) {
-      const size_t alloc_size =
-          std::max(size + alignment, m_default_arena_size);
-      void* arena_ptr = m_alloc.malloc(alloc_size);
-      if (arena_ptr != nullptr) {
-        m_arenas.emplace_front(arena_ptr, alloc_size);
-        ptr = m_arenas.front().get(size, alignment);
-      }
+    if (ptr != nullptr) {
+      MemPoolStats delta;
+      delta.num_mallocs = 1;
+      delta.num_misses = 1;
+      delta.bytes_requested = size;
+      delta.bytes_allocated = size;
+      m_state->add_stats(delta,
+                         static_cast<std::ptrdiff_t>(size),
+                         static_cast<std::ptrdiff_t>(size));
     }
 
     return static_cast<T*>(ptr);
@@ -375,15 +878,26 @@ public:
 
   void free(const void* cptr)
   {
+    void* ptr = const_cast<void*>(cptr);
+
+    detail::SizeClassState::batch* b = m_state->find_batch(ptr);
+    if (b != nullptr) {
+      free_size_class(b, ptr);
+      return;
+    }
+
 #if defined(RAJA_ENABLE_OPENMP)
     lock_guard<omp::mutex> lock(m_mutex);
 #endif
 
-    void* ptr = const_cast<void*>(cptr);
     arena_container_type::iterator end = m_arenas.end();
     for (arena_container_type::iterator iter = m_arenas.begin(); iter != end;
          ++iter) {
+      const size_t size = iter->used_size(ptr);
       if (iter->give(ptr)) {
+        MemPoolStats delta;
+        delta.num_frees = 1;
+        m_state->add_stats(delta, -static_cast<std::ptrdiff_t>(size), 0);
         ptr = nullptr;
         break;
       }
@@ -396,6 +910,131 @@ public:
 private:
   using arena_container_type = std::list<detail::MemoryArena>;
 
+  //! get the calling thread's cache bound to the current state
+  detail::SizeClassCache& get_cache()
+  {
+    static thread_local detail::SizeClassCache cache;
+    if (cache.owner_id() != m_state->id()) {
+      cache.bind(m_state);
+    }
+    return cache;
+  }
+
+  void* malloc_size_class(size_t size, size_t size_class)
+  {
+    detail::SizeClassState& state = *m_state;
+    detail::SizeClassCache& cache = get_cache();
+    MemPoolStats& stats = cache.stats();
+
+    uint32_t id;
+    if (cache.pop(size_class, id)) {
+      ++stats.num_cache_hits;
+    } else {
+      cache.fill(state, size_class);
+      if (cache.pop(size_class, id)) {
+        ++stats.num_free_list_hits;
+      } else if (add_batch(size_class, id)) {
+        ++stats.num_misses;
+      } else {
+        return nullptr;
+      }
+      cache.fold_stats(state);
+    }
+
+    const size_t block_bytes = detail::size_class_bytes(size_class);
+    ++stats.num_mallocs;
+    stats.bytes_requested += size;
+    stats.bytes_allocated += block_bytes;
+    cache.add_bytes_in_use(static_cast<std::ptrdiff_t>(block_bytes));
+
+    return state.block_ptr(id);
+  }
+
+  void free_size_class(detail::SizeClassState::batch* b, void* ptr)
+  {
+    detail::SizeClassState& state = *m_state;
+    detail::SizeClassCache& cache = get_cache();
+    MemPoolStats& stats = cache.stats();
+
+    const size_t size_class = b->size_class;
+    const uint32_t id = detail::SizeClassState::block_id(b, ptr);
+
+    ++stats.num_frees;
+    cache.add_bytes_in_use(
+        -static_cast<std::ptrdiff_t>(detail::size_class_bytes(size_class)));
+
+    if (!cache.push(size_class, id)) {
+      cache.spill(state, size_class);
+      cache.push(size_class, id);
+      cache.fold_stats(state);
+    }
+  }
+
+  /*!
+   * \brief carve a new batch of blocks of size_class out of the arenas, put
+   * the first block in id and the rest on the shared free list
+   *
+   * Returns false if the arenas or the batch ids are exhausted, so the
+   * allocation fails like any other allocation the pool cannot satisfy.
+   */
+  bool add_batch(size_t size_class, uint32_t& id)
+  {
+#if defined(RAJA_ENABLE_OPENMP)
+    lock_guard<omp::mutex> lock(m_mutex);
+#endif
+
+    const size_t batch_bytes = detail::size_class_batch_bytes();
+    void* base = get_from_arenas(batch_bytes, batch_bytes);
+    if (base == nullptr) {
+      return false;
+    }
+
+    detail::SizeClassState& state = *m_state;
+    if (!state.add_batch(base, size_class, id)) {
+      for (detail::MemoryArena& arena : m_arenas) {
+        if (arena.give(base)) {
+          break;
+        }
+      }
+      return false;
+    }
+    const uint32_t num_blocks = detail::SizeClassState::num_blocks(size_class);
+    for (uint32_t i = num_blocks - 1; i > 0; --i) {
+      state.push(size_class, id + i);
+    }
+    return true;
+  }
+
+  //! get memory from the arenas, adding an arena if needed
+  void* get_from_arenas(size_t size, size_t alignment)
+  {
+    void* ptr = nullptr;
+    arena_container_type::iterator end = m_arenas.end();
+    for (arena_container_type::iterator iter = m_arenas.begin(); iter != end;
+         ++iter) {
+      ptr = iter->get(size, alignment);
+      if (ptr != nullptr) {
+        break;
+      }
+    }
+
+    if (ptr == nullptr) {
+      const size_t alloc_size =
+          std::max(size + alignment, m_default_arena_size);
+      void* arena_ptr = m_alloc.malloc(alloc_size);
+      if (arena_ptr != nullptr) {
+        m_arenas.emplace_front(arena_ptr, alloc_size);
+        ptr = m_arenas.front().get(size, alignment);
+
+        MemPoolStats delta;
+        delta.bytes_reserved = alloc_size;
+        m_state->add_stats(delta, 0, 0);
+      }
+    }
+
+    return ptr;
+  }
+
 #if defined(RAJA_ENABLE_OPENMP)
   omp::mutex m_mutex;
 #endif
@@ -403,6 +1042,7 @@ private:
   arena_container_type m_arenas;
   size_t m_default_arena_size;
   allocator_t m_alloc;
+  std::shared_ptr<detail::SizeClassState> m_state;
 };
 
 //! example allocator for basic_mempool using malloc/free
@@ -0,0 +1,111 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file providing allocation of host arrays placed by
+ *          first-touch initialization with an execution policy.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-21, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_util_first_touch_HPP
+#define RAJA_util_first_touch_HPP
+
+#include "RAJA/config.hpp"
+
+#include <cstddef>
+#include <new>
+
+#include "RAJA/index/RangeSegment.hpp"
+#include "RAJA/internal/MemUtils_CPU.hpp"
+#include "RAJA/pattern/forall.hpp"
+#include "RAJA/util/macros.hpp"
+#include "RAJA/util/types.hpp"
+
+namespace RAJA
+{
+
+//! Alignment of arrays from first_touch_allocate, one page so that pages
+//! hold the same ranges of elements on every run
+constexpr size_t first_touch_alignment = 4096;
+
+/*!
+ * \brief Construct len copies of value in untouched memory at ptr with the
+ *        iteration space partition of ExecPolicy.
+ *
+ * Operating systems place a page of memory on the NUMA domain of the thread
+ * that first writes to it. Initializing an array with the policy, and
+ * iteration space, that later loops over it use places each page next to
+ * the thread that will use it, for policies that give each iteration to the
+ * same thread every launch, such as the static OpenMP schedules. With
+ * threads pinned, e.g. by omp_parallel_for_numa_exec, the placement holds
+ * for the lifetime of the array.
+ */
+template <typename ExecPolicy, typename T>
+void first_touch_init(T* ptr, size_t len, T const& value = T())
+{
+  RAJA::forall<ExecPolicy>(RAJA::TypedRangeSegment<Index_type>(
+                               0, static_cast<Index_type>(len)),
+                           [=](Index_type i) { new (ptr + i) T(value); });
+}
+
+/*!
+ * \brief Allocate an array of len T and initialize it with first_touch_init.
+ *
+ * The array must be released with first_touch_deallocate. It may be wrapped
+ * in a View whose layout indexes it in the same order as the loops that
+ * use it, e.g.
+ *
+ * \code
+ *
+ * using numa_pol = RAJA::omp_parallel_for_numa_exec<>;
+ *
+ * double* a = RAJA::first_touch_allocate<numa_pol>(N * M, 0.0);
+ * RAJA::View<double, RAJA::Layout<2>> aView(a, N, M);
+ *
+ * RAJA::forall<numa_pol>(RAJA::RangeSegment(0, N * M), [=](int i) {
+ *   a[i] += ...;
+ * });
+ *
+ * RAJA::first_touch_deallocate(a, N * M);
+ *
+ * \endcode
+ */
+template <typename ExecPolicy, typename T>
+T* first_touch_allocate(size_t len, T const& value = T())
+{
+  T* ptr = RAJA::allocate_aligned_type<T>(first_touch_alignment,
+                                          len * sizeof(T));
+  if (ptr == nullptr && len > 0) {
+    RAJA_ABORT_OR_THROW("first_touch_allocate failed to allocate memory");
+  }
+  first_touch_init<ExecPolicy>(ptr, len, value);
+  return ptr;
+}
+
+/*!
+ * \brief Destroy and free an array allocated by first_touch_allocate.
+ */
+template <typename T>
+void first_touch_deallocate(T* ptr, size_t len)
+{
+  if (ptr == nullptr) {
+    return;
+  }
+  for (size_t i = 0; i < len; ++i) {
+    ptr[i].~T();
+  }
+  RAJA::free_aligned(ptr);
+}
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
@@ -21,6 +21,25 @@
 namespace RAJA {
 namespace util {
 
+/*!
+ * True if plugins are registered. Every launch checks this before calling
+ * the plugins, so a program without plugins pays one predictable branch per
+ * hook. Without RAJA_ENABLE_PLUGINS the hooks are compiled out.
+ */
+RAJA_INLINE
+bool
+plugins_active()
+{
+#if !defined(RAJA_ENABLE_PLUGINS)
+  return false;
+#elif (defined(_WIN32) || defined(_WIN64)) && !defined(RAJA_WIN_STATIC_BUILD)
+  // the registry head is not exported from the RAJA DLL
+  return PluginRegistry::begin() != PluginRegistry::end();
+#else
+  return !PluginRegistry::empty();
+#endif
+}
+
 template <typename T>
 RAJA_INLINE auto trigger_updates_before(T&& item)
   -> typename std::remove_reference<T>::type
@@ -32,6 +51,9 @@ RAJA_INLINE
 void
 callPreCapturePlugins(const PluginContext& p)
 {
+  if (!plugins_active()) return;
+
+  p.kernel_name = detail::current_kernel_name();
   for (auto plugin = PluginRegistry::begin();
       plugin != PluginRegistry::end();
       ++plugin)
@@ -44,6 +66,9 @@ RAJA_INLINE
 void
 callPostCapturePlugins(const PluginContext& p)
 {
+  if (!plugins_active()) return;
+
+  p.kernel_name = detail::current_kernel_name();
   for (auto plugin = PluginRegistry::begin();
       plugin != PluginRegistry::end();
       ++plugin)
@@ -56,6 +81,9 @@ RAJA_INLINE
 void
 callPreLaunchPlugins(const PluginContext& p)
 {
+  if (!plugins_active()) return;
+
+  p.kernel_name = detail::current_kernel_name();
   for (auto plugin = PluginRegistry::begin();
       plugin != PluginRegistry::end();
       ++plugin)
@@ -68,6 +96,9 @@ RAJA_INLINE
 void
 callPostLaunchPlugins(const PluginContext& p)
 {
+  if (!plugins_active()) return;
+
+  p.kernel_name = detail::current_kernel_name();
   for (auto plugin = PluginRegistry::begin();
       plugin != PluginRegistry::end();
       ++plugin)
@@ -20,15 +20,25 @@
 
 #include "RAJA/config.hpp"
 
+#include <algorithm>
+#include <climits>
+#include <cstdint>
+#include <cstring>
 #include <iterator>
+#include <limits>
 #include <memory>
+#include <type_traits>
 
 #include "RAJA/pattern/detail/algorithm.hpp"
 
+#include "RAJA/internal/MemUtils_CPU.hpp"
+
 #include "RAJA/util/macros.hpp"
 
 #include "RAJA/util/concepts.hpp"
 
+#include "RAJA/util/Operators.hpp"
+
 namespace RAJA
 {
 
@@ -693,6 +703,300 @@ merge_sort(Iter begin,
   //}
 }
 
+/*!
+    \brief unsigned integer type with the given size in bytes
+*/
+template <size_t Size>
+struct radix_uint;
+///
+template <>
+struct radix_uint<1> { using type = std::uint8_t; };
+///
+template <>
+struct radix_uint<2> { using type = std::uint16_t; };
+///
+template <>
+struct radix_uint<4> { using type = std::uint32_t; };
+///
+template <>
+struct radix_uint<8> { using type = std::uint64_t; };
+
+/*!
+    \brief maps arithmetic keys to unsigned integers whose unsigned order
+    matches the order of the keys, unsigned integers and bool map to
+    themselves
+*/
+template <typename T, typename Enable = void>
+struct radix_key {
+  using type = typename radix_uint<sizeof(T)>::type;
+
+  static RAJA_INLINE type get(T v) { return static_cast<type>(v); }
+};
+
+/*!
+    \brief signed integers flip the sign bit
+*/
+template <typename T>
+struct radix_key<T, typename std::enable_if<std::is_integral<T>::value &&
+                                            std::is_signed<T>::value>::type> {
+  using type = typename radix_uint<sizeof(T)>::type;
+
+  static RAJA_INLINE type get(T v)
+  {
+    return static_cast<type>(v) ^ (type(1) << (sizeof(T) * CHAR_BIT - 1));
+  }
+};
+
+/*!
+    \brief floating point numbers flip all bits if negative, otherwise the
+    sign bit; -0.0 is mapped like 0.0 so equal keys get equal digits
+*/
+template <typename T>
+struct radix_key<T, typename std::enable_if<std::is_floating_point<T>::value>::type> {
+  using type = typename radix_uint<sizeof(T)>::type;
+
+  static RAJA_INLINE type get(T v)
+  {
+    type bits = 0;
+    if (v != T(0)) {
+      std::memcpy(&bits, &v, sizeof(T));
+    }
+    const type sign_bit = type(1) << (sizeof(T) * CHAR_BIT - 1);
+    return bits ^ ((bits & sign_bit) ? ~type(0) : sign_bit);
+  }
+};
+
+/*!
+    \brief true if keys of type T can be radix sorted
+*/
+template <typename T>
+struct is_radix_sortable_key
+    : std::integral_constant<bool,
+                             std::is_integral<T>::value ||
+                             (std::is_floating_point<T>::value &&
+                              std::numeric_limits<T>::is_iec559 &&
+                              (sizeof(T) == 4 || sizeof(T) == 8))> {
+};
+
+/*!
+    \brief true if a sort of keys of type T with comparison function Compare
+    can be done with a radix sort
+*/
+template <typename T, typename Compare>
+struct is_radix_sortable
+    : std::integral_constant<bool,
+                             is_radix_sortable_key<T>::value &&
+                             (std::is_same<Compare, operators::less<T>>::value ||
+                              std::is_same<Compare, operators::greater<T>>::value)> {
+};
+
+/*!
+    \brief true if the radix sort for Compare orders keys descending
+*/
+template <typename Compare>
+struct radix_descending : std::false_type {
+};
+///
+template <typename T>
+struct radix_descending<operators::greater<T>> : std::true_type {
+};
+
+/*!
+    \brief number of bits in a radix sort digit
+*/
+constexpr int radix_sort_digit_bits() { return 8; }
+
+/*!
+    \brief number of buckets for a radix sort digit
+*/
+constexpr int radix_sort_buckets() { return 1 << radix_sort_digit_bits(); }
+
+/*!
+    \brief ranges of fewer items than this are sorted with a comparison sort
+*/
+constexpr int radix_sort_cutoff() { return 256; }
+
+/*!
+    \brief get radix sort key bits of v, inverted for descending sorts
+*/
+template <bool Descending, typename T>
+RAJA_INLINE typename radix_key<T>::type radix_bits(T v)
+{
+  using bits_type = typename radix_key<T>::type;
+  return Descending ? static_cast<bits_type>(~radix_key<T>::get(v))
+                    : radix_key<T>::get(v);
+}
+
+/*!
+    \brief get digit of a radix sort key
+*/
+template <typename Bits>
+RAJA_INLINE int radix_digit(Bits bits, int pass)
+{
+  return static_cast<int>((bits >> (pass * radix_sort_digit_bits())) &
+                          Bits(radix_sort_buckets() - 1));
+}
+
+/*!
+    \brief value buffer for radix sort of keys without values
+*/
+struct radix_no_vals {
+  struct reference {
+    template <typename T>
+    RAJA_INLINE reference& operator=(T&&) { return *this; }
+  };
+  RAJA_INLINE reference operator[](std::ptrdiff_t) const { return reference{}; }
+};
+
+/*!
+    \brief move construct src into uninitialized dst
+*/
+template <typename T, typename U>
+RAJA_INLINE void radix_construct(T* dst, U&& src)
+{
+  new (dst) T(std::forward<U>(src));
+}
+///
+template <typename U>
+RAJA_INLINE void radix_construct(radix_no_vals::reference*, U&&)
+{
+}
+
+/*!
+    \brief storage for radix sort values, radix_no_vals for keys only
+*/
+template <typename ValIter>
+struct radix_vals_storage {
+  using value_type = RAJA::detail::IterVal<ValIter>;
+  using buffer_type = value_type*;
+
+  FreeAlignedType<value_type, std::ptrdiff_t> deleter;
+  std::unique_ptr<value_type, FreeAlignedType<value_type, std::ptrdiff_t>&> buf;
+
+  explicit radix_vals_storage(std::ptrdiff_t n)
+      : deleter(),
+        buf(RAJA::allocate_aligned_type<value_type>(RAJA::DATA_ALIGN,
+                                                    n * sizeof(value_type)),
+            deleter)
+  {
+    if (buf.get() == nullptr) {
+      RAJA_ABORT_OR_THROW("radix_sort temporary memory allocation failed");
+    }
+  }
+
+  buffer_type get() const { return buf.get(); }
+
+  value_type* construct_ptr(std::ptrdiff_t i) const { return buf.get() + i; }
+
+  // all n items were constructed by the first pass
+  void set_constructed(std::ptrdiff_t n) { deleter.size = n; }
+};
+///
+template <>
+struct radix_vals_storage<radix_no_vals> {
+  using buffer_type = radix_no_vals;
+
+  explicit radix_vals_storage(std::ptrdiff_t) {}
+
+  buffer_type get() const { return radix_no_vals{}; }
+
+  radix_no_vals::reference* construct_ptr(std::ptrdiff_t) const { return nullptr; }
+
+  void set_constructed(std::ptrdiff_t) {}
+};
+
+/*!
+    \brief stable LSD radix sort of keys and optional values
+
+    Keys are scattered between the range and a buffer one 8-bit digit per
+    pass; passes where every key has the same digit are skipped. Histograms
+    of all digits are computed in one initial pass over the keys.
+*/
+template <bool Descending, typename KeyIter, typename ValIter>
+RAJA_INLINE void radix_sort_pairs(KeyIter keys, KeyIter keys_end, ValIter vals)
+{
+  using diff_type = RAJA::detail::IterDiff<KeyIter>;
+  using key_type = RAJA::detail::IterVal<KeyIter>;
+  using bits_type = typename radix_key<key_type>::type;
+
+  constexpr int num_passes = sizeof(bits_type) * CHAR_BIT / radix_sort_digit_bits();
+  constexpr int num_buckets = radix_sort_buckets();
+
+  const diff_type n = keys_end - keys;
+  if (n < 2) {
+    return;
+  }
+
+  diff_type counts[num_passes][num_buckets] = {};
+  for (diff_type i = 0; i < n; ++i) {
+    const bits_type bits = radix_bits<Descending>(keys[i]);
+    for (int pass = 0; pass < num_passes; ++pass) {
+      ++counts[pass][radix_digit(bits, pass)];
+    }
+  }
+
+  std::unique_ptr<key_type[]> key_buf(new key_type[n]);
+  radix_vals_storage<ValIter> val_storage(n);
+  auto val_buf = val_storage.get();
+
+  bool in_buf = false;
+  bool constructed = false;
+  for (int pass = 0; pass < num_passes; ++pass) {
+
+    // skip passes where every key has the same digit
+    diff_type offsets[num_buckets];
+    diff_type sum = 0;
+    bool trivial = false;
+    for (int d = 0; d < num_buckets; ++d) {
+      trivial = trivial || (counts[pass][d] == n);
+      offsets[d] = sum;
+      sum += counts[pass][d];
+    }
+    if (trivial) {
+      continue;
+    }
+
+    if (in_buf) {
+      for (diff_type i = 0; i < n; ++i) {
+        const diff_type j = offsets[radix_digit(radix_bits<Descending>(key_buf[i]), pass)]++;
+        keys[j] = key_buf[i];
+        vals[j] = std::move(val_buf[i]);
+      }
+    } else if (constructed) {
+      for (diff_type i = 0; i < n; ++i) {
+        const diff_type j = offsets[radix_digit(radix_bits<Descending>(keys[i]), pass)]++;
+        key_buf[j] = keys[i];
+        val_buf[j] = std::move(vals[i]);
+      }
+    } else {
+      for (diff_type i = 0; i < n; ++i) {
+        const diff_type j = offsets[radix_digit(radix_bits<Descending>(keys[i]), pass)]++;
+        key_buf[j] = keys[i];
+        radix_construct(val_storage.construct_ptr(j), std::move(vals[i]));
+      }
+      val_storage.set_constructed(n);
+      constructed = true;
+    }
+    in_buf = !in_buf;
+  }
+
+  if (in_buf) {
+    std::copy(key_buf.get(), key_buf.get() + n, keys);
+    for (diff_type i = 0; i < n; ++i) {
+      vals[i] = std::move(val_buf[i]);
+    }
+  }
+}
+
+/*!
+    \brief stable LSD radix sort of keys
+*/
+template <bool Descending, typename KeyIter>
+RAJA_INLINE void radix_sort(KeyIter keys, KeyIter keys_end)
+{
+  radix_sort_pairs<Descending>(keys, keys_end, radix_no_vals{});
+}
+
 }  // namespace detail
 
 /*!
@@ -845,6 +1149,60 @@ merge_sort(Container&& c,
   }
 }
 
+/*!
+    \brief stable radix sort given range inplace using RAJA::operators::less
+    or RAJA::operators::greater on arithmetic keys
+    and using O(N) operations and O(N) memory
+*/
+template <typename Container,
+          typename Compare = operators::less<detail::ContainerVal<Container>>>
+RAJA_INLINE
+concepts::enable_if<type_traits::is_range<Container>>
+radix_sort(Container&& c,
+           Compare = Compare{})
+{
+  using std::begin;
+  using std::end;
+  using T = RAJA::detail::ContainerVal<Container>;
+  static_assert(detail::is_radix_sortable<T, Compare>::value,
+                "radix_sort requires arithmetic keys and "
+                "RAJA::operators::less or RAJA::operators::greater");
+  static_assert(type_traits::is_random_access_range<Container>::value,
+                "Container must model RandomAccessRange");
+
+  detail::radix_sort<detail::radix_descending<Compare>::value>(begin(c), end(c));
+}
+
+/*!
+    \brief stable radix sort given ranges of keys and values inplace using
+    RAJA::operators::less or RAJA::operators::greater on arithmetic keys
+    and using O(N) operations and O(N) memory
+*/
+template <typename KeyContainer,
+          typename ValContainer,
+          typename Compare = operators::less<detail::ContainerVal<KeyContainer>>>
+RAJA_INLINE
+concepts::enable_if<type_traits::is_range<KeyContainer>,
+                    type_traits::is_range<ValContainer>>
+radix_sort_pairs(KeyContainer&& keys,
+                 ValContainer&& vals,
+                 Compare = Compare{})
+{
+  using std::begin;
+  using std::end;
+  using T = RAJA::detail::ContainerVal<KeyContainer>;
+  static_assert(detail::is_radix_sortable<T, Compare>::value,
+                "radix_sort_pairs requires arithmetic keys and "
+                "RAJA::operators::less or RAJA::operators::greater");
+  static_assert(type_traits::is_random_access_range<KeyContainer>::value,
+                "KeyContainer must model RandomAccessRange");
+  static_assert(type_traits::is_random_access_range<ValContainer>::value,
+                "ValContainer must model RandomAccessRange");
+
+  detail::radix_sort_pairs<detail::radix_descending<Compare>::value>(
+      begin(keys), end(keys), begin(vals));
+}
+
 }  // namespace RAJA
 
 #endif
@@ -0,0 +1,205 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Implementation file for graph coloring index set builder methods.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-21, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+#include "RAJA/index/IndexSetBuilders.hpp"
+
+#include "RAJA/index/IndexSet.hpp"
+#include "RAJA/index/ListSegment.hpp"
+
+#include "camp/resource.hpp"
+
+namespace RAJA
+{
+
+namespace
+{
+
+/*
+ * Pseudo-random priority of an element, ties are broken by element index.
+ */
+inline uint64_t colorPriority(RAJA::Index_type elem)
+{
+  uint64_t x = static_cast<uint64_t>(elem) + 0x9e3779b97f4a7c15ull;
+  x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ull;
+  x = (x ^ (x >> 27)) * 0x94d049bb133111ebull;
+  return x ^ (x >> 31);
+}
+
+inline bool colorBefore(RAJA::Index_type a, RAJA::Index_type b)
+{
+  const uint64_t pa = colorPriority(a);
+  const uint64_t pb = colorPriority(b);
+  return pa > pb || (pa == pb && a < b);
+}
+
+}  // namespace
+
+/*
+ ******************************************************************************
+ *
+ * Generate a "color" index set containing list segments from a general
+ * element to node connectivity.
+ *
+ ******************************************************************************
+ */
+int buildColorIndexSet(
+    RAJA::TypedIndexSet<RAJA::ListSegment>& iset,
+    camp::resources::Resource work_res,
+    RAJA::Index_type const* elemToNodeOffsets,
+    RAJA::Index_type const* elemToNode,
+    RAJA::Index_type numElem,
+    RAJA::Index_type numNode)
+{
+  if (numElem <= 0) return 0;
+
+  /* create the inverse node to element mapping */
+  std::vector<RAJA::Index_type> nodeToElemOffsets(numNode + 1, 0);
+  for (RAJA::Index_type i = 0; i < elemToNodeOffsets[numElem]; ++i) {
+    ++nodeToElemOffsets[elemToNode[i] + 1];
+  }
+  for (RAJA::Index_type n = 0; n < numNode; ++n) {
+    nodeToElemOffsets[n + 1] += nodeToElemOffsets[n];
+  }
+  std::vector<RAJA::Index_type> nodeToElem(nodeToElemOffsets[numNode]);
+  {
+    std::vector<RAJA::Index_type> fill(nodeToElemOffsets.begin(),
+                                       nodeToElemOffsets.end() - 1);
+    for (RAJA::Index_type e = 0; e < numElem; ++e) {
+      for (RAJA::Index_type j = elemToNodeOffsets[e];
+           j < elemToNodeOffsets[e + 1];
+           ++j) {
+        nodeToElem[fill[elemToNode[j]]++] = e;
+      }
+    }
+  }
+
+  /*
+   * Jones-Plassmann coloring, in each round every uncolored element whose
+   * priority is higher than that of all its uncolored neighbors takes the
+   * smallest color not used by its neighbors. Those elements are never
+   * neighbors, so they are colored in parallel.
+   */
+  std::vector<int> color(numElem, -1);
+  std::vector<char> selected(numElem, 0);
+  std::vector<RAJA::Index_type> uncolored(numElem);
+  for (RAJA::Index_type e = 0; e < numElem; ++e) {
+    uncolored[e] = e;
+  }
+
+  while (!uncolored.empty()) {
+    const RAJA::Index_type numUncolored =
+        static_cast<RAJA::Index_type>(uncolored.size());
+
+#if defined(RAJA_ENABLE_OPENMP)
+#pragma omp parallel
+#endif
+    {
+      std::vector<char> used;
+
+#if defined(RAJA_ENABLE_OPENMP)
+#pragma omp for schedule(dynamic, 256)
+#endif
+      for (RAJA::Index_type u = 0; u < numUncolored; ++u) {
+        const RAJA::Index_type e = uncolored[u];
+        bool isMax = true;
+        for (RAJA::Index_type j = elemToNodeOffsets[e];
+             isMax && j < elemToNodeOffsets[e + 1];
+             ++j) {
+          const RAJA::Index_type n = elemToNode[j];
+          for (RAJA::Index_type k = nodeToElemOffsets[n];
+               k < nodeToElemOffsets[n + 1];
+               ++k) {
+            const RAJA::Index_type f = nodeToElem[k];
+            if (f != e && color[f] < 0 && colorBefore(f, e)) {
+              isMax = false;
+              break;
+            }
+          }
+        }
+        selected[e] = isMax;
+      }
+
+#if defined(RAJA_ENABLE_OPENMP)
+#pragma omp for schedule(dynamic, 256)
+#endif
+      for (RAJA::Index_type u = 0; u < numUncolored; ++u) {
+        const RAJA::Index_type e = uncolored[u];
+        if (!selected[e]) continue;
+
+        used.assign(used.size(), 0);
+        for (RAJA::Index_type j = elemToNodeOffsets[e];
+             j < elemToNodeOffsets[e + 1];
+             ++j) {
+          const RAJA::Index_type n = elemToNode[j];
+          for (RAJA::Index_type k = nodeToElemOffsets[n];
+               k < nodeToElemOffsets[n + 1];
+               ++k) {
+            const int c = color[nodeToElem[k]];
+            if (c >= 0) {
+              if (static_cast<size_t>(c) >= used.size()) {
+                used.resize(c + 1, 0);
+              }
+              used[c] = 1;
+            }
+          }
+        }
+        color[e] = static_cast<int>(
+            std::find(used.begin(), used.end(), 0) - used.begin());
+      }
+    }
+
+    uncolored.erase(std::remove_if(uncolored.begin(),
+                                   uncolored.end(),
+                                   [&](RAJA::Index_type e) {
+                                     return color[e] >= 0;
+                                   }),
+                    uncolored.end());
+  }
+
+  /* gather the elements of each color in increasing order */
+  const int numColors = *std::max_element(color.begin(), color.end()) + 1;
+
+  std::vector<RAJA::Index_type> colorOffsets(numColors + 1, 0);
+  for (RAJA::Index_type e = 0; e < numElem; ++e) {
+    ++colorOffsets[color[e] + 1];
+  }
+  for (int c = 0; c < numColors; ++c) {
+    colorOffsets[c + 1] += colorOffsets[c];
+  }
+  std::vector<RAJA::Index_type> colorElems(numElem);
+  {
+    std::vector<RAJA::Index_type> fill(colorOffsets.begin(),
+                                       colorOffsets.end() - 1);
+    for (RAJA::Index_type e = 0; e < numElem; ++e) {
+      colorElems[fill[color[e]]++] = e;
+    }
+  }
+
+  for (int c = 0; c < numColors; ++c) {
+    iset.push_back(RAJA::ListSegment(&colorElems[colorOffsets[c]],
+                                     colorOffsets[c + 1] - colorOffsets[c],
+                                     work_res));
+  }
+
+  return numColors;
+}
+
+}  // namespace RAJA
@@ -20,6 +20,7 @@
 #include <cstring>
 
 #include <iostream>
+#include <utility>
 
 #include "RAJA/index/IndexSetBuilders.hpp"
 
@@ -34,6 +35,43 @@
 namespace RAJA
 {
 
+/*
+ ******************************************************************************
+ *
+ * Attach a dependency graph to a lock-free block index set whose segments
+ * were pushed lane by lane: numLanes lanes of numPerLane segments each, so
+ * the segment at spatial position k * numLanes + lane is segment
+ * lane * numPerLane + k. Neighbouring positions always fall in different
+ * lanes; each neighbouring pair is ordered lower lane first, so segments
+ * that touch each other never run at the same time.
+ *
+ ******************************************************************************
+ */
+static void buildLaneDependencyGraph(
+    RAJA::TypedIndexSet<RAJA::RangeSegment>& iset,
+    int numLanes,
+    int numPerLane)
+{
+  const int numSegments = numLanes * numPerLane;
+
+  /* Allocate dependency graph structures for index set segments */
+  iset.initDependencyGraph();
+
+  for (int pos = 0; pos + 1 < numSegments; ++pos) {
+    int first = pos;
+    int second = pos + 1;
+    if (second % numLanes < first % numLanes) {
+      std::swap(first, second);
+    }
+    RAJA::DepGraphNode* task = iset.getDepGraphNode(
+        (first % numLanes) * numPerLane + first / numLanes);
+    task->depTaskNum(task->numDepTasks()++) =
+        (second % numLanes) * numPerLane + second / numLanes;
+  }
+
+  iset.finalizeDependencyGraph();
+}
+
 /*
  ******************************************************************************
  *
@@ -60,9 +98,8 @@ void buildLockFreeBlockIndexset(
       // printf("%d %d\n", 0, fastDim) ;
       iset.push_back(RAJA::RangeSegment(0, fastDim));
     } else {
-      /* This just sets up the schedule -- a truly safe */
-      /* execution of this schedule would require a check */
-      /* for completion of dependent threads before execution. */
+      /* Segments are laid out in three interleaved lanes; the dependency */
+      /* graph keeps neighbouring segments from running concurrently. */
 
       /* We might want to force one thread if the */
       /* profitability ratio is really bad, but for */
@@ -76,6 +113,8 @@ void buildLockFreeBlockIndexset(
           iset.push_back(RAJA::RangeSegment(start, end));
         }
       }
+
+      buildLaneDependencyGraph(iset, 3, numThreads);
     }
   } else if (slowDim == 0) /* 2d mesh */
   {
@@ -84,9 +123,9 @@ void buildLockFreeBlockIndexset(
       // printf("%d %d\n", 0, fastDim*midDim) ;
       iset.push_back(RAJA::RangeSegment(0, fastDim * midDim));
     } else {
-      /* This just sets up the schedule -- a truly safe */
-      /* execution of this schedule would require a check */
-      /* for completion of dependent threads before execution. */
+      /* Each thread owns a slab of rows split into three lanes; the */
+      /* dependency graph keeps neighbouring lanes from running */
+      /* concurrently. */
 
       /* We might want to force one thread if the */
       /* profitability ratio is really bad, but for */
@@ -104,88 +143,45 @@ void buildLockFreeBlockIndexset(
                                             start + (lane + 1) * len / 3));
         }
       }
+
+      buildLaneDependencyGraph(iset, 3, numThreads);
     }
   } else { /* 3d mesh */
 
-    // this requires dependence graph - commenting out for now
-
-    /* Need at least 3 full planes per thread */
-    /* and at least one segment per plane */
-    /*
-        const int segmentsPerThread = 2;
-        int rowsPerSegment = slowDim / (segmentsPerThread * numThreads);
-        if (rowsPerSegment == 0) {
-          // printf("%d %d\n", 0, fastDim*midDim*slowDim) ;
-          iset.push_back(RAJA::RangeSegment(0, fastDim * midDim * slowDim));
-          printf(
-              "Failure to create lockfree indexset - not enough rows per "
-              "segment\n");
-          exit(-1);
-        } else {
-    */
-    /* This just sets up the schedule -- a truly safe */
-    /* execution of this schedule would require a check */
-    /* for completion of dependent threads before execution. */
-
-    /* We might want to force one thread if the */
-    /* profitability ratio is really bad, but for */
-    /* now use the brain dead approach. */
-    /*
-          for (int lane = 0; lane < segmentsPerThread; ++lane) {
-            for (int i = 0; i < numThreads; ++i) {
-              RAJA::Index_type startPlane = i * slowDim / numThreads;
-              RAJA::Index_type endPlane = (i + 1) * slowDim / numThreads;
-              RAJA::Index_type start = startPlane * fastDim * midDim;
-              RAJA::Index_type end = endPlane * fastDim * midDim;
-              RAJA::Index_type len = end - start;
-              // printf("%d %d\n", start + (lane  )*len/segmentsPerThread,
-              //                   start + (lane+1)*len/segmentsPerThread  );
-              iset.push_back(
-                  RAJA::RangeSegment(start + (lane)*len / segmentsPerThread,
-                                     start + (lane + 1) * len /
-       segmentsPerThread));
-            }
-          }
-    */
-    /* Allocate dependency graph structures for index set segments */
-    /*
-          iset.initDependencyGraph();
-
-          if (segmentsPerThread == 1) {
-    */
-    /* This dependency graph should impose serialization */
-    /*
-            for (int i = 0; i < numThreads; ++i) {
-              RAJA::DepGraphNode* task =
-       iset.getSegmentInfo(i)->getDepGraphNode(); task->semaphoreValue() = ((i
-       == 0) ? 0 : 1); task->semaphoreReloadValue() = ((i == 0) ? 0 : 1); if (i
-       != numThreads - 1) { task->numDepTasks() = 1; task->depTaskNum(0) = i +
-       1;
-              }
-            }
-          } else {
-    */
-    /* This dependency graph relies on omp schedule(static, 1) */
-    /* but allows a minimumal set of dependent tasks be used */
-    /*
-            int borderSeg = numThreads * (segmentsPerThread - 1);
-            for (int i = 1; i < numThreads; ++i) {
-              RAJA::DepGraphNode* task =
-       iset.getSegmentInfo(i)->getDepGraphNode(); task->semaphoreReloadValue() =
-       1; task->numDepTasks() = 1; task->depTaskNum(0) = borderSeg + i - 1;
-
-              RAJA::DepGraphNode* border_task =
-                  iset.getSegmentInfo(borderSeg + i - 1)->getDepGraphNode();
-              border_task->semaphoreValue() = 1;
-              border_task->semaphoreReloadValue() = 1;
-              border_task->numDepTasks() = 1;
-              border_task->depTaskNum(0) = i;
-            }
-          }
-
-          iset.finalizeDependencyGraph();
+    /* Each thread owns a slab of planes split into segmentsPerThread */
+    /* segments; lane 0 segments never touch each other, so they run */
+    /* concurrently, and a lane 1 segment runs once the lane 0 segments */
+    /* on either side of it have completed. */
+    const int segmentsPerThread = 2;
+    int rowsPerSegment = slowDim / (segmentsPerThread * numThreads);
+    if (rowsPerSegment == 0) {
+      // printf("%d %d\n", 0, fastDim*midDim*slowDim) ;
+      iset.push_back(RAJA::RangeSegment(0, fastDim * midDim * slowDim));
+    } else {
+      for (int lane = 0; lane < segmentsPerThread; ++lane) {
+        for (int i = 0; i < numThreads; ++i) {
+          RAJA::Index_type startPlane = i * slowDim / numThreads;
+          RAJA::Index_type endPlane = (i + 1) * slowDim / numThreads;
+          RAJA::Index_type start = startPlane * fastDim * midDim;
+          RAJA::Index_type end = endPlane * fastDim * midDim;
+          RAJA::Index_type len = end - start;
+          // printf("%d %d\n", start + (lane  )*len/segmentsPerThread,
+          //                   start + (lane+1)*len/segmentsPerThread  );
+          iset.push_back(
+              RAJA::RangeSegment(start + (lane)*len / segmentsPerThread,
+                                 start + (lane + 1) * len / segmentsPerThread));
         }
-    */
+      }
+
+      buildLaneDependencyGraph(iset, segmentsPerThread, numThreads);
+    }
+  }
+
+  /* The single-segment fallbacks have nothing to order; give them a */
+  /* dependency-free graph so dependency graph policies run them. */
+  if (!iset.dependencyGraphSet()) {
+    iset.initDependencyGraph();
+    iset.finalizeDependencyGraph();
   }
 
   /* Print the dependency schedule for segments */
@@ -0,0 +1,493 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-21, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "RAJA/util/ProfilingPlugin.hpp"
+#include "RAJA/util/macros.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <thread>
+#include <unordered_map>
+
+namespace {
+
+uint64_t now_ns()
+{
+  return static_cast<uint64_t>(
+      std::chrono::duration_cast<std::chrono::nanoseconds>(
+          std::chrono::steady_clock::now().time_since_epoch())
+          .count());
+}
+
+// index of the highest set bit of ns, so bucket b holds [2^b, 2^(b+1)) ns
+int histogram_bucket(uint64_t ns)
+{
+  int b = 0;
+  while (ns > 1 && b < RAJA::util::ProfilingPlugin::num_histogram_buckets - 1) {
+    ns >>= 1;
+    ++b;
+  }
+  return b;
+}
+
+const char* platform_name(RAJA::Platform p)
+{
+  switch (p) {
+    case RAJA::Platform::host: return "host";
+    case RAJA::Platform::cuda: return "cuda";
+    case RAJA::Platform::omp_target: return "omp_target";
+    case RAJA::Platform::hip: return "hip";
+    default: return "undefined";
+  }
+}
+
+std::string json_escape(const std::string& str)
+{
+  std::ostringstream os;
+  for (char c : str) {
+    switch (c) {
+      case '"': os << "\\\""; break;
+      case '\\': os << "\\\\"; break;
+      case '\n': os << "\\n"; break;
+      case '\t': os << "\\t"; break;
+      default:
+        if (static_cast<unsigned char>(c) < 0x20) {
+          os << "\\u" << std::hex << std::setw(4) << std::setfill('0')
+             << static_cast<int>(c) << std::dec << std::setfill(' ');
+        } else {
+          os << c;
+        }
+    }
+  }
+  return os.str();
+}
+
+std::atomic<uint64_t> next_plugin_id{1};
+
+// the user given name of a kernel, or the type name of its loop body
+std::string kernel_name(const RAJA::util::ProfilingPlugin::KernelStats& s)
+{
+  return s.kernel_name.empty()
+             ? RAJA::util::detail::signature_name(s.kernel_signature)
+             : s.kernel_name;
+}
+
+}  // end anonymous namespace
+
+namespace RAJA {
+namespace util {
+
+//
+// Records of one thread, only written by that thread, so launching never
+// takes a lock. Each kernel gets a Record that is pushed onto a list the
+// reporting threads walk; the counters are relaxed atomics behind a
+// per record sequence lock, so readers take a consistent snapshot and
+// retry if the owner updated the record meanwhile. Only the owner looks
+// kernels up, through an open addressing hash table keyed by the context
+// ids and kernel name; the name is left out of the hash, a call site rarely
+// has many names.
+//
+struct ProfilingPlugin::ThreadData
+{
+  struct Record
+  {
+    // set before the record is published, never changed afterwards
+    const void* kernel_id = nullptr;
+    const char* kernel_signature = nullptr;
+    const char* policy_id = nullptr;
+    Platform platform = Platform::undefined;
+    std::string kernel_name;
+    Record* next = nullptr;
+
+    // odd while the owner is updating the counters below
+    std::atomic<uint64_t> seq{0};
+    // ProfilingPlugin::m_epoch the counters were last cleared at
+    std::atomic<uint64_t> epoch{0};
+    std::atomic<uint64_t> num_launches{0};
+    std::atomic<uint64_t> num_iterations{0};
+    std::atomic<uint64_t> total_ns{0};
+    std::atomic<uint64_t> min_ns{UINT64_MAX};
+    std::atomic<uint64_t> max_ns{0};
+    std::atomic<uint64_t> histogram[num_histogram_buckets];
+
+    Record()
+    {
+      for (auto& h : histogram) {
+        h.store(0, std::memory_order_relaxed);
+      }
+    }
+
+    static void set(std::atomic<uint64_t>& a, uint64_t v)
+    {
+      a.store(v, std::memory_order_relaxed);
+    }
+
+    static uint64_t get(const std::atomic<uint64_t>& a)
+    {
+      return a.load(std::memory_order_relaxed);
+    }
+
+    // called by the owning thread only
+    void record(uint64_t current_epoch, size_t iterations, uint64_t elapsed)
+    {
+      const uint64_t s = get(seq);
+      seq.store(s + 1, std::memory_order_relaxed);
+      std::atomic_thread_fence(std::memory_order_release);
+
+      if (get(epoch) != current_epoch) {
+        set(num_launches, 0);
+        set(num_iterations, 0);
+        set(total_ns, 0);
+        set(min_ns, UINT64_MAX);
+        set(max_ns, 0);
+        for (auto& h : histogram) {
+          set(h, 0);
+        }
+        set(epoch, current_epoch);
+      }
+      set(num_launches, get(num_launches) + 1);
+      set(num_iterations, get(num_iterations) + iterations);
+      set(total_ns, get(total_ns) + elapsed);
+      set(min_ns, std::min(get(min_ns), elapsed));
+      set(max_ns, std::max(get(max_ns), elapsed));
+      auto& bucket = histogram[histogram_bucket(elapsed)];
+      set(bucket, get(bucket) + 1);
+
+      seq.store(s + 2, std::memory_order_release);
+    }
+
+    // consistent copy of the counters, safe from any thread; returns false
+    // if the record holds nothing for current_epoch
+    bool snapshot(uint64_t current_epoch, KernelStats& out) const
+    {
+      for (;;) {
+        const uint64_t s = seq.load(std::memory_order_acquire);
+        if (s & 1) {
+          std::this_thread::yield();
+          continue;
+        }
+        const uint64_t e = get(epoch);
+        out.num_launches = get(num_launches);
+        out.num_iterations = get(num_iterations);
+        out.total_ns = get(total_ns);
+        out.min_ns = get(min_ns);
+        out.max_ns = get(max_ns);
+        for (int b = 0; b < num_histogram_buckets; ++b) {
+          out.histogram[b] = get(histogram[b]);
+        }
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (seq.load(std::memory_order_relaxed) != s) continue;
+
+        if (e != current_epoch || out.num_launches == 0) return false;
+        out.kernel_id = kernel_id;
+        out.kernel_signature = kernel_signature;
+        out.policy_id = policy_id;
+        out.platform = platform;
+        out.kernel_name = kernel_name;
+        return true;
+      }
+    }
+  };
+
+  // records published to reporting threads, newest first
+  std::atomic<Record*> head{nullptr};
+
+  // the rest is only touched by the owning thread
+  std::vector<uint64_t> start_ns;
+  std::vector<Record*> table;
+  size_t num_kernels = 0;
+
+  ThreadData() : table(64, nullptr)
+  {
+    start_ns.reserve(16);
+  }
+
+  ~ThreadData()
+  {
+    Record* r = head.load(std::memory_order_acquire);
+    while (r) {
+      Record* next = r->next;
+      delete r;
+      r = next;
+    }
+  }
+
+  static size_t hash(const void* kernel_id, const char* policy_id, Platform platform)
+  {
+    size_t h = reinterpret_cast<size_t>(kernel_id);
+    h ^= reinterpret_cast<size_t>(policy_id) + 0x9e3779b97f4a7c15ull + (h << 6) + (h >> 2);
+    h ^= static_cast<size_t>(platform) + (h << 6) + (h >> 2);
+    return h ^ (h >> 17);
+  }
+
+  Record& find(const PluginContext& p)
+  {
+    if (2 * (num_kernels + 1) > table.size()) {
+      grow();
+    }
+    const char* name = p.kernel_name ? p.kernel_name : "";
+    const size_t mask = table.size() - 1;
+    size_t i = hash(p.kernel_id, p.policy_id, p.platform) & mask;
+    for (;; i = (i + 1) & mask) {
+      Record* r = table[i];
+      if (r == nullptr) {
+        r = new Record;
+        r->kernel_id = p.kernel_id;
+        r->kernel_signature = p.kernel_signature;
+        r->policy_id = p.policy_id;
+        r->platform = p.platform;
+        r->kernel_name = name;
+        r->next = head.load(std::memory_order_relaxed);
+        head.store(r, std::memory_order_release);
+        table[i] = r;
+        ++num_kernels;
+        return *r;
+      }
+      if (r->kernel_id == p.kernel_id && r->policy_id == p.policy_id &&
+          r->platform == p.platform &&
+          std::strcmp(r->kernel_name.c_str(), name) == 0) {
+        return *r;
+      }
+    }
+  }
+
+  void grow()
+  {
+    std::vector<Record*> old(2 * table.size(), nullptr);
+    old.swap(table);
+    const size_t mask = table.size() - 1;
+    for (Record* r : old) {
+      if (r == nullptr) continue;
+      size_t i = hash(r->kernel_id, r->policy_id, r->platform) & mask;
+      while (table[i] != nullptr) {
+        i = (i + 1) & mask;
+      }
+      table[i] = r;
+    }
+  }
+};
+
+double ProfilingPlugin::KernelStats::quantile_ns(double q) const
+{
+  if (num_launches == 0) return 0.0;
+  const double target = q * static_cast<double>(num_launches);
+  double seen = 0.0;
+  for (int b = 0; b < num_histogram_buckets; ++b) {
+    if (histogram[b] == 0) continue;
+    const double count = static_cast<double>(histogram[b]);
+    if (seen + count >= target) {
+      // interpolate within [2^b, 2^(b+1)), clamped to the observed range
+      const double lo = static_cast<double>(uint64_t(1) << b);
+      const double frac = (target - seen) / count;
+      const double est = lo + frac * lo;
+      return std::min(std::max(est, static_cast<double>(min_ns)),
+                      static_cast<double>(max_ns));
+    }
+    seen += count;
+  }
+  return static_cast<double>(max_ns);
+}
+
+ProfilingPlugin::ProfilingPlugin()
+    : m_id(next_plugin_id++), m_epoch(0), m_reported(false)
+{
+}
+
+ProfilingPlugin::~ProfilingPlugin()
+{
+  if (!m_reported) {
+    report();
+  }
+}
+
+ProfilingPlugin::ThreadData& ProfilingPlugin::getThreadData()
+{
+  // Plugin ids are never reused, so the entry of a destroyed plugin is
+  // never looked up again. The last lookup is cached for the common case
+  // of a single profiling plugin.
+  static thread_local std::unordered_map<uint64_t, ThreadData*> thread_data;
+  static thread_local uint64_t last_id = 0;
+  static thread_local ThreadData* last_data = nullptr;
+
+  if (last_id != m_id) {
+    ThreadData*& data = thread_data[m_id];
+    if (data == nullptr) {
+      std::unique_ptr<ThreadData> new_data(new ThreadData);
+      data = new_data.get();
+      std::lock_guard<std::mutex> lock(m_mutex);
+      m_thread_data.push_back(std::move(new_data));
+    }
+    last_id = m_id;
+    last_data = data;
+  }
+  return *last_data;
+}
+
+void ProfilingPlugin::preLaunch(const RAJA::util::PluginContext& RAJA_UNUSED_ARG(p))
+{
+  ThreadData& data = getThreadData();
+  data.start_ns.push_back(now_ns());
+}
+
+void ProfilingPlugin::postLaunch(const RAJA::util::PluginContext& p)
+{
+  const uint64_t stop = now_ns();
+  ThreadData& data = getThreadData();
+  if (data.start_ns.empty()) return;
+  const uint64_t elapsed = stop - data.start_ns.back();
+  data.start_ns.pop_back();
+
+  data.find(p).record(m_epoch.load(std::memory_order_relaxed),
+                      p.num_iterations,
+                      elapsed);
+}
+
+void ProfilingPlugin::finalize()
+{
+  report();
+}
+
+std::vector<ProfilingPlugin::KernelStats> ProfilingPlugin::getStats() const
+{
+  std::vector<KernelStats> merged;
+  const uint64_t epoch = m_epoch.load(std::memory_order_relaxed);
+  KernelStats s;
+  std::lock_guard<std::mutex> lock(m_mutex);
+  for (const auto& data : m_thread_data) {
+    for (const ThreadData::Record* r =
+             data->head.load(std::memory_order_acquire);
+         r != nullptr;
+         r = r->next) {
+      if (!r->snapshot(epoch, s)) continue;
+      auto it = std::find_if(merged.begin(), merged.end(),
+                             [&](const KernelStats& m) {
+                               return m.kernel_id == s.kernel_id &&
+                                      m.policy_id == s.policy_id &&
+                                      m.platform == s.platform &&
+                                      m.kernel_name == s.kernel_name;
+                             });
+      if (it == merged.end()) {
+        merged.push_back(s);
+        continue;
+      }
+      it->num_launches += s.num_launches;
+      it->num_iterations += s.num_iterations;
+      it->total_ns += s.total_ns;
+      it->min_ns = std::min(it->min_ns, s.min_ns);
+      it->max_ns = std::max(it->max_ns, s.max_ns);
+      for (int b = 0; b < num_histogram_buckets; ++b) {
+        it->histogram[b] += s.histogram[b];
+      }
+    }
+  }
+  std::sort(merged.begin(), merged.end(),
+            [](const KernelStats& a, const KernelStats& b) {
+              return a.total_ns > b.total_ns;
+            });
+  return merged;
+}
+
+void ProfilingPlugin::printSummary(std::ostream& os) const
+{
+  std::vector<KernelStats> stats = getStats();
+
+  os << "[ProfilingPlugin]: " << stats.size() << " kernels\n";
+  os << std::setw(12) << "total(ms)" << std::setw(10) << "launches"
+     << std::setw(12) << "mean(us)" << std::setw(12) << "min(us)"
+     << std::setw(12) << "p50(us)" << std::setw(12) << "p90(us)"
+     << std::setw(12) << "max(us)" << std::setw(14) << "iterations"
+     << "  platform  policy / kernel\n";
+  for (const KernelStats& s : stats) {
+    os << std::fixed << std::setprecision(3)
+       << std::setw(12) << s.total_ns * 1.0e-6
+       << std::setw(10) << s.num_launches
+       << std::setw(12) << s.total_ns * 1.0e-3 / s.num_launches
+       << std::setw(12) << s.min_ns * 1.0e-3
+       << std::setw(12) << s.quantile_ns(0.5) * 1.0e-3
+       << std::setw(12) << s.quantile_ns(0.9) * 1.0e-3
+       << std::setw(12) << s.max_ns * 1.0e-3
+       << std::setw(14) << s.num_iterations
+       << "  " << platform_name(s.platform)
+       << "  " << RAJA::util::detail::signature_name(s.policy_id)
+       << " / " << kernel_name(s) << "\n";
+  }
+  os.flush();
+}
+
+void ProfilingPlugin::printJSON(std::ostream& os) const
+{
+  std::vector<KernelStats> stats = getStats();
+
+  os << "[\n";
+  for (size_t i = 0; i < stats.size(); ++i) {
+    const KernelStats& s = stats[i];
+    os << "  {\"kernel\": \"" << json_escape(kernel_name(s))
+       << "\", \"policy\": \""
+       << json_escape(RAJA::util::detail::signature_name(s.policy_id))
+       << "\", \"platform\": \"" << platform_name(s.platform)
+       << "\", \"launches\": " << s.num_launches
+       << ", \"iterations\": " << s.num_iterations
+       << ", \"total_ns\": " << s.total_ns
+       << ", \"min_ns\": " << s.min_ns
+       << ", \"max_ns\": " << s.max_ns
+       << ", \"histogram_log2_ns\": [";
+    for (int b = 0; b < num_histogram_buckets; ++b) {
+      os << (b ? ", " : "") << s.histogram[b];
+    }
+    os << "]}" << (i + 1 < stats.size() ? "," : "") << "\n";
+  }
+  os << "]\n";
+  os.flush();
+}
+
+void ProfilingPlugin::reset()
+{
+  // records of older epochs are cleared by their owner on its next launch
+  // and skipped by getStats until then
+  m_epoch.fetch_add(1, std::memory_order_relaxed);
+}
+
+void ProfilingPlugin::report()
+{
+  m_reported = true;
+
+  if (getStats().empty()) return;
+
+  const char* env = std::getenv("RAJA_PROFILE_OUTPUT");
+  if (env == nullptr || env[0] == '\0') {
+    printSummary(std::cout);
+    return;
+  }
+
+  std::string path(env);
+  std::ofstream file(path);
+  if (!file) {
+    printf("[ProfilingPlugin]: Could not open %s\n", env);
+    printSummary(std::cout);
+    return;
+  }
+  if (path.size() > 5 && !path.compare(path.size() - 5, 5, ".json")) {
+    printJSON(file);
+  } else {
+    printSummary(file);
+  }
+}
+
+void linkProfilingPlugin() {}
+
+} // end namespace util
+} // end namespace RAJA
+
+static RAJA::util::PluginRegistry::add<RAJA::util::ProfilingPlugin> P("ProfilingPlugin", "Prints per-kernel launch statistics.");
@@ -0,0 +1,110 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Implementation file for structured index set builder methods.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-21, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include <algorithm>
+#include <vector>
+
+#include "RAJA/index/IndexSetBuilders.hpp"
+
+#include "RAJA/index/IndexSet.hpp"
+#include "RAJA/index/ListSegment.hpp"
+#include "RAJA/index/RangeSegment.hpp"
+
+#include "camp/resource.hpp"
+
+namespace RAJA
+{
+
+/*
+ ******************************************************************************
+ *
+ * Generate an index set with Range, RangeStride, and List segments from
+ * given array of indices, reordered for locality.
+ *
+ ******************************************************************************
+ */
+void buildIndexSetStructured(
+    RAJA::TypedIndexSet<RAJA::RangeSegment,
+                        RAJA::RangeStrideSegment,
+                        RAJA::ListSegment>& iset,
+    camp::resources::Resource work_res,
+    const RAJA::Index_type* const indices_in,
+    RAJA::Index_type length,
+    RAJA::Index_type range_min_length)
+{
+  if (length <= 0) return;
+
+  // a run needs two indices to have a stride
+  if (range_min_length < 2) range_min_length = 2;
+
+  std::vector<RAJA::Index_type> indices(indices_in, indices_in + length);
+  std::sort(indices.begin(), indices.end());
+  indices.erase(std::unique(indices.begin(), indices.end()), indices.end());
+
+  const RAJA::Index_type num_indices =
+      static_cast<RAJA::Index_type>(indices.size());
+
+  // indices not in any run, emitted as a list segment before the next run
+  std::vector<RAJA::Index_type> irregular;
+
+  RAJA::Index_type ii = 0;
+  while (ii < num_indices) {
+
+    // find the longest run of constant stride starting at ii
+    RAJA::Index_type run_end = ii + 1;
+    RAJA::Index_type stride = 0;
+    if (run_end < num_indices) {
+      stride = indices[run_end] - indices[ii];
+      while (run_end < num_indices &&
+             indices[run_end] - indices[run_end - 1] == stride) {
+        ++run_end;
+      }
+    }
+    const RAJA::Index_type run_length = run_end - ii;
+
+    if (run_length >= range_min_length) {
+      if (!irregular.empty()) {
+        iset.push_back(ListSegment(irregular.data(),
+                                   irregular.size(),
+                                   work_res));
+        irregular.clear();
+      }
+      const RAJA::Index_type begin = indices[ii];
+      const RAJA::Index_type end = indices[run_end - 1] + 1;
+      if (stride == 1) {
+        iset.push_back(RangeSegment(begin, end));
+      } else {
+        iset.push_back(RangeStrideSegment(begin, end, stride));
+      }
+      ii = run_end;
+    } else {
+      // a run starting inside this one has the same stride and is shorter,
+      // so only the last index of the run may start a long run
+      const RAJA::Index_type next = std::max(run_end - 1, ii + 1);
+      irregular.insert(irregular.end(),
+                       indices.begin() + ii,
+                       indices.begin() + next);
+      ii = next;
+    }
+  }
+
+  if (!irregular.empty()) {
+    iset.push_back(ListSegment(irregular.data(), irregular.size(), work_res));
+  }
+}
+
+}  // namespace RAJA
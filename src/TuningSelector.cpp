@@ -0,0 +1,215 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Implementation file for the call site registry of TuningSelector.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-21, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "RAJA/policy/TuningSelector.hpp"
+
+#include <cstdlib>
+#include <fstream>
+#include <limits>
+#include <map>
+#include <mutex>
+#include <sstream>
+
+namespace RAJA
+{
+
+namespace detail
+{
+
+namespace
+{
+
+/// Registry of the tuning state of all call sites, keyed by name. The
+/// registry mutex also guards the tuning samples of all buckets, which are
+/// only used by the first launches of each call site and size bucket.
+class TuningRegistry
+{
+public:
+  static TuningRegistry &get()
+  {
+    static TuningRegistry registry;
+    return registry;
+  }
+
+  std::mutex &mutex() { return m_mutex; }
+
+  std::shared_ptr<TuningSite> site(const std::string &key,
+                                   size_t num_policies)
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return site_locked(key, num_policies);
+  }
+
+  /// Load tuned choices saved by save, returns false if the file could not
+  /// be read
+  bool load(const std::string &filename)
+  {
+    std::ifstream file(filename);
+    if (!file) {
+      return false;
+    }
+    std::lock_guard<std::mutex> lock(m_mutex);
+    std::string line;
+    while (std::getline(file, line)) {
+      std::istringstream fields(line);
+      int bucket = -1;
+      size_t num_policies = 0;
+      int choice = -1;
+      std::string key;
+      if (!(fields >> bucket >> num_policies >> choice) ||
+          !std::getline(fields >> std::ws, key) || bucket < 0 ||
+          bucket >= TuningSite::num_buckets || choice < 0 ||
+          static_cast<size_t>(choice) >= num_policies) {
+        continue;
+      }
+      std::shared_ptr<TuningSite> s = site_locked(key, num_policies);
+      s->buckets[bucket].choice = choice;
+    }
+    return true;
+  }
+
+  /// Save tuned choices, one line per call site and size bucket, returns
+  /// false if the file could not be written
+  bool save(const std::string &filename)
+  {
+    std::ofstream file(filename);
+    if (!file) {
+      return false;
+    }
+    std::lock_guard<std::mutex> lock(m_mutex);
+    for (auto const &entry : m_sites) {
+      TuningSite &s = *entry.second;
+      for (int b = 0; b < TuningSite::num_buckets; ++b) {
+        int choice = s.buckets[b].choice;
+        if (choice >= 0) {
+          file << b << ' ' << s.num_policies << ' ' << choice << ' '
+               << entry.first << '\n';
+        }
+      }
+    }
+    return static_cast<bool>(file);
+  }
+
+  ~TuningRegistry()
+  {
+    if (!m_filename.empty()) {
+      save(m_filename);
+    }
+  }
+
+private:
+  TuningRegistry()
+  {
+    const char *filename = std::getenv("RAJA_MULTI_POLICY_TUNING_FILE");
+    if (filename) {
+      m_filename = filename;
+      load(m_filename);
+    }
+  }
+
+  std::shared_ptr<TuningSite> site_locked(const std::string &key,
+                                          size_t num_policies)
+  {
+    std::shared_ptr<TuningSite> &site = m_sites[key];
+    if (!site || site->num_policies != num_policies) {
+      // a different list of policies invalidates any previous tuning,
+      // selectors holding the old site keep using it unchanged
+      site = std::make_shared<TuningSite>(num_policies);
+    }
+    return site;
+  }
+
+  std::mutex m_mutex;
+  std::map<std::string, std::shared_ptr<TuningSite>> m_sites;
+  std::string m_filename;
+};
+
+void init_bucket(TuningSite &site, TuningBucket &bucket)
+{
+  if (bucket.num_samples.size() != site.num_policies) {
+    bucket.best_time.assign(site.num_policies,
+                            std::numeric_limits<double>::max());
+    bucket.num_samples.assign(site.num_policies, 0);
+  }
+}
+
+}  // namespace
+
+std::shared_ptr<TuningSite> getTuningSite(const std::string &key,
+                                          size_t num_policies)
+{
+  return TuningRegistry::get().site(key, num_policies);
+}
+
+size_t nextTuningPolicy(TuningSite &site, TuningBucket &bucket)
+{
+  std::lock_guard<std::mutex> lock(TuningRegistry::get().mutex());
+  int choice = bucket.choice.load(std::memory_order_relaxed);
+  if (choice >= 0) {
+    return static_cast<size_t>(choice);
+  }
+  init_bucket(site, bucket);
+  size_t next = 0;
+  for (size_t p = 1; p < bucket.num_samples.size(); ++p) {
+    if (bucket.num_samples[p] < bucket.num_samples[next]) {
+      next = p;
+    }
+  }
+  return next;
+}
+
+void reportTuningTime(TuningSite &site,
+                      TuningBucket &bucket,
+                      size_t index,
+                      double seconds,
+                      int num_samples)
+{
+  std::lock_guard<std::mutex> lock(TuningRegistry::get().mutex());
+  if (bucket.choice.load(std::memory_order_relaxed) >= 0) {
+    return;
+  }
+  init_bucket(site, bucket);
+  if (seconds < bucket.best_time[index]) {
+    bucket.best_time[index] = seconds;
+  }
+  ++bucket.num_samples[index];
+
+  size_t fastest = 0;
+  for (size_t p = 0; p < bucket.num_samples.size(); ++p) {
+    if (bucket.num_samples[p] < num_samples) {
+      return;
+    }
+    if (bucket.best_time[p] < bucket.best_time[fastest]) {
+      fastest = p;
+    }
+  }
+  bucket.choice.store(static_cast<int>(fastest), std::memory_order_relaxed);
+}
+
+}  // namespace detail
+
+bool loadMultiPolicyTuning(const std::string &filename)
+{
+  return detail::TuningRegistry::get().load(filename);
+}
+
+bool saveMultiPolicyTuning(const std::string &filename)
+{
+  return detail::TuningRegistry::get().save(filename);
+}
+
+}  // namespace RAJA
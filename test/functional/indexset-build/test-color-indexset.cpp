@@ -0,0 +1,97 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-21, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing tests for graph coloring index set builder.
+///
+
+#include "RAJA_test-base.hpp"
+
+#include "RAJA/index/IndexSetBuilders.hpp"
+
+#include "camp/resource.hpp"
+
+#include <vector>
+
+TEST(IndexSetBuild, Color)
+{
+  //
+  // 2D mesh of N x N quad elements, each element touches its 4 vertices
+  //
+  const RAJA::Index_type N = 37;
+  const RAJA::Index_type numElem = N * N;
+  const RAJA::Index_type numNode = (N + 1) * (N + 1);
+
+  std::vector<RAJA::Index_type> offsets(numElem + 1);
+  std::vector<RAJA::Index_type> elemToNode(4 * numElem);
+  for (RAJA::Index_type j = 0; j < N; ++j) {
+    for (RAJA::Index_type i = 0; i < N; ++i) {
+      RAJA::Index_type e = i + j * N;
+      offsets[e] = 4 * e;
+      elemToNode[4 * e] = e + j;
+      elemToNode[4 * e + 1] = e + j + 1;
+      elemToNode[4 * e + 2] = e + j + N + 1;
+      elemToNode[4 * e + 3] = e + j + N + 2;
+    }
+  }
+  offsets[numElem] = 4 * numElem;
+
+  camp::resources::Resource res{camp::resources::Host()};
+
+  RAJA::TypedIndexSet<RAJA::ListSegment> iset;
+
+  int numColors = RAJA::buildColorIndexSet(
+      iset, res, offsets.data(), elemToNode.data(), numElem, numNode);
+
+  ASSERT_GE(numColors, 4);
+  ASSERT_EQ(iset.getNumSegments(), numColors);
+  ASSERT_EQ(iset.getLength(), static_cast<size_t>(numElem));
+
+  std::vector<int> elemCount(numElem, 0);
+  for (int c = 0; c < numColors; ++c) {
+    const RAJA::ListSegment& seg = iset.getSegment<const RAJA::ListSegment>(c);
+    ASSERT_GT(seg.size(), 0);
+
+    // no two elements of a color share a node
+    std::vector<int> nodeCount(numNode, 0);
+    RAJA::Index_type prev = -1;
+    for (RAJA::Index_type e : seg) {
+      ASSERT_GT(e, prev);
+      prev = e;
+      ++elemCount[e];
+      for (RAJA::Index_type j = offsets[e]; j < offsets[e + 1]; ++j) {
+        ASSERT_EQ(nodeCount[elemToNode[j]]++, 0);
+      }
+    }
+  }
+
+  for (RAJA::Index_type e = 0; e < numElem; ++e) {
+    ASSERT_EQ(elemCount[e], 1);
+  }
+
+  // scatter to nodes in parallel within each color
+  std::vector<int> nodeSum(numNode, 0);
+  int* nodeSum_ptr = nodeSum.data();
+  const RAJA::Index_type* elemToNode_ptr = elemToNode.data();
+#if defined(RAJA_ENABLE_OPENMP)
+  using EXEC_POL = RAJA::ExecPolicy<RAJA::seq_segit, RAJA::omp_parallel_for_exec>;
+#else
+  using EXEC_POL = RAJA::ExecPolicy<RAJA::seq_segit, RAJA::seq_exec>;
+#endif
+  RAJA::forall<EXEC_POL>(iset, [=](RAJA::Index_type e) {
+    for (int v = 0; v < 4; ++v) {
+      nodeSum_ptr[elemToNode_ptr[4 * e + v]] += 1;
+    }
+  });
+
+  for (RAJA::Index_type j = 0; j <= N; ++j) {
+    for (RAJA::Index_type i = 0; i <= N; ++i) {
+      int expected = ((i > 0) + (i < N)) * ((j > 0) + (j < N));
+      ASSERT_EQ(nodeSum[i + j * (N + 1)], expected);
+    }
+  }
+}
@@ -0,0 +1,239 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-21, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing tests for lock-free index set builders and
+/// dependency graph execution.
+///
+
+#include "RAJA_test-base.hpp"
+
+#include "RAJA/index/IndexSetBuilders.hpp"
+#include "RAJA/internal/ThreadUtils_CPU.hpp"
+
+#include <atomic>
+#include <vector>
+
+// Check that every pair of touching segments is ordered by the dependency
+// graph, and that running the graph never overlaps touching segments.
+void checkLockFreeLanes(RAJA::TypedIndexSet<RAJA::RangeSegment>& iset,
+                        RAJA::Index_type len)
+{
+  const int num_segs = static_cast<int>(iset.getNumSegments());
+
+  ASSERT_EQ(iset.getLength(), static_cast<size_t>(len));
+  ASSERT_GT(num_segs, 1);
+  ASSERT_TRUE(iset.dependencyGraphSet());
+  ASSERT_EQ(iset.getNumDepGraphNodes(), static_cast<size_t>(num_segs));
+
+  std::vector<int> seg_of(len, -1);
+  for (int s = 0; s < num_segs; ++s) {
+    const auto& seg = iset.getSegment<RAJA::RangeSegment>(s);
+    ASSERT_GT(seg.size(), 0);
+    for (auto i : seg) {
+      seg_of[i] = s;
+    }
+  }
+
+  auto has_edge = [&](int from, int to) {
+    RAJA::DepGraphNode* node = iset.getDepGraphNode(from);
+    for (int ii = 0; ii < node->numDepTasks(); ++ii) {
+      if (node->depTaskNum(ii) == to) return true;
+    }
+    return false;
+  };
+
+  for (RAJA::Index_type i = 1; i < len; ++i) {
+    const int a = seg_of[i - 1];
+    const int b = seg_of[i];
+    if (a != b) {
+      ASSERT_TRUE(has_edge(a, b) || has_edge(b, a));
+    }
+  }
+
+#if defined(RAJA_ENABLE_OPENMP)
+  std::atomic<int> ticket(0);
+  std::vector<int> start(num_segs, -1);
+  std::vector<int> finish(num_segs, -1);
+  std::vector<int> count(len, 0);
+  std::atomic<int>* ticket_ptr = &ticket;
+  int* start_ptr = start.data();
+  int* finish_ptr = finish.data();
+  int* count_ptr = count.data();
+  const int* seg_of_ptr = seg_of.data();
+
+  RAJA::forall<RAJA::ExecPolicy<RAJA::omp_taskgraph_segit, RAJA::seq_exec>>(
+      iset, [=](RAJA::Index_type i) {
+        const int s = seg_of_ptr[i];
+        if (start_ptr[s] < 0) start_ptr[s] = (*ticket_ptr)++;
+        count_ptr[i] += 1;
+        finish_ptr[s] = (*ticket_ptr)++;
+      });
+
+  for (RAJA::Index_type i = 0; i < len; ++i) {
+    ASSERT_EQ(count[i], 1);
+  }
+  for (RAJA::Index_type i = 1; i < len; ++i) {
+    const int a = seg_of[i - 1];
+    const int b = seg_of[i];
+    if (a != b) {
+      ASSERT_TRUE(finish[a] < start[b] || finish[b] < start[a]);
+    }
+  }
+#endif
+}
+
+TEST(IndexSetBuild, LockFreeBlock1d)
+{
+  const int fastDim = 300 * RAJA::getMaxOMPThreadsCPU();
+
+  RAJA::TypedIndexSet<RAJA::RangeSegment> iset;
+  RAJA::buildLockFreeBlockIndexset(iset, fastDim, 0, 0);
+
+  ASSERT_EQ(iset.getNumSegments(), 3u * RAJA::getMaxOMPThreadsCPU());
+  checkLockFreeLanes(iset, fastDim);
+}
+
+TEST(IndexSetBuild, LockFreeBlock2d)
+{
+  const int fastDim = 8;
+  const int midDim = 6 * RAJA::getMaxOMPThreadsCPU();
+
+  RAJA::TypedIndexSet<RAJA::RangeSegment> iset;
+  RAJA::buildLockFreeBlockIndexset(iset, fastDim, midDim, 0);
+
+  ASSERT_EQ(iset.getNumSegments(), 3u * RAJA::getMaxOMPThreadsCPU());
+  checkLockFreeLanes(iset, fastDim * midDim);
+}
+
+TEST(IndexSetBuild, LockFreeBlock3d)
+{
+  const int fastDim = 4;
+  const int midDim = 5;
+  const int slowDim = 64;
+  const RAJA::Index_type len = fastDim * midDim * slowDim;
+
+  RAJA::TypedIndexSet<RAJA::RangeSegment> iset;
+  RAJA::buildLockFreeBlockIndexset(iset, fastDim, midDim, slowDim);
+
+  checkLockFreeLanes(iset, len);
+
+#if defined(RAJA_ENABLE_OPENMP)
+  {
+    std::vector<int> count(len, 0);
+    int* count_ptr = count.data();
+
+    // run twice to check node semaphores are reset
+    for (int rep = 0; rep < 2; ++rep) {
+      RAJA::forall<RAJA::ExecPolicy<RAJA::omp_taskgraph_segit,
+                                    RAJA::seq_exec>>(
+          iset, [=](RAJA::Index_type i) { count_ptr[i] += 1; });
+    }
+
+    for (RAJA::Index_type i = 0; i < len; ++i) {
+      ASSERT_EQ(count[i], 2);
+    }
+  }
+#endif
+}
+
+TEST(IndexSetBuild, LockFreeBlockFallback)
+{
+  // too few planes to split per thread, so a single segment is built
+  const int fastDim = 4;
+  const int midDim = 5;
+  const int slowDim = 1;
+  const RAJA::Index_type len = fastDim * midDim * slowDim;
+
+  RAJA::TypedIndexSet<RAJA::RangeSegment> iset;
+  RAJA::buildLockFreeBlockIndexset(iset, fastDim, midDim, slowDim);
+
+  ASSERT_EQ(iset.getLength(), static_cast<size_t>(len));
+  ASSERT_EQ(iset.getNumSegments(), 1u);
+  ASSERT_TRUE(iset.dependencyGraphSet());
+  ASSERT_EQ(iset.getNumDepGraphNodes(), 1u);
+  ASSERT_EQ(iset.getDepGraphNode(0)->semaphoreReloadValue(), 0);
+
+#if defined(RAJA_ENABLE_OPENMP)
+  std::vector<int> count(len, 0);
+  int* count_ptr = count.data();
+
+  RAJA::forall<RAJA::ExecPolicy<RAJA::omp_taskgraph_segit, RAJA::seq_exec>>(
+      iset, [=](RAJA::Index_type i) { count_ptr[i] += 1; });
+
+  for (RAJA::Index_type i = 0; i < len; ++i) {
+    ASSERT_EQ(count[i], 1);
+  }
+#endif
+}
+
+TEST(IndexSetBuild, DependencyGraphOrder)
+{
+  const int num_segs = 16;
+  const int seg_len = 8;
+
+  RAJA::TypedIndexSet<RAJA::RangeSegment> iset;
+  for (int s = 0; s < num_segs; ++s) {
+    iset.push_back(RAJA::RangeSegment(s * seg_len, (s + 1) * seg_len));
+  }
+
+  // each segment s feeds segments s+1 and s+3
+  iset.initDependencyGraph();
+  for (int s = 0; s < num_segs; ++s) {
+    RAJA::DepGraphNode* node = iset.getDepGraphNode(s);
+    if (s + 1 < num_segs) node->depTaskNum(node->numDepTasks()++) = s + 1;
+    if (s + 3 < num_segs) node->depTaskNum(node->numDepTasks()++) = s + 3;
+  }
+  iset.finalizeDependencyGraph();
+
+  ASSERT_TRUE(iset.dependencyGraphSet());
+  ASSERT_EQ(iset.getDepGraphNode(0)->semaphoreReloadValue(), 0);
+  ASSERT_EQ(iset.getDepGraphNode(1)->semaphoreReloadValue(), 1);
+  ASSERT_EQ(iset.getDepGraphNode(5)->semaphoreReloadValue(), 2);
+
+  // copies carry the graph along
+  RAJA::TypedIndexSet<RAJA::RangeSegment> iset_copy(iset);
+  ASSERT_TRUE(iset_copy.dependencyGraphSet());
+  ASSERT_EQ(iset_copy.getNumDepGraphNodes(), iset.getNumDepGraphNodes());
+
+#if defined(RAJA_ENABLE_OPENMP)
+  std::atomic<int> ticket(0);
+  std::vector<int> start(num_segs, -1);
+  std::vector<int> finish(num_segs, -1);
+  std::atomic<int>* ticket_ptr = &ticket;
+  int* start_ptr = start.data();
+  int* finish_ptr = finish.data();
+
+  RAJA::forall<RAJA::ExecPolicy<RAJA::omp_taskgraph_segit, RAJA::seq_exec>>(
+      iset_copy, [=](RAJA::Index_type i) {
+        const int s = static_cast<int>(i / seg_len);
+        if (i % seg_len == 0) start_ptr[s] = (*ticket_ptr)++;
+        if (i % seg_len == seg_len - 1) finish_ptr[s] = (*ticket_ptr)++;
+      });
+
+  for (int s = 0; s < num_segs; ++s) {
+    ASSERT_GE(start[s], 0);
+    ASSERT_GT(finish[s], start[s]);
+    if (s >= 1) ASSERT_GT(start[s], finish[s - 1]);
+    if (s >= 3) ASSERT_GT(start[s], finish[s - 3]);
+  }
+#endif
+}
+
+TEST(IndexSetBuild, DependencyGraphCycle)
+{
+  RAJA::TypedIndexSet<RAJA::RangeSegment> iset;
+  iset.push_back(RAJA::RangeSegment(0, 4));
+  iset.push_back(RAJA::RangeSegment(4, 8));
+
+  iset.initDependencyGraph();
+  iset.getDepGraphNode(0)->depTaskNum(iset.getDepGraphNode(0)->numDepTasks()++) = 1;
+  iset.getDepGraphNode(1)->depTaskNum(iset.getDepGraphNode(1)->numDepTasks()++) = 0;
+
+  ASSERT_ANY_THROW(iset.finalizeDependencyGraph());
+  ASSERT_FALSE(iset.dependencyGraphSet());
+}
@@ -0,0 +1,86 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-21, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing unit tests for structured IndexSet builder.
+///
+
+#include "RAJA_test-base.hpp"
+
+#include "RAJA/index/IndexSetBuilders.hpp"
+
+#include "camp/resource.hpp"
+
+#include <algorithm>
+#include <vector>
+
+TEST(IndexSetBuild, Structured)
+{
+  const RAJA::Index_type range_min_length = 4;
+
+  using RSType = RAJA::RangeSegment;
+  using RSSType = RAJA::RangeStrideSegment;
+  using LSType = RAJA::ListSegment;
+
+  //
+  // Create index vector, shuffled and with duplicates, containing indices:
+  // {0, 1, ..., 7,  9, 13,  20, 23, ..., 35,  40, 41}
+  //
+  std::vector<RAJA::Index_type> indices;
+  for (RAJA::Index_type i = 0; i < 8; ++i) {
+    indices.push_back(i);
+  }
+  indices.push_back(9);
+  indices.push_back(13);
+  for (RAJA::Index_type i = 20; i < 36; i += 3) {
+    indices.push_back(i);
+  }
+  indices.push_back(40);
+  indices.push_back(41);
+
+  std::vector<RAJA::Index_type> input(indices.rbegin(), indices.rend());
+  input.push_back(3);
+  input.push_back(26);
+  std::swap(input[2], input[9]);
+
+  camp::resources::Resource res{camp::resources::Host()};
+
+  RAJA::TypedIndexSet<RAJA::RangeSegment,
+                      RAJA::RangeStrideSegment,
+                      RAJA::ListSegment> iset;
+
+  RAJA::buildIndexSetStructured(iset,
+                                res,
+                                &input[0],
+                                static_cast<RAJA::Index_type>(input.size()),
+                                range_min_length);
+
+  ASSERT_EQ(iset.getLength(), indices.size());
+
+  ASSERT_EQ(iset.size(), 4);
+
+  const RSType& s0 = iset.getSegment<const RSType>(0);
+  ASSERT_EQ(s0.size(), 8);
+  ASSERT_EQ(*s0.begin(), 0);
+
+  const LSType& s1 = iset.getSegment<const LSType>(1);
+  ASSERT_EQ(s1.size(), 2);
+  ASSERT_EQ(*s1.begin(), 9);
+
+  const RSSType& s2 = iset.getSegment<const RSSType>(2);
+  ASSERT_EQ(s2.size(), 6);
+  ASSERT_EQ(*s2.begin(), 20);
+
+  const LSType& s3 = iset.getSegment<const LSType>(3);
+  ASSERT_EQ(s3.size(), 2);
+  ASSERT_EQ(*s3.begin(), 40);
+
+  std::vector<RAJA::Index_type> visited;
+  RAJA::forall<RAJA::ExecPolicy<RAJA::seq_segit, RAJA::seq_exec>>(
+      iset, [&](RAJA::Index_type i) { visited.push_back(i); });
+  ASSERT_EQ(visited, indices);
+}
@@ -0,0 +1,143 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-21, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef __TEST_SCAN_INCLUSIVE_BY_KEY_HPP__
+#define __TEST_SCAN_INCLUSIVE_BY_KEY_HPP__
+
+#include <numeric>
+
+template <typename OP, typename T>
+::testing::AssertionResult check_inclusive_by_key(const T* actual,
+                                                  const T* original,
+                                                  const int* keys,
+                                                  int N)
+{
+  T init = OP::identity();
+  for (int i = 0; i < N; ++i) {
+    init = (i == 0 || keys[i] != keys[i-1]) ? original[i]
+                                            : OP()(init, original[i]);
+    if (actual[i] != init) {
+      return ::testing::AssertionFailure()
+             << actual[i] << " != " << init << " (at index " << i << ")";
+    }
+  }
+  return ::testing::AssertionSuccess();
+}
+
+template <typename EXEC_POLICY, typename WORKING_RES, typename OP_TYPE>
+void ScanInclusiveByKeyTestImpl(int N, int seg_len)
+{
+  using T = typename OP_TYPE::result_type;
+
+  WORKING_RES res{WORKING_RES::get_default()};
+  camp::resources::Resource working_res{res};
+  camp::resources::Resource host_res{camp::resources::Host()};
+
+  T* work_in;
+  T* work_out;
+  T* host_in;
+  T* host_out;
+
+  allocScanTestData(N,
+                    working_res,
+                    &work_in, &work_out,
+                    &host_in, &host_out);
+
+  int* work_keys  = working_res.allocate<int>(N);
+  int* work_flags = working_res.allocate<int>(N);
+  int* host_keys  = host_res.allocate<int>(N);
+  int* host_flags = host_res.allocate<int>(N);
+
+  std::iota(host_in, host_in + N, 1);
+  for (int i = 0; i < N; ++i) {
+    host_keys[i]  = i / seg_len;
+    host_flags[i] = (i % seg_len == 0) ? 1 : 0;
+  }
+
+  res.memcpy(work_in, host_in, sizeof(T) * N);
+  res.memcpy(work_keys, host_keys, sizeof(int) * N);
+  res.memcpy(work_flags, host_flags, sizeof(int) * N);
+  res.wait();
+
+  // test by key interface without resource
+  RAJA::inclusive_scan_by_key<EXEC_POLICY>(RAJA::make_span(work_keys, N),
+                                           RAJA::make_span(work_in, N),
+                                           RAJA::make_span(work_out, N),
+                                           OP_TYPE{});
+
+  res.memcpy(host_out, work_out, sizeof(T) * N);
+  res.wait();
+
+  ASSERT_TRUE(check_inclusive_by_key<OP_TYPE>(host_out, host_in, host_keys, N));
+
+  // test by key interface with resource
+  RAJA::inclusive_scan_by_key<EXEC_POLICY>(res,
+                                           RAJA::make_span(work_keys, N),
+                                           RAJA::make_span(work_in, N),
+                                           RAJA::make_span(work_out, N),
+                                           OP_TYPE{});
+
+  res.memcpy(host_out, work_out, sizeof(T) * N);
+  res.wait();
+
+  ASSERT_TRUE(check_inclusive_by_key<OP_TYPE>(host_out, host_in, host_keys, N));
+
+  // test head flag interface
+  RAJA::inclusive_segmented_scan<EXEC_POLICY>(RAJA::make_span(work_flags, N),
+                                              RAJA::make_span(work_in, N),
+                                              RAJA::make_span(work_out, N),
+                                              OP_TYPE{});
+
+  res.memcpy(host_out, work_out, sizeof(T) * N);
+  res.wait();
+
+  ASSERT_TRUE(check_inclusive_by_key<OP_TYPE>(host_out, host_in, host_keys, N));
+
+  working_res.deallocate(work_keys);
+  working_res.deallocate(work_flags);
+  host_res.deallocate(host_keys);
+  host_res.deallocate(host_flags);
+
+  deallocScanTestData(working_res,
+                      work_in, work_out,
+                      host_in, host_out);
+}
+
+
+TYPED_TEST_SUITE_P(ScanInclusiveByKeyTest);
+template <typename T>
+class ScanInclusiveByKeyTest : public ::testing::Test
+{
+};
+
+TYPED_TEST_P(ScanInclusiveByKeyTest, ScanInclusiveByKey)
+{
+  using EXEC_POLICY      = typename camp::at<TypeParam, camp::num<0>>::type;
+  using WORKING_RESOURCE = typename camp::at<TypeParam, camp::num<1>>::type;
+  using OP_TYPE          = typename camp::at<TypeParam, camp::num<2>>::type;
+
+  ScanInclusiveByKeyTestImpl<EXEC_POLICY,
+                             WORKING_RESOURCE,
+                             OP_TYPE>(0, 1);
+  ScanInclusiveByKeyTestImpl<EXEC_POLICY,
+                             WORKING_RESOURCE,
+                             OP_TYPE>(357, 1);
+  ScanInclusiveByKeyTestImpl<EXEC_POLICY,
+                             WORKING_RESOURCE,
+                             OP_TYPE>(357, 13);
+  ScanInclusiveByKeyTestImpl<EXEC_POLICY,
+                             WORKING_RESOURCE,
+                             OP_TYPE>(32000, 7);
+  ScanInclusiveByKeyTestImpl<EXEC_POLICY,
+                             WORKING_RESOURCE,
+                             OP_TYPE>(32000, 5000);
+}
+
+REGISTER_TYPED_TEST_SUITE_P(ScanInclusiveByKeyTest,
+                            ScanInclusiveByKey);
+
+#endif // __TEST_SCAN_INCLUSIVE_BY_KEY_HPP__
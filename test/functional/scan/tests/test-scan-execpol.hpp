@@ -0,0 +1,80 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-21, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+//
+// Execution policy lists used in scan tests
+//
+
+#ifndef __TEST_SCAN_EXECPOL_HPP__
+#define __TEST_SCAN_EXECPOL_HPP__
+
+#include "RAJA_test-forall-execpol.hpp"
+
+using SequentialScanExecPols = SequentialForallExecPols;
+
+#if defined(RAJA_ENABLE_OPENMP)
+//
+// Note: the OpenMP forall policies, plus the lookback scan with small tile
+// sizes to exercise the lookback across many tiles.
+//
+using OpenMPScanExecPols =
+  camp::list< RAJA::omp_parallel_for_exec
+              , RAJA::omp_parallel_for_static_exec< >
+              , RAJA::omp_parallel_for_static_exec<4>
+              , RAJA::omp_parallel_scan_exec< >
+              , RAJA::omp_parallel_scan_exec<1024>
+              , RAJA::omp_parallel_scan_exec<8>
+
+#if defined(RAJA_TEST_EXHAUSTIVE)
+              , RAJA::omp_parallel_for_dynamic_exec< >
+              , RAJA::omp_parallel_for_dynamic_exec<4>
+
+              , RAJA::omp_parallel_for_guided_exec< >
+              , RAJA::omp_parallel_for_guided_exec<4>
+
+              , RAJA::omp_parallel_for_runtime_exec
+
+              , RAJA::omp_parallel_exec<RAJA::omp_for_exec>
+
+              , RAJA::omp_parallel_exec<RAJA::omp_for_static_exec< >>
+              , RAJA::omp_parallel_exec<RAJA::omp_for_schedule_exec<RAJA::policy::omp::Static< >>>
+              , RAJA::omp_parallel_exec<RAJA::omp_for_static_exec<8>>
+              , RAJA::omp_parallel_exec<RAJA::omp_for_schedule_exec<RAJA::policy::omp::Static<8>>>
+
+              , RAJA::omp_parallel_exec<RAJA::omp_for_nowait_schedule_exec<RAJA::policy::omp::Static< >>>
+              , RAJA::omp_parallel_exec<RAJA::omp_for_nowait_static_exec<4>>
+              , RAJA::omp_parallel_exec<RAJA::omp_for_nowait_schedule_exec<RAJA::policy::omp::Static<4>>>
+
+              , RAJA::omp_parallel_exec<RAJA::omp_for_dynamic_exec< >>
+              , RAJA::omp_parallel_exec<RAJA::omp_for_schedule_exec<RAJA::policy::omp::Dynamic< >>>
+              , RAJA::omp_parallel_exec<RAJA::omp_for_dynamic_exec<8>>
+              , RAJA::omp_parallel_exec<RAJA::omp_for_schedule_exec<RAJA::policy::omp::Dynamic<8>>>
+
+              , RAJA::omp_parallel_exec<RAJA::omp_for_guided_exec< >>
+              , RAJA::omp_parallel_exec<RAJA::omp_for_schedule_exec<RAJA::policy::omp::Guided< >>>
+              , RAJA::omp_parallel_exec<RAJA::omp_for_guided_exec<8>>
+              , RAJA::omp_parallel_exec<RAJA::omp_for_schedule_exec<RAJA::policy::omp::Guided<8>>>
+
+              , RAJA::omp_parallel_exec<RAJA::omp_for_runtime_exec>
+              , RAJA::omp_parallel_exec<RAJA::omp_for_schedule_exec<RAJA::policy::omp::Runtime>>
+#endif
+            >;
+#endif
+
+#if defined(RAJA_ENABLE_TBB)
+using TBBScanExecPols = TBBForallExecPols;
+#endif
+
+#if defined(RAJA_ENABLE_CUDA)
+using CudaScanExecPols = CudaForallExecPols;
+#endif
+
+#if defined(RAJA_ENABLE_HIP)
+using HipScanExecPols = HipForallExecPols;
+#endif
+
+#endif // __TEST_SCAN_EXECPOL_HPP__
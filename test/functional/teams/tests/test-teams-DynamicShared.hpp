@@ -0,0 +1,111 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-21, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef __TEST_TEAMS_DYNAMIC_SHARED_HPP__
+#define __TEST_TEAMS_DYNAMIC_SHARED_HPP__
+
+template <typename WORKING_RES, typename LAUNCH_POLICY, typename TEAM_POLICY, typename THREAD_POLICY>
+void TeamsDynamicSharedTestImpl()
+{
+
+  constexpr int N = 100;
+  constexpr int TS = 32;
+
+  camp::resources::Resource working_res{WORKING_RES::get_default()};
+  int* working_array;
+  int* check_array;
+  int* test_array;
+
+  allocateForallTestData<int>(N*TS,
+                             working_res,
+                             &working_array,
+                             &check_array,
+                             &test_array);
+
+  //Select platform
+  RAJA::expt::ExecPlace select_cpu_or_gpu;
+  if (working_res.get_platform()  == camp::resources::Platform::host){
+    select_cpu_or_gpu = RAJA::expt::HOST;
+  }else{
+    select_cpu_or_gpu = RAJA::expt::DEVICE;
+  }
+
+  const size_t shared_mem_bytes = TS * (sizeof(int) + sizeof(double));
+
+  // a literal 0 selects the shared memory overload, not the kernel name
+  RAJA::expt::Resources no_shared(RAJA::expt::Teams(N), RAJA::expt::Threads(TS), 0);
+  ASSERT_EQ(no_shared.shared_mem_bytes, 0u);
+  ASSERT_EQ(no_shared.kernel_name, nullptr);
+
+  RAJA::expt::launch<LAUNCH_POLICY>(select_cpu_or_gpu,
+    RAJA::expt::Resources(RAJA::expt::Teams(N), RAJA::expt::Threads(TS),
+                          shared_mem_bytes),
+        [=] RAJA_HOST_DEVICE(RAJA::expt::LaunchContext ctx) {
+
+          RAJA::expt::loop<TEAM_POLICY>(ctx, RAJA::RangeSegment(0, N), [&](int r) {
+
+                // Scratch memory shared within threads of the same team
+                int* s_idx = ctx.getSharedMemory<int>(TS);
+                double* s_val = ctx.getSharedMemory<double>(TS);
+
+                RAJA::expt::loop<THREAD_POLICY>(ctx, RAJA::RangeSegment(0, TS), [&](int c) {
+                    s_idx[c] = c + TS*r;
+                    s_val[c] = 0.5 * r;
+                });
+
+                ctx.teamSync();
+
+                //read values written by other threads, in reverse order
+                RAJA::expt::loop<THREAD_POLICY>(ctx, RAJA::RangeSegment(0, TS), [&](int c) {
+                    const int idx = c + TS*r;
+                    working_array[idx] = s_idx[TS - 1 - c] + static_cast<int>(2.0 * s_val[TS - 1 - c]);
+                });
+
+                ctx.teamSync();
+                ctx.releaseSharedMemory();
+
+              });  // loop r
+        });  // outer lambda
+
+  working_res.memcpy(check_array, working_array, sizeof(int) * N*TS);
+
+  for(int r = 0; r < N; ++r) {
+    for (int c = 0; c < TS; c++) {
+      ASSERT_EQ(TS - 1 - c + TS*r + r, check_array[c + r*TS]);
+    }
+  }
+
+  deallocateForallTestData<int>(working_res,
+                               working_array,
+                               check_array,
+                               test_array);
+}
+
+
+TYPED_TEST_SUITE_P(TeamsDynamicSharedTest);
+template <typename T>
+class TeamsDynamicSharedTest : public ::testing::Test
+{
+};
+
+TYPED_TEST_P(TeamsDynamicSharedTest, DynamicSharedTeams)
+{
+
+  using WORKING_RES = typename camp::at<TypeParam, camp::num<0>>::type;
+  using LAUNCH_POLICY = typename camp::at<typename camp::at<TypeParam,camp::num<1>>::type, camp::num<0>>::type;
+  using TEAM_POLICY = typename camp::at<typename camp::at<TypeParam,camp::num<1>>::type, camp::num<1>>::type;
+  using THREAD_POLICY = typename camp::at<typename camp::at<TypeParam,camp::num<1>>::type, camp::num<2>>::type;
+
+  TeamsDynamicSharedTestImpl<WORKING_RES, LAUNCH_POLICY, TEAM_POLICY, THREAD_POLICY>();
+
+
+}
+
+REGISTER_TYPED_TEST_SUITE_P(TeamsDynamicSharedTest,
+                            DynamicSharedTeams);
+
+#endif  // __TEST_TEAMS_DYNAMIC_SHARED_HPP__
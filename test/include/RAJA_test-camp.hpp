@@ -24,12 +24,17 @@ using SequentialResourceList = HostResourceList;
 
 #if defined(RAJA_ENABLE_OPENMP)
 using OpenMPResourceList = HostResourceList;
+using OpenMPTeamResourceList = HostResourceList;
 #endif
 
 #if defined(RAJA_ENABLE_TBB)
 using TBBResourceList = HostResourceList;
 #endif
 
+#if defined(RAJA_ENABLE_THREAD_TEAM)
+using ThreadTeamResourceList = HostResourceList;
+#endif
+
 #if defined(RAJA_ENABLE_CUDA)
 using CudaResourceList = camp::list<camp::resources::Cuda>;
 #endif
@@ -42,4 +47,8 @@ using OpenMPTargetResourceList = camp::list<camp::resources::Omp>;
 using HipResourceList = camp::list<camp::resources::Hip>;
 #endif
 
+#if defined(RAJA_ENABLE_HOST_ASYNC)
+using HostAsyncResourceList = camp::list<RAJA::resources::HostAsync>;
+#endif
+
 #endif // __RAJA_test_camp_HPP__
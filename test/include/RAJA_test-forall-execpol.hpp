@@ -23,13 +23,13 @@ using SequentialForallExecPols = camp::list< RAJA::seq_exec,
 //
 // Sequential execution policy types for reduction and atomic tests.
 //
-// Note: RAJA::simd_exec does not work with these.
-//
 using SequentialForallReduceExecPols = camp::list< RAJA::seq_exec,
-                                                   RAJA::loop_exec >;
+                                                   RAJA::loop_exec,
+                                                   RAJA::simd_exec >;
 
 using SequentialForallAtomicExecPols = camp::list< RAJA::seq_exec, 
-                                                   RAJA::loop_exec >;
+                                                   RAJA::loop_exec,
+                                                   RAJA::simd_exec >;
 
 #if defined(RAJA_ENABLE_OPENMP)
 using OpenMPForallExecPols = 
@@ -38,6 +38,10 @@ using OpenMPForallExecPols =
               , RAJA::omp_parallel_for_static_exec< >
               , RAJA::omp_parallel_for_static_exec<4>
 
+              , RAJA::omp_parallel_for_numa_exec< >
+
+              , RAJA::omp_parallel_for_simd_exec
+
 #if defined(RAJA_TEST_EXHAUSTIVE)
               , RAJA::omp_parallel_for_dynamic_exec< >
               , RAJA::omp_parallel_for_dynamic_exec<4>
@@ -70,6 +74,9 @@ using OpenMPForallExecPols =
 
               , RAJA::omp_parallel_exec<RAJA::omp_for_runtime_exec>
               , RAJA::omp_parallel_exec<RAJA::omp_for_schedule_exec<RAJA::policy::omp::Runtime>>
+
+              , RAJA::omp_parallel_exec<RAJA::omp_for_simd_schedule_exec<RAJA::policy::omp::Static<8>>>
+              , RAJA::omp_parallel_exec<RAJA::omp_for_simd_schedule_exec<RAJA::policy::omp::Dynamic<2>>>
 #endif       
              >;
 
@@ -107,7 +114,13 @@ using TBBForallExecPols = camp::list< RAJA::tbb_for_exec,
 using TBBForallReduceExecPols = TBBForallExecPols;
 
 using TBBForallAtomicExecPols = TBBForallExecPols;
+#endif
+
+#if defined(RAJA_ENABLE_THREAD_TEAM)
+using ThreadTeamForallExecPols = camp::list< RAJA::thread_team_for_exec< >,
+                                             RAJA::thread_team_for_exec<4> >;
 
+using ThreadTeamForallReduceExecPols = ThreadTeamForallExecPols;
 #endif
 
 #if defined(RAJA_ENABLE_TARGET_OPENMP)
@@ -141,4 +154,15 @@ using HipForallAtomicExecPols = HipForallExecPols;
 
 #endif
 
+#if defined(RAJA_ENABLE_HOST_ASYNC)
+#if defined(RAJA_ENABLE_OPENMP)
+using HostAsyncForallExecPols = camp::list< RAJA::seq_exec,
+                                            RAJA::omp_parallel_for_exec >;
+#else
+using HostAsyncForallExecPols = camp::list< RAJA::seq_exec,
+                                            RAJA::loop_exec >;
+#endif
+
+#endif
+
 #endif  // __RAJA_test_forall_execpol_HPP__
@@ -20,23 +20,28 @@ using SequentialForallIndexSetExecPols =
 //
 // Sequential execution policy types for reduction tests.
 //
-// Note: RAJA::simd_exec does not work with these.
-//
 using SequentialForallIndexSetReduceExecPols =
   camp::list< RAJA::ExecPolicy<RAJA::seq_segit, RAJA::seq_exec>,
-              RAJA::ExecPolicy<RAJA::seq_segit, RAJA::loop_exec> >;
+              RAJA::ExecPolicy<RAJA::seq_segit, RAJA::loop_exec>,
+              RAJA::ExecPolicy<RAJA::seq_segit, RAJA::simd_exec> >;
 
 #if defined(RAJA_ENABLE_OPENMP)
 using OpenMPForallIndexSetExecPols =  
   camp::list< RAJA::ExecPolicy<RAJA::omp_parallel_for_segit, RAJA::seq_exec>,
               RAJA::ExecPolicy<RAJA::omp_parallel_for_segit, RAJA::loop_exec>,
               RAJA::ExecPolicy<RAJA::omp_parallel_for_segit, RAJA::simd_exec>,
+              RAJA::ExecPolicy<RAJA::omp_parallel_balanced_segit, RAJA::seq_exec>,
+              RAJA::ExecPolicy<RAJA::omp_parallel_balanced_segit, RAJA::loop_exec>,
+              RAJA::ExecPolicy<RAJA::omp_parallel_balanced_segit, RAJA::simd_exec>,
               RAJA::ExecPolicy<RAJA::seq_segit, RAJA::omp_parallel_for_exec> >;
 
 using OpenMPForallIndexSetReduceExecPols =
   camp::list< RAJA::ExecPolicy<RAJA::omp_parallel_for_segit, RAJA::seq_exec>,
               RAJA::ExecPolicy<RAJA::omp_parallel_for_segit, RAJA::loop_exec>,
-              RAJA::ExecPolicy<RAJA::seq_segit, RAJA::omp_parallel_for_exec> >;
+              RAJA::ExecPolicy<RAJA::omp_parallel_for_segit, RAJA::simd_exec>,
+              RAJA::ExecPolicy<RAJA::omp_parallel_balanced_segit, RAJA::seq_exec>,
+              RAJA::ExecPolicy<RAJA::seq_segit, RAJA::omp_parallel_for_exec>,
+              RAJA::ExecPolicy<RAJA::seq_segit, RAJA::omp_parallel_for_simd_exec> >;
 #endif
 
 #if defined(RAJA_ENABLE_TBB)
@@ -67,6 +72,21 @@ using TBBForallIndexSetReduceExecPols =
               RAJA::ExecPolicy<RAJA::seq_segit, RAJA::tbb_for_dynamic> >;
 #endif
 
+#if defined(RAJA_ENABLE_THREAD_TEAM)
+using ThreadTeamForallIndexSetExecPols =
+  camp::list< RAJA::ExecPolicy<RAJA::thread_team_segit, RAJA::seq_exec>,
+              RAJA::ExecPolicy<RAJA::thread_team_segit, RAJA::loop_exec>,
+              RAJA::ExecPolicy<RAJA::thread_team_segit, RAJA::simd_exec>,
+              RAJA::ExecPolicy<RAJA::seq_segit, RAJA::thread_team_for_exec< >>,
+              RAJA::ExecPolicy<RAJA::seq_segit, RAJA::thread_team_for_exec< 4 >> >;
+
+using ThreadTeamForallIndexSetReduceExecPols =
+  camp::list< RAJA::ExecPolicy<RAJA::thread_team_segit, RAJA::seq_exec>,
+              RAJA::ExecPolicy<RAJA::thread_team_segit, RAJA::loop_exec>,
+              RAJA::ExecPolicy<RAJA::seq_segit, RAJA::thread_team_for_exec< >>,
+              RAJA::ExecPolicy<RAJA::seq_segit, RAJA::thread_team_for_exec< 4 >> >;
+#endif
+
 #if defined(RAJA_ENABLE_TARGET_OPENMP)
 using OpenMPTargetForallIndexSetExecPols =
   camp::list< RAJA::ExecPolicy<RAJA::seq_segit,
@@ -32,6 +32,10 @@ using OpenMPReducePols =
 using TBBReducePols = camp::list< RAJA::tbb_reduce >;
 #endif
 
+#if defined(RAJA_ENABLE_THREAD_TEAM)
+using ThreadTeamReducePols = camp::list< RAJA::thread_team_reduce >;
+#endif
+
 #if defined(RAJA_ENABLE_TARGET_OPENMP)
 using OpenMPTargetReducePols =
   camp::list< RAJA::omp_target_reduce >;
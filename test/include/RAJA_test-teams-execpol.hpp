@@ -77,8 +77,39 @@ using OpenMP_launch_policies = camp::list<
          RAJA::expt::LoopPolicy<RAJA::loop_exec>>>;
 #endif
 
+//
+// Teams run by groups of 4 threads, host only
+//
+#if defined(RAJA_ENABLE_CUDA)
+using OpenMPTeam_launch_policies = camp::list<
+        camp::list<
+         RAJA::expt::LaunchPolicy<RAJA::expt::omp_team_launch_t<4>,RAJA::expt::cuda_launch_t<false>>,
+         RAJA::expt::LoopPolicy<RAJA::expt::omp_team_exec, RAJA::cuda_block_x_direct>,
+         RAJA::expt::LoopPolicy<RAJA::expt::omp_team_thread_exec, RAJA::cuda_thread_x_loop>>>;
+#elif defined(RAJA_ENABLE_HIP)
+using OpenMPTeam_launch_policies = camp::list<
+        camp::list<
+         RAJA::expt::LaunchPolicy<RAJA::expt::omp_team_launch_t<4>,RAJA::expt::hip_launch_t<false>>,
+         RAJA::expt::LoopPolicy<RAJA::expt::omp_team_exec, RAJA::hip_block_x_direct>,
+         RAJA::expt::LoopPolicy<RAJA::expt::omp_team_thread_exec, RAJA::hip_thread_x_loop>>>;
+#else
+using OpenMPTeam_launch_policies = camp::list<
+        camp::list<
+         RAJA::expt::LaunchPolicy<RAJA::expt::omp_team_launch_t<4>>,
+         RAJA::expt::LoopPolicy<RAJA::expt::omp_team_exec>,
+         RAJA::expt::LoopPolicy<RAJA::expt::omp_team_thread_exec>>>;
+#endif
+
 #endif  // RAJA_ENABLE_OPENMP
 
+#if defined(RAJA_ENABLE_THREAD_TEAM)
+using ThreadTeam_launch_policies = camp::list<
+        camp::list<
+         RAJA::expt::LaunchPolicy<RAJA::expt::thread_team_launch_t>,
+         RAJA::expt::LoopPolicy<RAJA::thread_team_for_exec< >>,
+         RAJA::expt::LoopPolicy<RAJA::loop_exec>>>;
+#endif  // RAJA_ENABLE_THREAD_TEAM
+
 #if defined(RAJA_ENABLE_CUDA)
 using Cuda_launch_policies = camp::list<
          seq_cuda_policies
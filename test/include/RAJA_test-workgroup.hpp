@@ -333,7 +333,12 @@ using TBBExecPolicyList =
                 RAJA::tbb_work
               >;
 using TBBOrderedPolicyList = SequentialOrderedPolicyList;
-using TBBOrderPolicyList   = SequentialOrderPolicyList;
+using TBBOrderPolicyList   =
+    camp::list<
+                RAJA::ordered,
+                RAJA::reverse_ordered,
+                RAJA::unordered_tbb_task_group
+              >;
 using TBBStoragePolicyList = SequentialStoragePolicyList;
 #endif
 
@@ -343,7 +348,12 @@ using OpenMPExecPolicyList =
                 RAJA::omp_work
               >;
 using OpenMPOrderedPolicyList = SequentialOrderedPolicyList;
-using OpenMPOrderPolicyList   = SequentialOrderPolicyList;
+using OpenMPOrderPolicyList   =
+    camp::list<
+                RAJA::ordered,
+                RAJA::reverse_ordered,
+                RAJA::unordered_omp_loop_iter_flattened
+              >;
 using OpenMPStoragePolicyList = SequentialStoragePolicyList;
 #endif
 
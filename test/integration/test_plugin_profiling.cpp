@@ -0,0 +1,199 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-21, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+#include "RAJA/RAJA.hpp"
+#include "RAJA/util/ProfilingPlugin.hpp"
+#include "gtest/gtest.h"
+
+#include <sstream>
+#include <string>
+
+// Keeps what the plugins saw at the last launch
+class LastContextPlugin : public RAJA::util::PluginStrategy
+{
+public:
+  void postLaunch(const RAJA::util::PluginContext& p) override
+  {
+    name = p.name();
+    policy_name = p.policy_name();
+    num_iterations = p.num_iterations;
+    host_resource = p.get_resource<camp::resources::Host>() != nullptr;
+  }
+
+  static std::string name;
+  static std::string policy_name;
+  static size_t num_iterations;
+  static bool host_resource;
+};
+
+std::string LastContextPlugin::name;
+std::string LastContextPlugin::policy_name;
+size_t LastContextPlugin::num_iterations = 0;
+bool LastContextPlugin::host_resource = false;
+
+static RAJA::util::PluginRegistry::add<LastContextPlugin> L("last-context", "LastContext");
+
+static RAJA::util::ProfilingPlugin* getProfilingPlugin()
+{
+  for (auto plugin = RAJA::util::PluginRegistry::begin();
+       plugin != RAJA::util::PluginRegistry::end();
+       ++plugin) {
+    if ((*plugin).getName() == "ProfilingPlugin") {
+      return dynamic_cast<RAJA::util::ProfilingPlugin*>((*plugin).get());
+    }
+  }
+  return nullptr;
+}
+
+TEST(PluginTestProfiling, Forall)
+{
+  RAJA::util::ProfilingPlugin* profiler = getProfilingPlugin();
+  ASSERT_NE(profiler, nullptr);
+  profiler->reset();
+
+  int* a = new int[100];
+  auto body = [=](int i) { a[i] = i; };
+
+  for (int rep = 0; rep < 3; ++rep) {
+    RAJA::forall<RAJA::seq_exec>(RAJA::RangeSegment(0, 100), body);
+  }
+
+  auto stats = profiler->getStats();
+  const void* kernel_id = RAJA::util::detail::type_id<decltype(body)>();
+
+  bool found = false;
+  for (const auto& s : stats) {
+    if (s.kernel_id == kernel_id) {
+      found = true;
+      ASSERT_EQ(s.num_launches, 3u);
+      ASSERT_EQ(s.num_iterations, 300u);
+      ASSERT_EQ(s.platform, RAJA::Platform::host);
+      ASSERT_LE(s.min_ns, s.max_ns);
+      ASSERT_GE(s.total_ns, s.max_ns);
+    }
+  }
+  ASSERT_TRUE(found);
+
+  std::ostringstream json;
+  profiler->printJSON(json);
+  ASSERT_NE(json.str().find("\"launches\": 3"), std::string::npos);
+
+  profiler->reset();
+  ASSERT_TRUE(profiler->getStats().empty());
+
+  delete[] a;
+}
+
+TEST(PluginTestProfiling, KernelName)
+{
+  RAJA::util::ProfilingPlugin* profiler = getProfilingPlugin();
+  ASSERT_NE(profiler, nullptr);
+  ASSERT_TRUE(RAJA::util::plugins_active());
+  profiler->reset();
+
+  int* a = new int[50];
+  auto body = [=](int i) { a[i] = i; };
+
+  {
+    RAJA::util::ScopedKernelName name("named-fill");
+    RAJA::forall<RAJA::seq_exec>(RAJA::RangeSegment(0, 50), body);
+  }
+
+  ASSERT_EQ(LastContextPlugin::name, "named-fill");
+  ASSERT_NE(LastContextPlugin::policy_name.find("seq_exec"), std::string::npos);
+  ASSERT_EQ(LastContextPlugin::num_iterations, 50u);
+  ASSERT_TRUE(LastContextPlugin::host_resource);
+
+  RAJA::forall<RAJA::seq_exec>(RAJA::RangeSegment(0, 50), body);
+  ASSERT_NE(LastContextPlugin::name, "named-fill");
+
+  {
+    RAJA::util::ScopedKernelName name("named-fill");
+    RAJA::forall<RAJA::seq_exec>(RAJA::RangeSegment(0, 50), body);
+  }
+
+  // the same call site under another name is another kernel
+  auto stats = profiler->getStats();
+  ASSERT_EQ(stats.size(), 2u);
+  for (const auto& s : stats) {
+    if (s.kernel_name.empty()) {
+      ASSERT_EQ(s.num_launches, 1u);
+    } else {
+      ASSERT_EQ(s.kernel_name, "named-fill");
+      ASSERT_EQ(s.num_launches, 2u);
+    }
+  }
+
+  std::ostringstream summary;
+  profiler->printSummary(summary);
+  ASSERT_NE(summary.str().find("named-fill"), std::string::npos);
+
+  profiler->reset();
+  delete[] a;
+}
+
+TEST(PluginTestProfiling, KernelIterations)
+{
+  using pol = RAJA::KernelPolicy<
+      RAJA::statement::For<1, RAJA::loop_exec,
+        RAJA::statement::For<0, RAJA::loop_exec,
+          RAJA::statement::Lambda<0>>>>;
+
+  int count = 0;
+  RAJA::kernel<pol>(
+      RAJA::make_tuple(RAJA::RangeSegment(0, 7), RAJA::RangeSegment(0, 3)),
+      [&](int, int) { ++count; });
+
+  ASSERT_EQ(count, 21);
+  ASSERT_EQ(LastContextPlugin::num_iterations, 21u);
+  ASSERT_TRUE(LastContextPlugin::host_resource);
+}
+
+TEST(PluginTestProfiling, SeparateInstances)
+{
+  RAJA::util::ProfilingPlugin first;
+  RAJA::util::ProfilingPlugin second;
+
+  auto body_a = [](int) {};
+  auto body_b = [](int) {};
+  auto context_a =
+      RAJA::util::make_context<RAJA::seq_exec, decltype(body_a)>(10);
+  auto context_b =
+      RAJA::util::make_context<RAJA::seq_exec, decltype(body_b)>(3);
+
+  // alternate between the instances on one thread, nesting the launches
+  for (int rep = 0; rep < 5; ++rep) {
+    first.preLaunch(context_a);
+    second.preLaunch(context_b);
+    second.postLaunch(context_b);
+    first.postLaunch(context_a);
+  }
+
+  auto first_stats = first.getStats();
+  auto second_stats = second.getStats();
+  ASSERT_EQ(first_stats.size(), 1u);
+  ASSERT_EQ(second_stats.size(), 1u);
+  ASSERT_EQ(first_stats[0].kernel_id, context_a.kernel_id);
+  ASSERT_EQ(first_stats[0].num_launches, 5u);
+  ASSERT_EQ(first_stats[0].num_iterations, 50u);
+  ASSERT_EQ(second_stats[0].kernel_id, context_b.kernel_id);
+  ASSERT_EQ(second_stats[0].num_launches, 5u);
+  ASSERT_EQ(second_stats[0].num_iterations, 15u);
+
+  // a reset only affects its own instance, and launches count again after it
+  first.reset();
+  ASSERT_TRUE(first.getStats().empty());
+  ASSERT_EQ(second.getStats().size(), 1u);
+
+  first.preLaunch(context_a);
+  first.postLaunch(context_a);
+  first_stats = first.getStats();
+  ASSERT_EQ(first_stats.size(), 1u);
+  ASSERT_EQ(first_stats[0].num_launches, 1u);
+
+  first.reset();
+  second.reset();
+}
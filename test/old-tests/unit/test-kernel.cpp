@@ -11,6 +11,7 @@
 #include "camp/resource.hpp"
 
 #include <cstdio>
+#include <vector>
 
 #if defined(RAJA_ENABLE_CUDA)
 #include <cuda_runtime.h>
@@ -2310,6 +2311,88 @@ TEST(Kernel, Hyperplane_seq)
 }
 
 
+template <typename Pol>
+void testHyperplane3d()
+{
+  using namespace RAJA;
+
+  constexpr long N = (long)5;
+  constexpr long M = (long)7;
+  constexpr long K = (long)3;
+
+  std::vector<int> x(N * M * K, 0);
+  std::vector<int> visits(N * M * K, 0);
+
+  using myview = View<int, Layout<3, RAJA::Index_type>>;
+  myview xv{x.data(), N, M, K};
+  myview vv{visits.data(), N, M, K};
+
+  kernel<Pol>(RAJA::make_tuple(RAJA::RangeSegment(0, N),
+                               RAJA::RangeStrideSegment(M - 1, -1, -1),
+                               RAJA::RangeSegment(0, K)),
+              [=](Index_type i, Index_type j, Index_type k) {
+                int left = 1;
+                if (i > 0) {
+                  left = xv(i - 1, j, k);
+                }
+
+                int down = 1;
+                if (j < M - 1) {
+                  down = xv(i, j + 1, k);
+                }
+
+                int back = 1;
+                if (k > 0) {
+                  back = xv(i, j, k - 1);
+                }
+
+                xv(i, j, k) = left + down + back;
+                vv(i, j, k) += 1;
+              });
+
+  for (int i = 0; i < N; ++i) {
+    for (int j = 0; j < M; ++j) {
+      for (int k = 0; k < K; ++k) {
+        int left = i > 0 ? xv(i - 1, j, k) : 1;
+        int down = j < M - 1 ? xv(i, j + 1, k) : 1;
+        int back = k > 0 ? xv(i, j, k - 1) : 1;
+        ASSERT_EQ(xv(i, j, k), left + down + back);
+        ASSERT_EQ(vv(i, j, k), 1);
+      }
+    }
+  }
+}
+
+TEST(Kernel, Hyperplane_seq_3d)
+{
+  using namespace RAJA;
+
+  using Pol = KernelPolicy<
+      Hyperplane<0, seq_exec, ArgList<1, 2>, seq_exec, Lambda<0>>>;
+
+  testHyperplane3d<Pol>();
+
+  // hyperplane argument in the middle of the argument list
+  using Pol_mid = KernelPolicy<
+      Hyperplane<1, seq_exec, ArgList<2, 0>, seq_exec, Lambda<0>>>;
+
+  testHyperplane3d<Pol_mid>();
+}
+
+#if defined(RAJA_ENABLE_OPENMP)
+TEST(Kernel, Hyperplane_omp_3d)
+{
+  using namespace RAJA;
+
+  using Pol = KernelPolicy<
+      Hyperplane<0, seq_exec, ArgList<1, 2>,
+                 omp_parallel_collapse_exec, Lambda<0>>>;
+
+  testHyperplane3d<Pol>();
+}
+#endif
+
+
 #if defined(RAJA_ENABLE_CUDA)
 
 
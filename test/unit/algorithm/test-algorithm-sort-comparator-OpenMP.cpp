@@ -0,0 +1,86 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-21, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing tests for OpenMP sorts with a comparator that is
+/// not RAJA::operators::less or greater. Arithmetic keys with those are
+/// radix sorted, these run the comparison sorts and their merge path merges.
+///
+
+//
+// test/include headers
+//
+#include "RAJA_test-base.hpp"
+#include "RAJA_test-camp.hpp"
+
+//
+// Header for tests in ./tests directory
+//
+// Note: CMake adds ./tests as an include dir for these tests.
+//
+#include "test-algorithm-sort.hpp"
+#include "test-algorithm-stable-sort.hpp"
+
+#include <omp.h>
+
+#include <random>
+
+// Orders like RAJA::operators::greater without being recognized as it
+template <typename T>
+struct SortCustomGreater
+{
+  bool operator()(const T& lhs, const T& rhs) const { return rhs < lhs; }
+};
+
+template <typename T>
+class SortComparatorOpenMPTest : public ::testing::Test
+{ };
+
+using SortComparatorOpenMPSorters =
+  ::testing::Types<
+                    PolicySort<RAJA::omp_parallel_for_exec>,
+                    PolicySortPairs<RAJA::omp_parallel_for_exec>,
+                    PolicyStableSort<RAJA::omp_parallel_for_exec>,
+                    PolicyStableSortPairs<RAJA::omp_parallel_for_exec>
+                  >;
+
+TYPED_TEST_SUITE(SortComparatorOpenMPTest, SortComparatorOpenMPSorters);
+
+TYPED_TEST(SortComparatorOpenMPTest, CustomComparator)
+{
+  using Sorter             = TypeParam;
+  using KeyType            = int;
+  using ResType            = camp::resources::Host;
+  using stability_category = typename Sorter::sort_category;
+  using pairs_category     = typename Sorter::sort_interface;
+
+  unsigned seed = get_random_seed();
+  std::mt19937 rng(seed);
+  Sorter sorter{};
+  ResType res = ResType::get_default();
+
+  // uneven thread counts leave merge groups with a missing partner
+  const int max_threads = omp_get_max_threads();
+  for (int num_threads : {2, 3, 5}) {
+    omp_set_num_threads(num_threads);
+
+    for (RAJA::Index_type N : {0, 1, 100, 1000, 10007, 100003}) {
+      std::uniform_int_distribution<RAJA::Index_type> dist(-N / 4, N / 4);
+
+      SortData<ResType, pairs_category, KeyType> data(
+          N, res, [&]() { return dist(rng); });
+
+      ASSERT_TRUE(testSort("custom", seed, data, N,
+          SortCustomGreater<KeyType>{}, sorter, stability_category{},
+          pairs_category{}, sort_comp_interface_tag{}));
+      ASSERT_TRUE(testSort("resource+custom", seed, data, N,
+          SortCustomGreater<KeyType>{}, sorter, stability_category{},
+          pairs_category{}, sort_res_comp_interface_tag{}));
+    }
+  }
+  omp_set_num_threads(max_threads);
+}
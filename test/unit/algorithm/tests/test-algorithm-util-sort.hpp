@@ -57,6 +57,12 @@ struct MergeSort;
 template < typename forone_policy, typename platform = forone_platform<forone_policy> >
 struct MergeSortPairs;
 
+template < typename forone_policy, typename platform = forone_platform<forone_policy> >
+struct RadixSort;
+
+template < typename forone_policy, typename platform = forone_platform<forone_policy> >
+struct RadixSortPairs;
+
 
 template < typename forone_policy >
 struct InsertionSort<forone_policy, RunOnHost>
@@ -283,6 +289,46 @@ struct MergeSortPairs<forone_policy, RunOnHost>
   }
 };
 
+template < typename forone_policy >
+struct RadixSort<forone_policy, RunOnHost>
+  : ForoneSynchronize<forone_policy>
+{
+  using sort_category = stable_sort_tag;
+  using sort_interface = sort_interface_tag;
+  using supports_resource = std::false_type;
+
+  const char* name()
+  {
+    return "RAJA::radix_sort";
+  }
+
+  template < typename... Args >
+  void operator()(Args&&... args)
+  {
+    RAJA::radix_sort(std::forward<Args>(args)...);
+  }
+};
+
+template < typename forone_policy >
+struct RadixSortPairs<forone_policy, RunOnHost>
+  : ForoneSynchronize<forone_policy>
+{
+  using sort_category = stable_sort_tag;
+  using sort_interface = sort_pairs_interface_tag;
+  using supports_resource = std::false_type;
+
+  const char* name()
+  {
+    return "RAJA::radix_sort[pairs]";
+  }
+
+  template < typename... Args >
+  void operator()(Args&&... args)
+  {
+    RAJA::radix_sort_pairs(std::forward<Args>(args)...);
+  }
+};
+
 #if defined(RAJA_ENABLE_CUDA) || defined(RAJA_ENABLE_HIP)
 
 template < typename forone_policy >
@@ -663,6 +709,12 @@ using SequentialMergeSortSorters =
               MergeSortPairs<forone_seq>
             >;
 
+using SequentialRadixSortSorters =
+  camp::list<
+              RadixSort<forone_seq>,
+              RadixSortPairs<forone_seq>
+            >;
+
 #if defined(RAJA_ENABLE_CUDA)
 
 using CudaInsertionSortSorters =
@@ -0,0 +1,122 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-21, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing tests for RAJA reproducible sum reducers.
+///
+
+#include "RAJA_test-base.hpp"
+
+#include <cmath>
+#include <cstdlib>
+#include <limits>
+#include <vector>
+
+#if defined(RAJA_ENABLE_OPENMP)
+#include <omp.h>
+#endif
+
+static std::vector<double> makeReproSumData(int n)
+{
+  // values spanning many orders of magnitude with both signs, so the
+  // rounded sum depends strongly on the order of summation
+  std::vector<double> data(n);
+  srand(4793);
+  for (int i = 0; i < n; ++i) {
+    double mant = static_cast<double>(rand()) / RAND_MAX - 0.5;
+    data[i] = std::ldexp(mant, rand() % 80 - 40);
+  }
+  return data;
+}
+
+template <typename EXEC_POLICY, typename REDUCE_POLICY>
+double reproSum(const std::vector<double>& data, double init)
+{
+  const double* ptr = data.data();
+  RAJA::ReduceReproSum<REDUCE_POLICY, double> sum(init);
+
+  RAJA::forall<EXEC_POLICY>(RAJA::RangeSegment(0, data.size()),
+                            [=](RAJA::Index_type i) { sum += ptr[i]; });
+
+  return sum.get();
+}
+
+TEST(ReducerReproSumUnitTest, ExactSum)
+{
+  RAJA::ExactSum<double> sum;
+  sum += 1.0e300;
+  sum += 1.0;
+  sum += -1.0e300;
+  ASSERT_EQ(sum.value(), 1.0);
+
+  RAJA::ExactSum<double> other(0.25);
+  other += std::numeric_limits<double>::denorm_min();
+  sum += other;
+  sum += -std::numeric_limits<double>::denorm_min();
+  ASSERT_EQ(sum.value(), 1.25);
+
+  sum += std::numeric_limits<double>::infinity();
+  ASSERT_EQ(sum.value(), std::numeric_limits<double>::infinity());
+  sum += -std::numeric_limits<double>::infinity();
+  ASSERT_TRUE(std::isnan(sum.value()));
+
+  RAJA::ExactSum<double> big;
+  big += std::numeric_limits<double>::max();
+  big += std::numeric_limits<double>::max();
+  ASSERT_EQ(big.value(), std::numeric_limits<double>::infinity());
+  big += -std::numeric_limits<double>::max();
+  ASSERT_EQ(big.value(), std::numeric_limits<double>::max());
+}
+
+TEST(ReducerReproSumUnitTest, Sequential)
+{
+  std::vector<double> data = makeReproSumData(10007);
+
+  double ref = reproSum<RAJA::seq_exec, RAJA::seq_reduce>(data, 2.0);
+
+  RAJA::ReduceReproSum<RAJA::seq_reduce, double> sum(0.0);
+  for (int i = static_cast<int>(data.size()) - 1; i >= 0; --i) {
+    sum += data[i];
+  }
+  sum += 2.0;
+  ASSERT_EQ(sum.get(), ref);
+
+  sum.reset(1.0);
+  sum += 0.5;
+  ASSERT_EQ(sum.get(), 1.5);
+}
+
+#if defined(RAJA_ENABLE_OPENMP)
+TEST(ReducerReproSumUnitTest, OpenMP)
+{
+  std::vector<double> data = makeReproSumData(100003);
+
+  double ref = reproSum<RAJA::seq_exec, RAJA::seq_reduce>(data, 2.0);
+
+  const int max_threads = omp_get_max_threads();
+  for (int nthreads = 1; nthreads <= max_threads; nthreads *= 2) {
+    omp_set_num_threads(nthreads);
+    ASSERT_EQ((reproSum<RAJA::omp_parallel_for_exec, RAJA::omp_reduce>(data, 2.0)),
+              ref);
+    ASSERT_EQ((reproSum<RAJA::omp_parallel_for_exec, RAJA::omp_reduce_ordered>(data, 2.0)),
+              ref);
+  }
+  omp_set_num_threads(max_threads);
+}
+#endif
+
+#if defined(RAJA_ENABLE_TBB)
+TEST(ReducerReproSumUnitTest, TBB)
+{
+  std::vector<double> data = makeReproSumData(100003);
+
+  double ref = reproSum<RAJA::seq_exec, RAJA::seq_reduce>(data, 2.0);
+
+  ASSERT_EQ((reproSum<RAJA::tbb_for_exec, RAJA::tbb_reduce>(data, 2.0)), ref);
+  ASSERT_EQ((reproSum<RAJA::tbb_for_dynamic, RAJA::tbb_reduce>(data, 2.0)), ref);
+}
+#endif
@@ -0,0 +1,87 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-21, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing tests for RAJA array sum reducers.
+///
+
+#include "RAJA_test-base.hpp"
+
+#include <vector>
+
+template <typename EXEC_POLICY, typename REDUCE_POLICY>
+void testReduceSumArray(size_t num_bins, RAJA::ReduceArrayStrategy strategy)
+{
+  const int N = 10007;
+
+  RAJA::ReduceSumArray<REDUCE_POLICY, long> hist(num_bins, 3, strategy);
+  ASSERT_EQ(hist.size(), num_bins);
+
+  RAJA::forall<EXEC_POLICY>(RAJA::RangeSegment(0, N), [=](RAJA::Index_type i) {
+    hist[(i * 7) % num_bins] += 1;
+    hist.add(0, 2);
+  });
+
+  std::vector<long> ref(num_bins, 3);
+  for (int i = 0; i < N; ++i) {
+    ref[(i * 7) % num_bins] += 1;
+    ref[0] += 2;
+  }
+
+  ASSERT_EQ(hist.get(), ref);
+  ASSERT_EQ(hist.get(0), ref[0]);
+
+  hist.reset();
+
+  const int nloops = 2;
+  for (int j = 0; j < nloops; ++j) {
+    RAJA::forall<EXEC_POLICY>(RAJA::RangeSegment(0, N), [=](RAJA::Index_type i) {
+      hist[i % num_bins] += 1;
+    });
+  }
+
+  for (size_t b = 0; b < num_bins; ++b) {
+    long count = N / num_bins + (b < N % num_bins ? 1 : 0);
+    ASSERT_EQ(hist.get(b), nloops * count);
+  }
+}
+
+template <typename EXEC_POLICY, typename REDUCE_POLICY>
+void testReduceSumArrayStrategies()
+{
+  using RAJA::ReduceArrayStrategy;
+
+  for (size_t num_bins : {1, 13, 10000}) {
+    testReduceSumArray<EXEC_POLICY, REDUCE_POLICY>(
+        num_bins, ReduceArrayStrategy::automatic);
+    testReduceSumArray<EXEC_POLICY, REDUCE_POLICY>(
+        num_bins, ReduceArrayStrategy::privatized);
+    testReduceSumArray<EXEC_POLICY, REDUCE_POLICY>(
+        num_bins, ReduceArrayStrategy::atomic);
+  }
+}
+
+TEST(ReducerSumArrayUnitTest, Sequential)
+{
+  testReduceSumArrayStrategies<RAJA::seq_exec, RAJA::seq_reduce>();
+}
+
+#if defined(RAJA_ENABLE_OPENMP)
+TEST(ReducerSumArrayUnitTest, OpenMP)
+{
+  testReduceSumArrayStrategies<RAJA::omp_parallel_for_exec, RAJA::omp_reduce>();
+  testReduceSumArrayStrategies<RAJA::omp_parallel_for_exec,
+                               RAJA::omp_reduce_ordered>();
+}
+#endif
+
+#if defined(RAJA_ENABLE_TBB)
+TEST(ReducerSumArrayUnitTest, TBB)
+{
+  testReduceSumArrayStrategies<RAJA::tbb_for_exec, RAJA::tbb_reduce>();
+}
+#endif
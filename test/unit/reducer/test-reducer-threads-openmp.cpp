@@ -0,0 +1,72 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-21, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing tests for omp_reduce reducers combined from
+/// teams other than the one forked by the thread owning the reducer.
+///
+
+#include "RAJA_test-base.hpp"
+
+#include <omp.h>
+
+#include <thread>
+#include <vector>
+
+TEST(ReducerThreadsOpenMP, NestedRegions)
+{
+  const int outer = 4;
+  const int inner = 1000;
+
+  const int max_levels = omp_get_max_active_levels();
+  omp_set_max_active_levels(2);
+
+  RAJA::ReduceSum<RAJA::omp_reduce, long> sum(0);
+  RAJA::ReduceMax<RAJA::omp_reduce, long> max(0);
+
+  RAJA::forall<RAJA::omp_parallel_for_exec>(
+      RAJA::RangeSegment(0, outer), [=](RAJA::Index_type o) {
+        RAJA::forall<RAJA::omp_parallel_for_exec>(
+            RAJA::RangeSegment(0, inner), [=](RAJA::Index_type i) {
+              sum += 1;
+              max.max(o * inner + i);
+            });
+      });
+
+  omp_set_max_active_levels(max_levels);
+
+  ASSERT_EQ(sum.get(), static_cast<long>(outer) * inner);
+  ASSERT_EQ(max.get(), static_cast<long>(outer) * inner - 1);
+}
+
+TEST(ReducerThreadsOpenMP, RegionsOfOtherThreads)
+{
+  const int N = 100000;
+  const int num_threads = 3;
+
+  // each std::thread opens its own region at the level the reducer was
+  // built at, so its team reports the same ancestor as the owner's team
+  for (int rep = 0; rep < 4; ++rep) {
+    RAJA::ReduceSum<RAJA::omp_reduce, long> sum(0);
+
+    auto work = [&]() {
+      RAJA::forall<RAJA::omp_parallel_for_exec>(
+          RAJA::RangeSegment(0, N), [=](RAJA::Index_type) { sum += 1; });
+    };
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < num_threads; ++t) {
+      threads.emplace_back(work);
+    }
+    work();
+    for (auto& t : threads) {
+      t.join();
+    }
+
+    ASSERT_EQ(sum.get(), static_cast<long>(num_threads + 1) * N);
+  }
+}
@@ -0,0 +1,49 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-21, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing tests for reductions in loops run on a HostAsync
+/// resource.
+///
+
+#include "RAJA_test-base.hpp"
+
+template <typename EXEC_POLICY, typename REDUCE_POLICY>
+void HostAsyncReduceTestImpl()
+{
+  constexpr int N = 10000;
+
+  RAJA::resources::HostAsync res;
+
+  for (int rep = 0; rep < 10; ++rep) {
+    RAJA::ReduceSum<REDUCE_POLICY, long> sum(0);
+    RAJA::ReduceMax<REDUCE_POLICY, int> max(-1);
+
+    RAJA::forall<EXEC_POLICY>(res, RAJA::RangeSegment(0, N), [=](int i) {
+      sum += i;
+      max.max(i);
+    });
+
+    // the loop body copies must have combined once wait returns
+    res.wait();
+
+    ASSERT_EQ(sum.get(), static_cast<long>(N) * (N - 1) / 2);
+    ASSERT_EQ(max.get(), N - 1);
+  }
+}
+
+TEST(HostAsyncReduceTest, Sequential)
+{
+  HostAsyncReduceTestImpl<RAJA::seq_exec, RAJA::seq_reduce>();
+}
+
+#if defined(RAJA_ENABLE_OPENMP)
+TEST(HostAsyncReduceTest, OpenMP)
+{
+  HostAsyncReduceTestImpl<RAJA::omp_parallel_for_exec, RAJA::omp_reduce>();
+}
+#endif
@@ -0,0 +1,82 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-21, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing tests for first-touch allocation
+///
+
+#include "RAJA_test-base.hpp"
+
+#include <cstdint>
+#include <vector>
+
+#if defined(RAJA_ENABLE_OPENMP)
+#include <omp.h>
+#endif
+
+TEST(FirstTouchUnitTest, Sequential)
+{
+  const size_t len = 10007;
+  double* a = RAJA::first_touch_allocate<RAJA::seq_exec>(len, 1.5);
+
+  ASSERT_NE(a, nullptr);
+  ASSERT_EQ(reinterpret_cast<std::uintptr_t>(a) % RAJA::first_touch_alignment,
+            0u);
+  for (size_t i = 0; i < len; ++i) {
+    ASSERT_EQ(a[i], 1.5);
+  }
+
+  RAJA::View<double, RAJA::Layout<2>> aView(a, 1, len);
+  ASSERT_EQ(aView(0, len - 1), 1.5);
+
+  RAJA::first_touch_deallocate(a, len);
+  RAJA::first_touch_deallocate<double>(nullptr, 0);
+}
+
+TEST(FirstTouchUnitTest, NonTrivialType)
+{
+  const size_t len = 1000;
+  std::vector<int>* a = RAJA::first_touch_allocate<RAJA::loop_exec>(
+      len, std::vector<int>(3, 7));
+
+  for (size_t i = 0; i < len; ++i) {
+    ASSERT_EQ(a[i].size(), 3u);
+    ASSERT_EQ(a[i][2], 7);
+  }
+
+  RAJA::first_touch_deallocate(a, len);
+}
+
+#if defined(RAJA_ENABLE_OPENMP)
+TEST(FirstTouchUnitTest, OpenMPNuma)
+{
+  using numa_pol = RAJA::omp_parallel_for_numa_exec<>;
+
+  const int len = 100003;
+  int* touched = RAJA::first_touch_allocate<numa_pol>(len, -1);
+  int* used = RAJA::first_touch_allocate<numa_pol, int>(len);
+
+  // launches with the numa policy partition iterations like the static
+  // schedule, so every launch gives each index to the same thread
+  RAJA::forall<numa_pol>(RAJA::RangeSegment(0, len), [=](int i) {
+    touched[i] = omp_get_thread_num();
+  });
+  RAJA::forall<RAJA::omp_parallel_for_static_exec<>>(
+      RAJA::RangeSegment(0, len),
+      [=](int i) { used[i] = omp_get_thread_num(); });
+  RAJA::forall<numa_pol>(RAJA::RangeSegment(0, len), [=](int i) {
+    used[i] -= touched[i];
+  });
+
+  for (int i = 0; i < len; ++i) {
+    ASSERT_EQ(used[i], 0);
+  }
+
+  RAJA::first_touch_deallocate(touched, len);
+  RAJA::first_touch_deallocate(used, len);
+}
+#endif
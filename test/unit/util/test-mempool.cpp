@@ -0,0 +1,124 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-21, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing unit tests for basic_mempool
+///
+
+#include "RAJA_test-base.hpp"
+
+#include "RAJA/util/basic_mempool.hpp"
+
+#include <cstdint>
+#include <vector>
+
+#if defined(RAJA_ENABLE_OPENMP)
+#include <omp.h>
+#endif
+
+using test_mempool = RAJA::basic_mempool::MemPool<RAJA::basic_mempool::generic_allocator>;
+
+
+TEST(MemPoolUnitTest, SizeClassReuse)
+{
+  test_mempool pool;
+
+  int* a = pool.malloc<int>(10);
+  ASSERT_NE(a, nullptr);
+  pool.free(a);
+
+  // a freed block of the same size class is handed out again
+  int* b = pool.malloc<int>(12);
+  ASSERT_EQ(a, b);
+  pool.free(b);
+
+  RAJA::basic_mempool::MemPoolStats stats = pool.get_stats();
+  ASSERT_EQ(stats.num_mallocs, 2u);
+  ASSERT_EQ(stats.num_frees, 2u);
+  ASSERT_EQ(stats.num_misses, 1u);
+  ASSERT_EQ(stats.bytes_in_use, 0u);
+  ASSERT_EQ(stats.high_water_bytes, 64u);
+  ASSERT_GT(stats.hit_rate(), 0.0);
+  ASSERT_GT(stats.fragmentation(), 0.0);
+
+  pool.free_chunks();
+}
+
+TEST(MemPoolUnitTest, AlignmentAndLarge)
+{
+  test_mempool pool;
+
+  std::vector<char*> ptrs;
+  for (size_t alignment = 1; alignment <= 4096; alignment *= 2) {
+    char* ptr = pool.malloc<char>(3, alignment);
+    ASSERT_NE(ptr, nullptr);
+    ASSERT_EQ(reinterpret_cast<uintptr_t>(ptr) % alignment, 0u);
+    ptrs.push_back(ptr);
+  }
+
+  // too large for any size class, served by an arena
+  double* large = pool.malloc<double>(1024 * 1024);
+  ASSERT_NE(large, nullptr);
+  large[0] = 1.0;
+  large[1024 * 1024 - 1] = 2.0;
+  pool.free(large);
+
+  for (char* ptr : ptrs) {
+    pool.free(ptr);
+  }
+
+  RAJA::basic_mempool::MemPoolStats stats = pool.get_stats();
+  ASSERT_EQ(stats.num_mallocs, stats.num_frees);
+  ASSERT_EQ(stats.bytes_in_use, 0u);
+  ASSERT_GE(stats.high_water_bytes, 1024u * 1024u * sizeof(double));
+
+  pool.free_chunks();
+
+  // the pool is usable after freeing its memory
+  int* ptr = pool.malloc<int>(1);
+  ASSERT_NE(ptr, nullptr);
+  pool.free(ptr);
+}
+
+#if defined(RAJA_ENABLE_OPENMP)
+TEST(MemPoolUnitTest, OpenMPConcurrent)
+{
+  test_mempool pool;
+
+  const int num_iters = 10000;
+  int num_errors = 0;
+
+#pragma omp parallel reduction(+:num_errors)
+  {
+    const int thread = omp_get_thread_num();
+    std::vector<int*> ptrs;
+    for (int i = 0; i < num_iters; ++i) {
+      const size_t n = 1 + (i * 7 + thread) % 300;
+      int* ptr = pool.malloc<int>(n);
+      for (size_t j = 0; j < n; ++j) {
+        ptr[j] = thread;
+      }
+      ptrs.push_back(ptr);
+      if (i % 3 == 2) {
+        for (int* p : ptrs) {
+          num_errors += (p[0] != thread) ? 1 : 0;
+          pool.free(p);
+        }
+        ptrs.clear();
+      }
+    }
+    for (int* p : ptrs) {
+      num_errors += (p[0] != thread) ? 1 : 0;
+      pool.free(p);
+    }
+  }
+
+  ASSERT_EQ(num_errors, 0);
+
+  pool.free_chunks();
+}
+#endif
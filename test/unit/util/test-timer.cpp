@@ -16,6 +16,7 @@
 #include <iostream>
 #include <sstream>
 #include <string>
+#include <vector>
 
 #include <chrono>
 #include <thread>
@@ -93,3 +94,40 @@ TEST(TimerUnitTest, No3)
   elapsed = timer.elapsed();
   EXPECT_GT(elapsed, 0.01); 
 }
+
+#if defined(RAJA_HAVE_PERF_COUNTER_TIMER)
+TEST(TimerUnitTest, PerfCounters)
+{
+  RAJA::PerfCounterTimer timer{RAJA::PerfCounter::cycles,
+                               RAJA::PerfCounter::instructions};
+
+  ASSERT_EQ(timer.numCounters(), 2u);
+  ASSERT_EQ(timer.getCounter(1), RAJA::PerfCounter::instructions);
+
+  std::vector<double> data(1 << 20, 1.0);
+  double sum = 0.0;
+
+  timer.start();
+  for (double d : data) {
+    sum += d;
+  }
+  timer.stop();
+
+  EXPECT_EQ(sum, static_cast<double>(data.size()));
+  EXPECT_GT(timer.elapsed(), 0.0);
+
+  // counters may be unavailable, e.g. in containers, and then read as zero
+  for (size_t i = 0; i < timer.numCounters(); ++i) {
+    if (timer.available(i)) {
+      EXPECT_GT(timer.counter(i), 0);
+      EXPECT_EQ(timer.lastCounter(i), timer.counter(i));
+    } else {
+      EXPECT_EQ(timer.counter(i), 0);
+    }
+  }
+
+  timer.reset();
+  ASSERT_EQ(timer.counter(RAJA::PerfCounter::cycles), 0);
+  ASSERT_EQ(timer.counter(RAJA::PerfCounter::branch_misses), 0);
+}
+#endif
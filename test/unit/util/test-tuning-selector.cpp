@@ -0,0 +1,80 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-21, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing unit tests for TuningSelector
+///
+
+#include "RAJA_test-base.hpp"
+
+#include <cstdio>
+#include <vector>
+
+TEST(TuningSelectorUnitTest, PicksFastest)
+{
+  RAJA::TuningSelector s("TuningSelectorUnitTest.PicksFastest", 3, 2);
+  RAJA::RangeSegment seg(0, 100);
+
+  std::vector<int> runs(3, 0);
+  for (int i = 0; i < 6; ++i) {
+    ASSERT_EQ(s.tuned(seg), -1);
+    size_t index = s(seg);
+    ASSERT_LT(index, 3u);
+    ++runs[index];
+    s.report(seg, index, index == 1 ? 1.0 : 2.0);
+  }
+  ASSERT_EQ(runs, std::vector<int>(3, 2));
+
+  ASSERT_EQ(s.tuned(seg), 1);
+  ASSERT_EQ(s(seg), 1u);
+
+  // a new selector for the same call site shares its tuning
+  RAJA::TuningSelector other("TuningSelectorUnitTest.PicksFastest", 3, 2);
+  ASSERT_EQ(other(RAJA::RangeSegment(0, 127)), 1u);
+
+  // a problem size in another power of two bucket tunes again
+  ASSERT_EQ(s.tuned(RAJA::RangeSegment(0, 1000)), -1);
+}
+
+TEST(TuningSelectorUnitTest, MultiPolicy)
+{
+  auto mp = RAJA::MultiPolicy<RAJA::TuningSelector,
+                              RAJA::seq_exec,
+                              RAJA::loop_exec>(
+      RAJA::TuningSelector("TuningSelectorUnitTest.MultiPolicy", 2));
+
+  std::vector<int> data(1000, 0);
+  int *ptr = data.data();
+  for (int i = 0; i < 10; ++i) {
+    RAJA::forall(mp, RAJA::RangeSegment(0, 1000), [=](int j) { ptr[j] += 1; });
+  }
+  ASSERT_EQ(data, std::vector<int>(1000, 10));
+
+  RAJA::TuningSelector s("TuningSelectorUnitTest.MultiPolicy", 2);
+  ASSERT_GE(s.tuned(RAJA::RangeSegment(0, 1000)), 0);
+}
+
+TEST(TuningSelectorUnitTest, SaveLoad)
+{
+  RAJA::TuningSelector s("TuningSelectorUnitTest.SaveLoad", 2, 1);
+  RAJA::RangeSegment seg(0, 64);
+  s.report(seg, s(seg), 2.0);
+  s.report(seg, s(seg), 1.0);
+  ASSERT_EQ(s.tuned(seg), 1);
+
+  const char *filename = "test-tuning-selector.txt";
+  ASSERT_TRUE(RAJA::saveMultiPolicyTuning(filename));
+
+  // the same key with a different number of policies discards the tuning
+  RAJA::TuningSelector reset("TuningSelectorUnitTest.SaveLoad", 3, 1);
+  ASSERT_EQ(reset.tuned(seg), -1);
+
+  ASSERT_TRUE(RAJA::loadMultiPolicyTuning(filename));
+  RAJA::TuningSelector loaded("TuningSelectorUnitTest.SaveLoad", 2, 1);
+  ASSERT_EQ(loaded.tuned(seg), 1);
+  std::remove(filename);
+}
@@ -0,0 +1,165 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-21, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "RAJA_test-base.hpp"
+
+#include <algorithm>
+
+// the intrinsics specializations are used for the architectures the
+// compiler targets, the others use the portable implementation
+using RegisterTypes =
+    ::testing::Types<RAJA::Register<double, RAJA::scalar_register>,
+                     RAJA::Register<double, RAJA::sse_register>,
+                     RAJA::Register<float, RAJA::sse_register>,
+                     RAJA::Register<double, RAJA::avx2_register>,
+                     RAJA::Register<float, RAJA::avx2_register>,
+                     RAJA::Register<double, RAJA::avx512_register>,
+                     RAJA::Register<float, RAJA::avx512_register>,
+                     RAJA::Register<int, RAJA::avx2_register>,
+                     RAJA::Register<double>>;
+
+template <typename T>
+class RegisterUnitTest : public ::testing::Test
+{
+};
+
+TYPED_TEST_SUITE(RegisterUnitTest, RegisterTypes);
+
+TYPED_TEST(RegisterUnitTest, LoadStore)
+{
+  using register_t = TypeParam;
+  using element_t = typename register_t::element_type;
+  constexpr camp::idx_t N = register_t::s_num_elem;
+
+  element_t a[4 * N];
+  element_t out[4 * N];
+  for (camp::idx_t i = 0; i < 4 * N; ++i) {
+    a[i] = element_t(i + 1);
+  }
+
+  for (camp::idx_t n = 0; n <= N; ++n) {
+    register_t x;
+    x.load_packed_n(a, n);
+    register_t y;
+    y.load_strided_n(a, 3, n);
+    for (camp::idx_t i = 0; i < N; ++i) {
+      ASSERT_EQ(x.get(i), i < n ? a[i] : element_t(0));
+      ASSERT_EQ(y.get(i), i < n ? a[3 * i] : element_t(0));
+    }
+
+    std::fill(out, out + 4 * N, element_t(-1));
+    x.store_packed_n(out, n);
+    for (camp::idx_t i = 0; i < 2 * N; ++i) {
+      ASSERT_EQ(out[i], i < n ? a[i] : element_t(-1));
+    }
+
+    std::fill(out, out + 4 * N, element_t(-1));
+    x.store_strided_n(out, 2, n);
+    for (camp::idx_t i = 0; i < 2 * N; ++i) {
+      ASSERT_EQ(out[i], (i % 2 == 0 && i / 2 < n) ? a[i / 2] : element_t(-1));
+    }
+  }
+
+  camp::idx_t offsets[N];
+  for (camp::idx_t i = 0; i < N; ++i) {
+    offsets[i] = (N - 1 - i) * 2;
+  }
+  register_t g;
+  g.gather(a, offsets);
+  std::fill(out, out + 4 * N, element_t(-1));
+  g.scatter(out, offsets);
+  for (camp::idx_t i = 0; i < N; ++i) {
+    ASSERT_EQ(g.get(i), a[offsets[i]]);
+    ASSERT_EQ(out[offsets[i]], a[offsets[i]]);
+  }
+}
+
+TYPED_TEST(RegisterUnitTest, Arithmetic)
+{
+  using register_t = TypeParam;
+  using element_t = typename register_t::element_type;
+  constexpr camp::idx_t N = register_t::s_num_elem;
+
+  element_t a[N];
+  element_t b[N];
+  for (camp::idx_t i = 0; i < N; ++i) {
+    a[i] = element_t(i + 1);
+    b[i] = element_t(3 * i - 4);
+  }
+
+  register_t x, y;
+  x.load_packed(a);
+  y.load_packed(b);
+
+  register_t sum = x + y;
+  register_t diff = x - y;
+  register_t prod = x * y;
+  register_t quot = y / x;
+  register_t scaled = element_t(2) * x;
+  register_t fma = x.multiply_add(y, register_t(element_t(3)));
+  register_t fms = x.multiply_subtract(y, register_t(element_t(3)));
+  register_t lo = x.vmin(y);
+  register_t hi = x.vmax(y);
+
+  element_t total = 0;
+  for (camp::idx_t i = 0; i < N; ++i) {
+    ASSERT_EQ(sum.get(i), a[i] + b[i]);
+    ASSERT_EQ(diff.get(i), a[i] - b[i]);
+    ASSERT_EQ(prod.get(i), a[i] * b[i]);
+    ASSERT_EQ(quot.get(i), b[i] / a[i]);
+    ASSERT_EQ(scaled.get(i), 2 * a[i]);
+    ASSERT_EQ(fma.get(i), a[i] * b[i] + 3);
+    ASSERT_EQ(fms.get(i), a[i] * b[i] - 3);
+    ASSERT_EQ(lo.get(i), std::min(a[i], b[i]));
+    ASSERT_EQ(hi.get(i), std::max(a[i], b[i]));
+    total += b[i];
+  }
+
+  ASSERT_EQ(y.sum(), total);
+  ASSERT_EQ(y.max(), *std::max_element(b, b + N));
+  ASSERT_EQ(y.min(), *std::min_element(b, b + N));
+  ASSERT_EQ(y.max_n(1), b[0]);
+  ASSERT_EQ(x.dot(y), prod.sum());
+}
+
+TYPED_TEST(RegisterUnitTest, CompareBlend)
+{
+  using register_t = TypeParam;
+  using element_t = typename register_t::element_type;
+  using mask_t = typename register_t::mask_type;
+  constexpr camp::idx_t N = register_t::s_num_elem;
+
+  element_t a[N];
+  element_t b[N];
+  for (camp::idx_t i = 0; i < N; ++i) {
+    a[i] = element_t(i);
+    b[i] = element_t(N - 1 - i);
+  }
+
+  register_t x, y;
+  x.load_packed(a);
+  y.load_packed(b);
+
+  mask_t lt = 0;
+  mask_t eq = 0;
+  for (camp::idx_t i = 0; i < N; ++i) {
+    lt |= mask_t(a[i] < b[i] ? 1 : 0) << i;
+    eq |= mask_t(a[i] == b[i] ? 1 : 0) << i;
+  }
+
+  ASSERT_EQ(x.cmp_lt(y), lt);
+  ASSERT_EQ(x.cmp_eq(y), eq);
+  ASSERT_EQ(x.cmp_ne(y), register_t::lane_mask(N) & ~eq);
+  ASSERT_EQ(x.cmp_ge(y), register_t::lane_mask(N) & ~lt);
+  ASSERT_EQ(y.cmp_gt(x), lt);
+  ASSERT_EQ(y.cmp_le(x), register_t::lane_mask(N) & ~lt);
+
+  register_t blended = x.blend(y, lt);
+  for (camp::idx_t i = 0; i < N; ++i) {
+    ASSERT_EQ(blended.get(i), ((lt >> i) & 1) ? b[i] : a[i]);
+  }
+}
@@ -0,0 +1,86 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-21, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "RAJA_test-base.hpp"
+
+#include <vector>
+
+using VectorExecTypes =
+    ::testing::Types<RAJA::Register<double, RAJA::scalar_register>,
+                     RAJA::Register<double>,
+                     RAJA::Register<float>>;
+
+template <typename T>
+class VectorExecUnitTest : public ::testing::Test
+{
+};
+
+TYPED_TEST_SUITE(VectorExecUnitTest, VectorExecTypes);
+
+TYPED_TEST(VectorExecUnitTest, ForallView1D)
+{
+  using register_t = TypeParam;
+  using element_t = typename register_t::element_type;
+  using view_t = RAJA::View<element_t, RAJA::Layout<1>>;
+
+  // lengths that do and do not fill the last register
+  for (int len : {0, 1, 7, 64, 67}) {
+    std::vector<element_t> x_data(len), y_data(len);
+    for (int i = 0; i < len; ++i) {
+      x_data[i] = element_t(i);
+      y_data[i] = element_t(2 * i);
+    }
+    view_t x(x_data.data(), len);
+    view_t y(y_data.data(), len);
+
+    RAJA::forall<RAJA::vector_exec<register_t>>(
+        RAJA::TypedRangeSegment<int>(0, len), [=](auto i) {
+          y(i) += element_t(3) * x(i);
+        });
+
+    for (int i = 0; i < len; ++i) {
+      ASSERT_EQ(y_data[i], element_t(5 * i));
+    }
+  }
+}
+
+TYPED_TEST(VectorExecUnitTest, ForallView2DStrided)
+{
+  using register_t = TypeParam;
+  using element_t = typename register_t::element_type;
+  using view_t = RAJA::View<element_t, RAJA::Layout<2, int, 1>>;
+
+  constexpr int rows = 13;
+  constexpr int cols = 5;
+  std::vector<element_t> a_data(rows * cols);
+  for (int i = 0; i < rows * cols; ++i) {
+    a_data[i] = element_t(i);
+  }
+  std::vector<element_t> col_sum(cols, element_t(0));
+  view_t a(a_data.data(), rows, cols);
+
+  // the vector index runs down a column, which has stride cols
+  for (int c = 0; c < cols; ++c) {
+    element_t* sum = &col_sum[c];
+    RAJA::forall<RAJA::vector_exec<register_t>>(
+        RAJA::TypedRangeSegment<int>(0, rows), [=](auto r) {
+          *sum += a(r, c).sum();
+          a(r, c) = element_t(-1);
+        });
+  }
+
+  for (int c = 0; c < cols; ++c) {
+    element_t expected = 0;
+    for (int r = 0; r < rows; ++r) {
+      expected += element_t(r * cols + c);
+    }
+    ASSERT_EQ(col_sum[c], expected);
+  }
+  for (int i = 0; i < rows * cols; ++i) {
+    ASSERT_EQ(a_data[i], element_t(-1));
+  }
+}